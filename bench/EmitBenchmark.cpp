@@ -0,0 +1,96 @@
+#include "TypeLayout.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+///Number of the member variables, intro virtual functions and virtual table slots of the synthetic type, roughly the size of the largest engine classes
+static constexpr int32_t NumMemberVariables = 20000;
+static constexpr int32_t NumVirtualFunctions = 5000;
+static constexpr int32_t NumVirtualTableSlots = 20000;
+static constexpr int32_t NumIterations = 20;
+
+///Builds a layout mixing all of the member kinds the emitter spells differently: UDTs, arrays, bitfields and the value initialized members
+static void MakeSyntheticLayout(FUserDefinedTypeLayout& OutLayout, FVirtualTableRVALayout& OutRVALayout) {
+    OutLayout.ClassName = "UE::Core::UBenchmarkObject";
+    OutLayout.SourceFilePath = "Runtime/CoreUObject/Public/UObject/Object.h";
+    OutLayout.SourceLineNumber = 42;
+    OutLayout.VirtualTableEntriesCount = NumVirtualTableSlots;
+
+    const std::string UDTType = "TArray<class UObject*, TSizedDefaultAllocator<32> >";
+    const std::string IntegralType = "int32";
+    const std::string IntegralDefaultValue = "0";
+    for (int32_t MemberIndex = 0; MemberIndex < NumMemberVariables; MemberIndex++) {
+        FMemberVariable Variable{};
+        Variable.VariableName = "Member" + std::to_string(MemberIndex);
+        Variable.bIsUDT = MemberIndex % 3 == 0;
+        Variable.VariableType = Variable.bIsUDT ? UDTType : IntegralType;
+        Variable.VariableAccess = static_cast<EMemberAccess>(1 + MemberIndex % 3);
+        Variable.bIsArray = MemberIndex % 7 == 0;
+        Variable.ArraySize = 4;
+        Variable.bIsBitfield = MemberIndex % 11 == 0 && !Variable.bIsArray;
+        Variable.BitfieldBitSize = 1;
+        Variable.bNeedsValueInit = !Variable.bIsUDT;
+        Variable.ValueInitDefaultValue = IntegralDefaultValue;
+        Variable.bNeedsNoInitConstructorCall = Variable.bIsUDT;
+        OutLayout.MemberVariables.push_back(Variable);
+    }
+    for (int32_t FunctionIndex = 0; FunctionIndex < NumVirtualFunctions; FunctionIndex++) {
+        FVirtualFunctionDeclaration Function{};
+        Function.FunctionName = "Function" + std::to_string(FunctionIndex);
+        Function.FunctionDeclaration = "virtual void Function" + std::to_string(FunctionIndex) + "(int32, class UObject*) {};";
+        Function.VirtualTableOffset = FunctionIndex * 8;
+        OutLayout.VirtualFunctions.push_back(Function);
+    }
+
+    OutRVALayout.ClassName = OutLayout.ClassName;
+    OutRVALayout.VirtualTableRVA = 0x4000000;
+    for (int32_t SlotIndex = 0; SlotIndex < NumVirtualTableSlots; SlotIndex++) {
+        OutRVALayout.VirtualFunctions.push_back(FVirtualFunctionRVA{SlotIndex, "Function" + std::to_string(SlotIndex), 0x1000u + SlotIndex * 16u});
+    }
+}
+
+static void PrintResult(const char* RunName, size_t NumLinesPerIteration, size_t NumBytesPerIteration, double Seconds) {
+    std::printf("%-28s %8.1f ms %12.0f lines/s %8.1f MB/s\n", RunName, Seconds * 1000.0 / NumIterations,
+        static_cast<double>(NumLinesPerIteration) * NumIterations / Seconds, static_cast<double>(NumBytesPerIteration) * NumIterations / Seconds / (1024.0 * 1024.0));
+}
+
+int main() {
+    FUserDefinedTypeLayout TypeLayout{};
+    FVirtualTableRVALayout RVALayout{};
+    MakeSyntheticLayout(TypeLayout, RVALayout);
+
+    ///Generating the text alone, the layout macros and the RVAs of the type in one section
+    std::string Section;
+    auto StartTime = std::chrono::steady_clock::now();
+    for (int32_t Iteration = 0; Iteration < NumIterations; Iteration++) {
+        Section = GenerateTypeLayoutSection(TypeLayout, &RVALayout);
+    }
+    const double GenerateSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+    const size_t NumLines = static_cast<size_t>(std::count(Section.begin(), Section.end(), '\n'));
+    PrintResult("generate section", NumLines, Section.size(), GenerateSeconds);
+
+    ///Generating and writing both headers of the type. Every iteration gets a fresh directory, so the unchanged files are never skipped
+    const std::filesystem::path OutputRootPath = std::filesystem::temp_directory_path() / "UVTDEmitBenchmark";
+    std::filesystem::remove_all(OutputRootPath);
+    StartTime = std::chrono::steady_clock::now();
+    for (int32_t Iteration = 0; Iteration < NumIterations; Iteration++) {
+        FOutputDirectory OutputDirectory{OutputRootPath / std::to_string(Iteration)};
+        if (!OutputDirectory.Open()) {
+            std::printf("Failed to create the output directory %s\n", OutputDirectory.GetPath().string().c_str());
+            return 1;
+        }
+        WriteTypeLayoutFile(OutputDirectory, TypeLayout);
+        WriteVirtualTableRVAFile(OutputDirectory, RVALayout);
+        if (!OutputDirectory.WaitForPendingWrites()) {
+            std::printf("Failed to write the headers into %s\n", OutputDirectory.GetPath().string().c_str());
+            return 1;
+        }
+    }
+    const double WriteSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+    PrintResult("generate and write headers", NumLines, Section.size(), WriteSeconds);
+
+    std::filesystem::remove_all(OutputRootPath);
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include "MemorySymbolSource.h"
+#include "ParallelFor.h"
+#include "TypeLayoutGenerator.h"
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+///Number of the synthetic classes, and the number of the members and the virtual functions of each of them
+static constexpr int32_t NumClasses = 4000;
+static constexpr int32_t NumMembersPerClass = 40;
+static constexpr int32_t NumVirtualFunctionsPerClass = 20;
+
+///Builds a deep hierarchy of classes referencing each other, so the declarations of the common types are shared the same way they are in the real PDBs
+static std::vector<FSymbolHandle> AddSyntheticTypes(FMemorySymbolSource& Source) {
+    const FSymbolHandle Void = Source.AddBasicType(EBasicType::Void, 0);
+    const FSymbolHandle Int32 = Source.AddBasicType(EBasicType::Int, 4);
+    const FSymbolHandle Float = Source.AddBasicType(EBasicType::Float, 4);
+    const FSymbolHandle FName = Source.AddUserDefinedType("FName", EUDTKind::Struct, 8, true);
+    const FSymbolHandle FNameArray = Source.AddArrayType(FName, 4);
+
+    std::vector<FSymbolHandle> Classes;
+    Classes.reserve(NumClasses);
+    for (int32_t ClassIndex = 0; ClassIndex < NumClasses; ClassIndex++) {
+        const FSymbolHandle Class = Source.AddUserDefinedType("UClass" + std::to_string(ClassIndex), EUDTKind::Class, 8 + NumMembersPerClass * 8, true);
+        const FSymbolHandle OtherClassPointer = Source.AddPointerType(ClassIndex != 0 ? Classes[ClassIndex / 2] : Class);
+        if (ClassIndex != 0) {
+            Source.AddBaseClass(Class, Classes[ClassIndex - 1], 0);
+        }
+        for (int32_t MemberIndex = 0; MemberIndex < NumMembersPerClass; MemberIndex++) {
+            const FSymbolHandle MemberTypes[] = {Int32, Float, FName, OtherClassPointer, FNameArray};
+            Source.AddMemberVariable(Class, "Member" + std::to_string(MemberIndex), MemberTypes[MemberIndex % 5], 8 + MemberIndex * 8);
+        }
+        for (int32_t FunctionIndex = 0; FunctionIndex < NumVirtualFunctionsPerClass; FunctionIndex++) {
+            const FSymbolHandle FunctionType = Source.AddFunctionType(FunctionIndex % 2 ? Int32 : Void, {OtherClassPointer, FName, Float}, Class);
+            Source.AddVirtualFunction(Class, "Function" + std::to_string(FunctionIndex), FunctionType, FunctionIndex * 8);
+        }
+        Classes.push_back(Class);
+    }
+    return Classes;
+}
+
+///Generates the layouts and the header sections of all of the classes, without touching the disk. Returns the total size of the sections
+static size_t GenerateAllLayouts(const FMemorySymbolSource& Source, const std::vector<FSymbolHandle>& Classes, bool bInParallel) {
+    std::vector<std::string> Sections(Classes.size());
+    const auto GenerateLayout = [&](size_t ClassIndex) {
+        FUserDefinedTypeLayout TypeLayout{};
+        GenerateUserDefinedTypeLayout(Source, Classes[ClassIndex], TypeLayout);
+        Sections[ClassIndex] = GenerateTypeLayoutSection(TypeLayout, nullptr);
+    };
+    if (bInParallel) {
+        ParallelFor(Classes.size(), GenerateLayout);
+    } else {
+        for (size_t ClassIndex = 0; ClassIndex < Classes.size(); ClassIndex++) {
+            GenerateLayout(ClassIndex);
+        }
+    }
+    size_t TotalSize = 0;
+    for (const std::string& Section : Sections) {
+        TotalSize += Section.size();
+    }
+    return TotalSize;
+}
+
+int main() {
+    std::vector<FSymbolHandle> Classes;
+    FMemorySymbolSource SerialSource;
+    FMemorySymbolSource ParallelSource;
+    Classes = AddSyntheticTypes(SerialSource);
+    AddSyntheticTypes(ParallelSource);
+
+    ///Memory source is read only once built, so it can be queried from the pool. Each run starts from a cold declaration cache
+    const auto RunBenchmark = [&](const char* RunName, const FMemorySymbolSource& Source, bool bInParallel) {
+        const auto StartTime = std::chrono::steady_clock::now();
+        const size_t TotalSize = GenerateAllLayouts(Source, Classes, bInParallel);
+        const double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+        std::printf("%-24s %6d types %8.1f ms %10.0f types/s %8.1f MB/s\n", RunName, NumClasses, Seconds * 1000.0, NumClasses / Seconds, TotalSize / Seconds / (1024.0 * 1024.0));
+    };
+    RunBenchmark("cold cache, serial", SerialSource, false);
+    RunBenchmark("warm cache, serial", SerialSource, false);
+    RunBenchmark("cold cache, parallel", ParallelSource, true);
+    RunBenchmark("warm cache, parallel", ParallelSource, true);
+    return 0;
+}
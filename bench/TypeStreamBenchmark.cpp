@@ -0,0 +1,89 @@
+#include "PDBTestFile.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+///Number of the synthetic type records, about the size of the TPI stream of a large game PDB
+static constexpr uint32_t NumTypeRecords = 2000000;
+///MSVC starts a new IndexOffsetBuffer entry every 8KB of the records, which with the record sizes below is every ~240 records
+static constexpr uint32_t RecordsPerChunk = 240;
+static constexpr int32_t NumRuns = 5;
+
+///Records of the typical sizes of the pointers, modifiers, argument lists and small field lists
+static std::vector<std::string> MakeSyntheticRecords() {
+    std::vector<std::string> Records;
+    Records.reserve(NumTypeRecords);
+    for (uint32_t RecordIndex = 0; RecordIndex < NumTypeRecords; RecordIndex++) {
+        const std::string Payload((RecordIndex % 8) * 8 + 4, '\0');
+        Records.push_back(MakeTypeRecord(RecordIndex % 2 ? ELeafKind::Pointer : ELeafKind::FieldList, Payload));
+    }
+    return Records;
+}
+
+///Opens a fresh type stream for every run, since the chunks are only ever decoded once. Returns the fastest of the runs in milliseconds
+template<typename FIndexFunction>
+static double MeasureFastestRun(const FMSFFile& MSFFile, FIndexFunction IndexFunction) {
+    double FastestMilliseconds = 0.0;
+    for (int32_t RunIndex = 0; RunIndex < NumRuns; RunIndex++) {
+        FPDBTypeStream TypeStream;
+        if (!TypeStream.Open(MSFFile, EPDBFixedStream::TPI, FDumpLog{})) {
+            return 0.0;
+        }
+        const auto StartTime = std::chrono::steady_clock::now();
+        if (!IndexFunction(TypeStream)) {
+            std::printf("Synthetic type stream failed to decode\n");
+            return 0.0;
+        }
+        const double Milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - StartTime).count();
+        FastestMilliseconds = RunIndex == 0 ? Milliseconds : std::min(FastestMilliseconds, Milliseconds);
+    }
+    return FastestMilliseconds;
+}
+
+static void RunBenchmarks(const std::filesystem::path& FilePath) {
+    FMSFFile MSFFile;
+    if (!MSFFile.Open(FilePath, FDumpLog{})) {
+        return;
+    }
+
+    ///Baseline is the lazy path on the calling thread alone: every chunk is decoded the first time one of its records is asked for
+    const double SerialMilliseconds = MeasureFastestRun(MSFFile, [](const FPDBTypeStream& TypeStream) {
+        for (uint32_t TypeIndex = TypeStream.GetTypeIndexBegin(); TypeIndex < TypeStream.GetTypeIndexEnd(); TypeIndex++) {
+            if (!TypeStream.GetRecord(TypeIndex).IsValid()) {
+                return false;
+            }
+        }
+        return true;
+    });
+    std::printf("%u records in %zu bytes, %u records per chunk, %u hardware threads\n", NumTypeRecords, static_cast<size_t>(std::filesystem::file_size(FilePath)),
+        RecordsPerChunk, std::thread::hardware_concurrency());
+    std::printf("%-34s %8.2f ms\n", "1 thread, lazy GetRecord walk", SerialMilliseconds);
+
+    ///The thread waiting for BuildFullIndex decodes the chunks too, so a pool of N workers decodes on up to N + 1 threads
+    std::vector<size_t> PoolSizes{1, 2, 4};
+    if (std::thread::hardware_concurrency() > PoolSizes.back()) {
+        PoolSizes.push_back(std::thread::hardware_concurrency());
+    }
+    for (const size_t NumWorkers : PoolSizes) {
+        FThreadPool ThreadPool{NumWorkers};
+        const double Milliseconds = MeasureFastestRun(MSFFile, [&](const FPDBTypeStream& TypeStream) {
+            return TypeStream.BuildFullIndex(ThreadPool);
+        });
+        const std::string RunName = "BuildFullIndex, pool of " + std::to_string(NumWorkers) + " + caller";
+        std::printf("%-34s %8.2f ms %6.2fx\n", RunName.c_str(), Milliseconds, SerialMilliseconds / Milliseconds);
+    }
+}
+
+int main() {
+    const std::filesystem::path FilePath = std::filesystem::temp_directory_path() / "UVTDTypeStreamBenchmark.pdb";
+    if (!WriteTestTypeStreamFile(FilePath, MakeSyntheticRecords(), RecordsPerChunk)) {
+        std::printf("Failed to write the synthetic PDB file %s\n", FilePath.string().c_str());
+        return 1;
+    }
+    ///File has to be unmapped before it can be removed on Windows
+    RunBenchmarks(FilePath);
+    std::filesystem::remove(FilePath);
+    return 0;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * Dedicated thread writing out the generated files, so generating them never waits for the disk
+ * Finished buffers are queued together with the callback to run once they have been written. The queue is bounded by the total size of the buffers
+ * queued and being written: when it is full, queueing another file blocks until the writer catches up, so the whole output never piles up in memory
+ * On Linux the queued files are written in batches through io_uring, with a single submission for the whole batch. Where io_uring is not available,
+ * on the other platforms or when the kernel or the sandbox does not allow it, the writer thread writes the files one by one with the blocking writes instead
+ * Either way the contents go into a temporary file next to the file, which replaces the file only once it has been written in full
+ */
+class FAsyncFileWriter {
+public:
+    ///Called on the writer thread once the file has been written, or once writing it has failed
+    using FWriteCompletion = std::function<void(bool bSucceeded)>;
+private:
+    struct FQueuedFile {
+        std::filesystem::path FilePath;
+        std::string Contents;
+        FWriteCompletion OnCompleted;
+    };
+    std::deque<FQueuedFile> QueuedFiles;
+    size_t NumQueuedBytes{0};
+    size_t MaxQueuedBytes;
+    std::mutex QueueMutex;
+    std::condition_variable QueueNotEmptyCondition;
+    std::condition_variable QueueNotFullCondition;
+    bool bShuttingDown{false};
+    std::thread WriterThread;
+public:
+    explicit FAsyncFileWriter(size_t InMaxQueuedBytes);
+    ~FAsyncFileWriter();
+
+    FAsyncFileWriter(const FAsyncFileWriter&) = delete;
+    FAsyncFileWriter& operator=(const FAsyncFileWriter&) = delete;
+
+    ///Returns the shared writer, allowing up to 64 MB of the generated files to be queued at once
+    static FAsyncFileWriter& Get();
+
+    ///Queues the file to be created or replaced with the given contents. Blocks while the queue is full, unless it is empty,
+    ///so a single file larger than the whole queue is still accepted
+    void WriteFile(std::filesystem::path FilePath, std::string Contents, FWriteCompletion OnCompleted);
+private:
+    void WriterMain();
+};
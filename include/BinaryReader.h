@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+///Bounds checked little endian reader over a byte view. It never copies the underlying data,
+///strings are returned as views into the original buffer
+class FBinaryReader {
+private:
+    std::span<const uint8_t> Data;
+    size_t Position;
+public:
+    FBinaryReader() : Position(0) {}
+    explicit FBinaryReader(std::span<const uint8_t> InData, size_t InPosition = 0) : Data(InData), Position(InPosition) {}
+
+    inline size_t GetPosition() const {
+        return Position;
+    }
+
+    inline size_t GetRemaining() const {
+        return Position < Data.size() ? Data.size() - Position : 0;
+    }
+
+    inline bool IsAtEnd() const {
+        return Position >= Data.size();
+    }
+
+    inline std::span<const uint8_t> GetData() const {
+        return Data;
+    }
+
+    inline bool Seek(size_t NewPosition) {
+        if (NewPosition > Data.size()) {
+            return false;
+        }
+        Position = NewPosition;
+        return true;
+    }
+
+    inline bool Skip(size_t NumBytes) {
+        if (NumBytes > GetRemaining()) {
+            return false;
+        }
+        Position += NumBytes;
+        return true;
+    }
+
+    ///Aligns the current position to the given power of two, clamping it to the end of the buffer
+    inline void AlignTo(size_t Alignment) {
+        size_t AlignedPosition = (Position + Alignment - 1) & ~(Alignment - 1);
+        Position = AlignedPosition < Data.size() ? AlignedPosition : Data.size();
+    }
+
+    template<typename T>
+    inline bool Read(T& OutValue) {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be read from the binary stream");
+        if (sizeof(T) > GetRemaining()) {
+            return false;
+        }
+        ///PDB and DWARF data is never guaranteed to be aligned, so we always go through memcpy
+        memcpy(&OutValue, Data.data() + Position, sizeof(T));
+        Position += sizeof(T);
+        return true;
+    }
+
+    inline bool ReadBytes(size_t NumBytes, std::span<const uint8_t>& OutBytes) {
+        if (NumBytes > GetRemaining()) {
+            return false;
+        }
+        OutBytes = Data.subspan(Position, NumBytes);
+        Position += NumBytes;
+        return true;
+    }
+
+    ///Reads an unsigned LEB128 variable length integer, as used throughout DWARF. Bits past the 64th are dropped
+    inline bool ReadULEB128(uint64_t& OutValue) {
+        uint64_t Result = 0;
+        for (uint32_t Shift = 0; Position < Data.size(); Shift += 7) {
+            const uint8_t Byte = Data[Position++];
+            if (Shift < 64) {
+                Result |= static_cast<uint64_t>(Byte & 0x7F) << Shift;
+            }
+            if ((Byte & 0x80) == 0) {
+                OutValue = Result;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    ///Reads a signed LEB128 variable length integer
+    inline bool ReadSLEB128(int64_t& OutValue) {
+        uint64_t Result = 0;
+        for (uint32_t Shift = 0; Position < Data.size();) {
+            const uint8_t Byte = Data[Position++];
+            if (Shift < 64) {
+                Result |= static_cast<uint64_t>(Byte & 0x7F) << Shift;
+            }
+            Shift += 7;
+            if ((Byte & 0x80) == 0) {
+                ///Sign extend the value from the last bit that has been read
+                if (Shift < 64 && (Byte & 0x40) != 0) {
+                    Result |= ~0ull << Shift;
+                }
+                OutValue = static_cast<int64_t>(Result);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    ///Reads a null terminated string. The terminator is consumed but not included into the view
+    inline bool ReadCString(std::string_view& OutString) {
+        const size_t Remaining = GetRemaining();
+        const auto* StringStart = reinterpret_cast<const char*>(Data.data() + Position);
+        const void* Terminator = Remaining ? memchr(StringStart, 0, Remaining) : nullptr;
+        if (Terminator == nullptr) {
+            return false;
+        }
+        const size_t StringLength = static_cast<const char*>(Terminator) - StringStart;
+        OutString = std::string_view{StringStart, StringLength};
+        Position += StringLength + 1;
+        return true;
+    }
+};
+
+///Reads a value of the given type at the given offset of the buffer without bounds checking
+///Callers are expected to have validated the size of the buffer beforehand
+template<typename T>
+inline T ReadUnaligned(const uint8_t* Data) {
+    T Result;
+    memcpy(&Result, Data, sizeof(T));
+    return Result;
+}
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+///CodeView leaf kinds of the type records we are interested in. Values match LEAF_ENUM_e from cvinfo.h
+enum class ELeafKind : uint16_t {
+    VTableShape = 0x000a,
+    Modifier = 0x1001,
+    Pointer = 0x1002,
+    Procedure = 0x1008,
+    MemberFunction = 0x1009,
+    ArgumentList = 0x1201,
+    FieldList = 0x1203,
+    BitField = 0x1205,
+    MethodList = 0x1206,
+    BaseClass = 0x1400,
+    VirtualBaseClass = 0x1401,
+    IndirectVirtualBaseClass = 0x1402,
+    Index = 0x1404,
+    VirtualFunctionTable = 0x1409,
+    Enumerate = 0x1502,
+    Array = 0x1503,
+    Class = 0x1504,
+    Structure = 0x1505,
+    Union = 0x1506,
+    Enum = 0x1507,
+    Member = 0x150d,
+    StaticMember = 0x150e,
+    Method = 0x150f,
+    NestedType = 0x1510,
+    OneMethod = 0x1511,
+    Interface = 0x1519,
+    FunctionId = 0x1601,
+    MemberFunctionId = 0x1602,
+    BuildInfo = 0x1603,
+    SubstringList = 0x1604,
+    StringId = 0x1605,
+    UDTSourceLine = 0x1606,
+    UDTModuleSourceLine = 0x1607,
+};
+
+///Numeric leaves used to encode integers that do not fit into the 16-bit inline value
+enum class ENumericLeaf : uint16_t {
+    Char = 0x8000,
+    Short = 0x8001,
+    UShort = 0x8002,
+    Long = 0x8003,
+    ULong = 0x8004,
+    Quadword = 0x8009,
+    UQuadword = 0x800a,
+};
+
+///CV_prop_t flags of the class, structure, union and enum records
+enum EClassOptions : uint16_t {
+    CO_Packed = 0x0001,
+    CO_HasConstructorOrDestructor = 0x0002,
+    CO_HasOverloadedOperator = 0x0004,
+    CO_Nested = 0x0008,
+    CO_ContainsNestedClass = 0x0010,
+    CO_HasOverloadedAssignmentOperator = 0x0020,
+    CO_HasConversionOperator = 0x0040,
+    CO_ForwardReference = 0x0080,
+    CO_Scoped = 0x0100,
+    CO_HasUniqueName = 0x0200,
+    CO_Sealed = 0x0400,
+};
+
+///CV_modifier_t flags of the LF_MODIFIER record
+enum EModifierOptions : uint16_t {
+    MO_Const = 0x0001,
+    MO_Volatile = 0x0002,
+    MO_Unaligned = 0x0004,
+};
+
+///Pointer modes stored in the bits 5-7 of the LF_POINTER attributes
+enum class EPointerMode : uint8_t {
+    Pointer = 0,
+    LValueReference = 1,
+    PointerToDataMember = 2,
+    PointerToMemberFunction = 3,
+    RValueReference = 4,
+};
+
+///Type indices below this value are not backed by a record and describe a built-in type instead
+constexpr uint32_t FirstNonSimpleTypeIndex = 0x1000;
+
+inline bool IsSimpleTypeIndex(uint32_t TypeIndex) {
+    return TypeIndex < FirstNonSimpleTypeIndex;
+}
+
+///A single type record, as a view into the type stream. Data starts right after the leaf kind
+struct FTypeRecord {
+    ELeafKind Kind{};
+    std::span<const uint8_t> Data{};
+
+    inline bool IsValid() const {
+        return Data.data() != nullptr;
+    }
+};
+
+struct FModifierRecord {
+    uint32_t ModifiedType{0};
+    uint16_t Modifiers{0};
+};
+
+struct FPointerRecord {
+    uint32_t ReferentType{0};
+    uint32_t Attributes{0};
+    uint32_t ContainingClass{0};
+
+    inline EPointerMode GetMode() const {
+        return static_cast<EPointerMode>((Attributes >> 5) & 0x7);
+    }
+    inline bool IsConst() const {
+        return (Attributes & (1 << 10)) != 0;
+    }
+    inline bool IsVolatile() const {
+        return (Attributes & (1 << 9)) != 0;
+    }
+    inline uint32_t GetSize() const {
+        return (Attributes >> 13) & 0x3f;
+    }
+};
+
+struct FProcedureRecord {
+    uint32_t ReturnType{0};
+    uint32_t ClassType{0};
+    uint32_t ThisType{0};
+    uint8_t CallingConvention{0};
+    uint8_t Options{0};
+    uint16_t ParameterCount{0};
+    uint32_t ArgumentList{0};
+    int32_t ThisAdjustment{0};
+};
+
+struct FArgumentListRecord {
+    uint32_t ArgumentCount{0};
+    std::span<const uint8_t> ArgumentTypes{};
+
+    inline uint32_t GetArgumentType(uint32_t ArgumentIndex) const {
+        uint32_t ArgumentType;
+        memcpy(&ArgumentType, ArgumentTypes.data() + ArgumentIndex * sizeof(uint32_t), sizeof(uint32_t));
+        return ArgumentType;
+    }
+};
+
+struct FArrayRecord {
+    uint32_t ElementType{0};
+    uint32_t IndexType{0};
+    uint64_t Size{0};
+    std::string_view Name{};
+};
+
+///Shared representation of LF_CLASS, LF_STRUCTURE, LF_INTERFACE, LF_UNION and LF_ENUM records
+struct FTagRecord {
+    ELeafKind Kind{};
+    uint16_t MemberCount{0};
+    uint16_t Options{0};
+    uint32_t FieldList{0};
+    uint32_t DerivedFrom{0};
+    uint32_t VTableShape{0};
+    uint32_t UnderlyingType{0};
+    uint64_t Size{0};
+    std::string_view Name{};
+    std::string_view UniqueName{};
+
+    inline bool IsForwardReference() const {
+        return (Options & CO_ForwardReference) != 0;
+    }
+};
+
+struct FBitFieldRecord {
+    uint32_t Type{0};
+    uint8_t BitLength{0};
+    uint8_t BitPosition{0};
+};
+
+///Shared representation of the LF_UDT_SRC_LINE and LF_UDT_MOD_SRC_LINE records of the IPI stream
+///For LF_UDT_SRC_LINE the source file is the index of a LF_STRING_ID record, for LF_UDT_MOD_SRC_LINE it is an offset into the /names stream
+struct FUDTSourceLineRecord {
+    uint32_t UDT{0};
+    uint32_t SourceFile{0};
+    uint32_t LineNumber{0};
+    uint16_t Module{0};
+};
+
+struct FStringIdRecord {
+    uint32_t SubstringList{0};
+    std::string_view String{};
+};
+
+///Decodes a numeric leaf, which is either an inline 16-bit value or a leaf kind followed by a wider value
+///Signed values are sign extended into the unsigned result. Returns false on unsupported leaf kinds
+bool ReadNumericLeaf(std::span<const uint8_t> Data, size_t& InOutPosition, uint64_t& OutValue);
+
+bool IsTagRecordKind(ELeafKind Kind);
+
+bool DecodeModifierRecord(const FTypeRecord& Record, FModifierRecord& OutRecord);
+bool DecodePointerRecord(const FTypeRecord& Record, FPointerRecord& OutRecord);
+bool DecodeProcedureRecord(const FTypeRecord& Record, FProcedureRecord& OutRecord);
+bool DecodeArgumentListRecord(const FTypeRecord& Record, FArgumentListRecord& OutRecord);
+bool DecodeArrayRecord(const FTypeRecord& Record, FArrayRecord& OutRecord);
+bool DecodeTagRecord(const FTypeRecord& Record, FTagRecord& OutRecord);
+bool DecodeBitFieldRecord(const FTypeRecord& Record, FBitFieldRecord& OutRecord);
+bool DecodeVTableShapeRecord(const FTypeRecord& Record, uint16_t& OutEntryCount);
+bool DecodeUDTSourceLineRecord(const FTypeRecord& Record, FUDTSourceLineRecord& OutRecord);
+bool DecodeStringIdRecord(const FTypeRecord& Record, FStringIdRecord& OutRecord);
+
+///CodeView symbol kinds of the symbol records we are interested in. Values match SYM_ENUM_e from cvinfo.h
+enum class ESymbolKind : uint16_t {
+    End = 0x0006,
+    Constant = 0x1107,
+    UserDefinedType = 0x1108,
+    LocalData = 0x110c,
+    GlobalData = 0x110d,
+    PublicSymbol = 0x110e,
+    LocalProcedure = 0x110f,
+    GlobalProcedure = 0x1110,
+    ProcedureReference = 0x1125,
+    LocalProcedureReference = 0x1127,
+};
+
+///CV_PUBSYMFLAGS of the S_PUB32 records
+enum EPublicSymbolFlags : uint32_t {
+    PSF_Code = 0x1,
+    PSF_Function = 0x2,
+    PSF_Managed = 0x4,
+    PSF_MSIL = 0x8,
+};
+
+///A raw symbol record. Data covers the record contents following the kind field, up to the end of the record
+struct FSymbolRecord {
+    ESymbolKind Kind{};
+    std::span<const uint8_t> Data{};
+};
+
+///Shared representation of the S_GPROC32 and S_LPROC32 records
+struct FProcedureSymbol {
+    uint32_t Parent{0};
+    uint32_t End{0};
+    uint32_t Next{0};
+    uint32_t CodeSize{0};
+    uint32_t DebugStart{0};
+    uint32_t DebugEnd{0};
+    uint32_t FunctionType{0};
+    uint32_t Offset{0};
+    uint16_t Section{0};
+    uint8_t Flags{0};
+    std::string_view Name{};
+};
+
+struct FPublicSymbol {
+    uint32_t Flags{0};
+    uint32_t Offset{0};
+    uint16_t Section{0};
+    std::string_view Name{};
+};
+
+///Reads the symbol record starting at the given position of the symbol stream, and advances the position past it
+///Returns false at the end of the data, or if the record does not fit into the data
+bool ReadSymbolRecord(std::span<const uint8_t> Data, size_t& InOutPosition, FSymbolRecord& OutRecord);
+
+///Returns the name of the symbols that can be referenced from the global and public symbol hash tables
+bool GetSymbolName(const FSymbolRecord& Record, std::string_view& OutName);
+
+bool DecodeProcedureSymbol(const FSymbolRecord& Record, FProcedureSymbol& OutSymbol);
+bool DecodePublicSymbol(const FSymbolRecord& Record, FPublicSymbol& OutSymbol);
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+///128-bit hash of the contents of a generated file
+struct FContentHash {
+    uint64_t Low{0};
+    uint64_t High{0};
+
+    bool operator==(const FContentHash& Other) const = default;
+};
+
+inline uint64_t RotateLeft64(uint64_t Value, int32_t Shift) {
+    return (Value << Shift) | (Value >> (64 - Shift));
+}
+
+inline uint64_t MixFinal64(uint64_t Value) {
+    Value ^= Value >> 33;
+    Value *= 0xFF51AFD7ED558CCDull;
+    Value ^= Value >> 33;
+    Value *= 0xC4CEB9FE1A85EC53ull;
+    Value ^= Value >> 33;
+    return Value;
+}
+
+///MurmurHash3 x64 128-bit variant with a zero seed. Not cryptographic, only used to tell whether the generated file has changed since the last run
+inline FContentHash HashContents(std::string_view Contents) {
+    constexpr uint64_t C1 = 0x87C37B91114253D5ull;
+    constexpr uint64_t C2 = 0x4CF5AD432745937Full;
+    const auto* Data = reinterpret_cast<const uint8_t*>(Contents.data());
+    const size_t NumBlocks = Contents.size() / 16;
+    uint64_t H1 = 0;
+    uint64_t H2 = 0;
+
+    for (size_t i = 0; i < NumBlocks; i++) {
+        uint64_t K1;
+        uint64_t K2;
+        std::memcpy(&K1, Data + i * 16, sizeof(K1));
+        std::memcpy(&K2, Data + i * 16 + 8, sizeof(K2));
+
+        K1 *= C1; K1 = RotateLeft64(K1, 31); K1 *= C2; H1 ^= K1;
+        H1 = RotateLeft64(H1, 27); H1 += H2; H1 = H1 * 5 + 0x52DCE729;
+        K2 *= C2; K2 = RotateLeft64(K2, 33); K2 *= C1; H2 ^= K2;
+        H2 = RotateLeft64(H2, 31); H2 += H1; H2 = H2 * 5 + 0x38495AB5;
+    }
+
+    ///Up to 15 bytes left, the first 8 go into K1 and the rest into K2, both little endian
+    const uint8_t* Tail = Data + NumBlocks * 16;
+    const size_t TailSize = Contents.size() & 15;
+    uint64_t K1 = 0;
+    uint64_t K2 = 0;
+    for (size_t i = TailSize; i > 8; i--) {
+        K2 ^= static_cast<uint64_t>(Tail[i - 1]) << ((i - 9) * 8);
+    }
+    for (size_t i = TailSize < 8 ? TailSize : 8; i > 0; i--) {
+        K1 ^= static_cast<uint64_t>(Tail[i - 1]) << ((i - 1) * 8);
+    }
+    if (TailSize > 8) {
+        K2 *= C2; K2 = RotateLeft64(K2, 33); K2 *= C1; H2 ^= K2;
+    }
+    if (TailSize > 0) {
+        K1 *= C1; K1 = RotateLeft64(K1, 31); K1 *= C2; H1 ^= K1;
+    }
+
+    H1 ^= Contents.size();
+    H2 ^= Contents.size();
+    H1 += H2;
+    H2 += H1;
+    H1 = MixFinal64(H1);
+    H2 = MixFinal64(H2);
+    H1 += H2;
+    H2 += H1;
+    return FContentHash{H1, H2};
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "SymbolSource.h"
+#include <Windows.h>
+#include <atlbase.h>
+#include <dia2.h>
+
+/**
+ * Symbol source backed by the DIA SDK
+ * Handles are the DIA symbol index ids, which stay stable for the lifetime of the session,
+ * so the symbols are looked up again through the session whenever their properties are requested
+ * DIA works with the wide strings, so the names and paths are converted to and from UTF-8 here, and nowhere else
+ */
+class FDiaSymbolSource final : public ISymbolSource {
+private:
+    CComPtr<IDiaSession> Session;
+    CComPtr<IDiaSymbol> GlobalScope;
+public:
+    FDiaSymbolSource(const CComPtr<IDiaSession>& InSession, const CComPtr<IDiaSymbol>& InGlobalScope);
+
+    FSymbolHandle FindUserDefinedType(const std::string& TypeName) const override;
+    bool GetSymbolInfo(FSymbolHandle Symbol, FSymbolInfo& OutInfo) const override;
+    std::string GetSymbolName(FSymbolHandle Symbol) const override;
+    void GetChildren(FSymbolHandle Symbol, ESymbolTag ChildTag, std::vector<FSymbolHandle>& OutChildren) const override;
+    bool GetSourceLine(FSymbolHandle Symbol, std::string& OutSourceFilePath, int32_t& OutLineNumber) const override;
+private:
+    CComPtr<IDiaSymbol> GetSymbol(FSymbolHandle Symbol) const;
+    static FSymbolHandle MakeHandle(const CComPtr<IDiaSymbol>& Symbol);
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <filesystem>
+#include <mutex>
+#include <string>
+
+/**
+ * Progress output of the dump of a single debug file
+ * When several files are dumped at the same time, every line is prefixed with the name of its file, and written out
+ * as a whole under a lock shared by all of the files, so the lines of the different files do not interleave
+ * The readers of the debug files report their diagnostics through the log of the file too, so those lines carry the same prefix
+ */
+class FDumpLog {
+private:
+    std::wstring Prefix;
+    static std::mutex OutputLock;
+public:
+    ///Log without the prefix, for the code opening the debug files outside of a dump
+    FDumpLog() = default;
+    FDumpLog(const std::filesystem::path& DebugFilePath, bool bIsLabelled);
+
+    void Info(const std::wstring& Message) const;
+    void Error(const std::wstring& Message) const;
+};
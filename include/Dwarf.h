@@ -0,0 +1,296 @@
+#pragma once
+
+#include "BinaryReader.h"
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+///DWARF tags of the debugging information entries we are interested in. Values match DW_TAG_* from the DWARF 5 specification
+enum class EDwarfTag : uint16_t {
+    Null = 0x00,
+    ArrayType = 0x01,
+    ClassType = 0x02,
+    EnumerationType = 0x04,
+    FormalParameter = 0x05,
+    Member = 0x0d,
+    PointerType = 0x0f,
+    ReferenceType = 0x10,
+    CompileUnit = 0x11,
+    StructureType = 0x13,
+    SubroutineType = 0x15,
+    Typedef = 0x16,
+    UnionType = 0x17,
+    Inheritance = 0x1c,
+    PtrToMemberType = 0x1f,
+    SubrangeType = 0x21,
+    BaseType = 0x24,
+    ConstType = 0x26,
+    Enumerator = 0x28,
+    Subprogram = 0x2e,
+    Variable = 0x34,
+    VolatileType = 0x35,
+    RestrictType = 0x37,
+    InterfaceType = 0x38,
+    Namespace = 0x39,
+    UnspecifiedType = 0x3b,
+    PartialUnit = 0x3c,
+    TypeUnit = 0x41,
+    RValueReferenceType = 0x42,
+    AtomicType = 0x47,
+    SkeletonUnit = 0x4a,
+};
+
+///DWARF attributes we are interested in. Values match DW_AT_* from the DWARF 5 specification
+enum class EDwarfAttribute : uint16_t {
+    Sibling = 0x01,
+    Name = 0x03,
+    ByteSize = 0x0b,
+    BitOffset = 0x0c,
+    BitSize = 0x0d,
+    StmtList = 0x10,
+    CompDir = 0x1b,
+    ContainingType = 0x1d,
+    LowerBound = 0x22,
+    UpperBound = 0x2f,
+    Accessibility = 0x32,
+    Artificial = 0x34,
+    Count = 0x37,
+    DataMemberLocation = 0x38,
+    DeclFile = 0x3a,
+    DeclLine = 0x3b,
+    Declaration = 0x3c,
+    Encoding = 0x3e,
+    External = 0x3f,
+    Specification = 0x47,
+    Type = 0x49,
+    Virtuality = 0x4c,
+    VTableElemLocation = 0x4d,
+    ObjectPointer = 0x64,
+    Signature = 0x69,
+    DataBitOffset = 0x6b,
+    StrOffsetsBase = 0x72,
+    AddrBase = 0x73,
+    DwoName = 0x76,
+    GNUDwoName = 0x2130,
+    GNUDwoId = 0x2131,
+};
+
+///DWARF attribute forms. Values match DW_FORM_* from the DWARF 5 specification, plus the GNU extensions used by split DWARF and dwz
+enum class EDwarfForm : uint16_t {
+    Addr = 0x01,
+    Block2 = 0x03,
+    Block4 = 0x04,
+    Data2 = 0x05,
+    Data4 = 0x06,
+    Data8 = 0x07,
+    String = 0x08,
+    Block = 0x09,
+    Block1 = 0x0a,
+    Data1 = 0x0b,
+    Flag = 0x0c,
+    SData = 0x0d,
+    Strp = 0x0e,
+    UData = 0x0f,
+    RefAddr = 0x10,
+    Ref1 = 0x11,
+    Ref2 = 0x12,
+    Ref4 = 0x13,
+    Ref8 = 0x14,
+    RefUData = 0x15,
+    Indirect = 0x16,
+    SecOffset = 0x17,
+    ExprLoc = 0x18,
+    FlagPresent = 0x19,
+    Strx = 0x1a,
+    Addrx = 0x1b,
+    RefSup4 = 0x1c,
+    StrpSup = 0x1d,
+    Data16 = 0x1e,
+    LineStrp = 0x1f,
+    RefSig8 = 0x20,
+    ImplicitConst = 0x21,
+    LocListx = 0x22,
+    RngListx = 0x23,
+    RefSup8 = 0x24,
+    Strx1 = 0x25,
+    Strx2 = 0x26,
+    Strx3 = 0x27,
+    Strx4 = 0x28,
+    Addrx1 = 0x29,
+    Addrx2 = 0x2a,
+    Addrx3 = 0x2b,
+    Addrx4 = 0x2c,
+    GNUAddrIndex = 0x1f01,
+    GNUStrIndex = 0x1f02,
+    GNURefAlt = 0x1f20,
+    GNUStrpAlt = 0x1f21,
+};
+
+///Unit types of the DWARF 5 unit headers. Older units are always compile units
+enum class EDwarfUnitType : uint8_t {
+    Compile = 0x01,
+    Type = 0x02,
+    Partial = 0x03,
+    Skeleton = 0x04,
+    SplitCompile = 0x05,
+    SplitType = 0x06,
+};
+
+///Base type encodings, DW_ATE_*
+enum class EDwarfBaseTypeEncoding : uint8_t {
+    Address = 0x01,
+    Boolean = 0x02,
+    ComplexFloat = 0x03,
+    Float = 0x04,
+    Signed = 0x05,
+    SignedChar = 0x06,
+    Unsigned = 0x07,
+    UnsignedChar = 0x08,
+    UTF = 0x10,
+};
+
+///Values of DW_AT_accessibility
+enum class EDwarfAccessibility : uint8_t {
+    Public = 1,
+    Protected = 2,
+    Private = 3,
+};
+
+///Values of DW_AT_virtuality
+enum class EDwarfVirtuality : uint8_t {
+    None = 0,
+    Virtual = 1,
+    PureVirtual = 2,
+};
+
+///True for the tags of the class, structure, union and interface types
+inline bool IsDwarfUserDefinedTypeTag(EDwarfTag Tag) {
+    return Tag == EDwarfTag::ClassType || Tag == EDwarfTag::StructureType || Tag == EDwarfTag::UnionType || Tag == EDwarfTag::InterfaceType;
+}
+
+///Location expression opcodes used by the member locations and the virtual table slots
+constexpr uint8_t DwarfOpConstU = 0x10;
+constexpr uint8_t DwarfOpPlusUConst = 0x23;
+
+///Attribute specification of the abbreviation, in the order the values follow the abbreviation code in the entry
+struct FDwarfAttributeSpec {
+    EDwarfAttribute Attribute;
+    EDwarfForm Form;
+    ///Value of the DW_FORM_implicit_const attributes, which is stored in the abbreviation instead of the entry
+    int64_t ImplicitConst;
+};
+
+struct FDwarfAbbreviation {
+    uint64_t Code;
+    EDwarfTag Tag;
+    bool bHasChildren;
+    uint32_t FirstAttribute;
+    uint32_t NumAttributes;
+};
+
+/**
+ * Set of the abbreviations starting at the given offset of .debug_abbrev
+ * Decoded once and shared by all units referencing it, so reading an entry is a table lookup followed by the attribute values
+ * Compilers number the abbreviations sequentially from 1, so lookups normally index the table directly
+ */
+class FDwarfAbbreviationTable {
+private:
+    std::vector<FDwarfAbbreviation> Abbreviations;
+    std::vector<FDwarfAttributeSpec> AttributeSpecs;
+    ///Code of the first abbreviation when all codes are sequential, or 0 when the table has to be searched
+    uint64_t FirstSequentialCode{0};
+public:
+    bool Read(std::span<const uint8_t> AbbrevSection, uint64_t Offset);
+
+    ///Returns the abbreviation with the given code, or nullptr if the table does not contain it
+    const FDwarfAbbreviation* Find(uint64_t Code) const;
+
+    inline std::span<const FDwarfAttributeSpec> GetAttributeSpecs(const FDwarfAbbreviation& Abbreviation) const {
+        return std::span<const FDwarfAttributeSpec>{AttributeSpecs}.subspan(Abbreviation.FirstAttribute, Abbreviation.NumAttributes);
+    }
+};
+
+///Header of the unit in .debug_info. Offsets are absolute offsets in the section
+struct FDwarfUnitHeader {
+    uint64_t Offset{0};
+    uint64_t EndOffset{0};
+    uint64_t FirstDIEOffset{0};
+    uint64_t AbbrevOffset{0};
+    uint16_t Version{0};
+    EDwarfUnitType UnitType{EDwarfUnitType::Compile};
+    uint8_t AddressSize{0};
+    bool bIs64Bit{false};
+    ///Identifier shared by the skeleton unit and the split unit it refers to
+    uint64_t DwoId{0};
+    ///Signature the type units are referenced by, and the absolute offset of the type they describe
+    uint64_t TypeSignature{0};
+    uint64_t TypeOffset{0};
+
+    inline uint8_t GetOffsetSize() const {
+        return bIs64Bit ? 8 : 4;
+    }
+};
+
+///Reads the length field starting the units and the tables of the debug sections, which also tells whether they use the 64-bit DWARF format
+///Fails if the length does not fit into the rest of the data
+bool ReadDwarfInitialLength(FBinaryReader& Reader, bool& OutIs64Bit, uint64_t& OutLength);
+
+///Reads the section offset, which is 4 bytes long in the 32-bit DWARF format and 8 bytes long in the 64-bit one
+bool ReadDwarfOffset(FBinaryReader& Reader, bool bIs64Bit, uint64_t& OutOffset);
+
+///Reads the null terminated string at the given offset of the string section
+bool GetDwarfStringAtOffset(std::span<const uint8_t> Section, uint64_t Offset, std::string_view& OutString);
+
+///Reads the header of the unit starting at the given offset. Only DWARF versions 2 to 5 are supported
+bool ReadDwarfUnitHeader(std::span<const uint8_t> InfoSection, uint64_t Offset, FDwarfUnitHeader& OutHeader);
+
+/**
+ * Raw value of a single attribute
+ * Constants, flags, addresses and string/address indices are stored into Value, references are converted to absolute .debug_info offsets,
+ * blocks and expressions keep the view of their bytes, and inline strings keep the view of the characters
+ */
+struct FDwarfAttributeValue {
+    EDwarfForm Form{EDwarfForm::UData};
+    uint64_t Value{0};
+    std::span<const uint8_t> Block{};
+    std::string_view String{};
+
+    bool IsReference() const;
+    bool IsString() const;
+    bool IsSigned() const;
+};
+
+///Reads the value of the attribute with the given specification at the current position of the reader
+bool ReadDwarfAttributeValue(FBinaryReader& Reader, const FDwarfAttributeSpec& Spec, const FDwarfUnitHeader& Unit, FDwarfAttributeValue& OutValue);
+
+///Reads the value of the given form at the current position of the reader. Used for the entry formats of the DWARF 5 line table headers
+bool ReadDwarfFormValue(FBinaryReader& Reader, EDwarfForm Form, const FDwarfUnitHeader& Unit, FDwarfAttributeValue& OutValue);
+
+///String sections the string forms point into
+struct FDwarfStringSections {
+    std::span<const uint8_t> Str{};
+    std::span<const uint8_t> LineStr{};
+    std::span<const uint8_t> StrOffsets{};
+};
+
+///Resolves the value of the string attribute. StrOffsetsBase is the DW_AT_str_offsets_base of the unit, used by the indexed strings
+bool ResolveDwarfString(const FDwarfStringSections& Sections, const FDwarfUnitHeader& Unit, uint64_t StrOffsetsBase, const FDwarfAttributeValue& Value, std::string_view& OutString);
+
+///Contribution of a single split unit to the sections of the DWARF package file (.dwp), as listed by .debug_cu_index or .debug_tu_index
+///Offsets are relative to the start of the .dwo sections. The unit headers and the DW_AT_str_offsets_base values are relative to the contributions instead
+struct FDwarfPackageContribution {
+    ///DWO id of the compile unit, or the type signature of the type unit
+    uint64_t Signature{0};
+    ///False for the DWARF 4 type units, which contribute to .debug_types.dwo instead of .debug_info.dwo
+    bool bHasInfo{false};
+    uint64_t InfoOffset{0};
+    uint64_t AbbrevOffset{0};
+    uint64_t StrOffsetsOffset{0};
+};
+
+///Reads the unit index of the DWARF package file, both the version 2 GNU extension used with DWARF 4 and the DWARF 5 one
+bool ReadDwarfPackageIndex(std::span<const uint8_t> IndexSection, std::vector<FDwarfPackageContribution>& OutContributions);
+
+///Evaluates the simple location expressions used for the member offsets and the virtual table slots (DW_OP_constu, DW_OP_plus_uconst)
+bool EvaluateDwarfConstantExpression(std::span<const uint8_t> Expression, uint64_t& OutValue);
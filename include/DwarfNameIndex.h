@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Dwarf.h"
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+///Accelerator table the name index has been read from
+enum class EDwarfNameIndexKind : uint8_t {
+    None,
+    ///DWARF 5 .debug_names, listing every type under the last component of its name
+    DebugNames,
+    ///.gdb_index built by the linker (--gdb-index) or gdb-add-index, listing the types at the namespace scope under their qualified names
+    GdbIndex,
+    ///.debug_pubtypes or .debug_gnu_pubtypes emitted by the compiler with -gpubnames, listing the types at the namespace scope under their qualified names
+    PubTypes,
+};
+
+///Single name index of .debug_names. Linkers concatenate the per-object indices, so the section normally holds one of them per unit
+struct FDebugNamesTable {
+    bool bIs64Bit{false};
+    uint32_t NumBuckets{0};
+    uint32_t NumNames{0};
+    std::vector<uint64_t> CompileUnitOffsets;
+    std::vector<uint64_t> TypeUnitOffsets;
+    std::span<const uint8_t> Buckets;
+    std::span<const uint8_t> Hashes;
+    std::span<const uint8_t> StringOffsets;
+    std::span<const uint8_t> EntryOffsets;
+    std::span<const uint8_t> EntryPool;
+    ///Abbreviations of the entries, by code. Attribute specs hold the DW_IDX_* index attributes instead of the DW_AT_* ones
+    std::unordered_map<uint64_t, std::pair<EDwarfTag, std::vector<FDwarfAttributeSpec>>> Abbreviations;
+};
+
+/**
+ * Name lookup through the accelerator tables the compiler or the linker left in the file
+ * Answers which units may contain the definition of the type with the given name, so only these units have to be read
+ * instead of the whole .debug_info. The units then confirm the definition, since the tables may list the declarations
+ * and only .debug_names tells the type tags apart from the rest of the names
+ */
+class FDwarfNameIndex {
+private:
+    EDwarfNameIndexKind Kind{EDwarfNameIndexKind::None};
+    std::span<const uint8_t> StrSection;
+
+    std::vector<FDebugNamesTable> DebugNamesTables;
+
+    std::vector<uint64_t> GdbIndexUnitOffsets;
+    std::span<const uint8_t> GdbIndexSymbolTable;
+    std::span<const uint8_t> GdbIndexConstantPool;
+
+    ///Units listing the type in their pubtypes set, by the qualified name of the type
+    std::unordered_map<std::string_view, std::vector<uint64_t>> PubTypeUnitOffsets;
+
+    ///Sorted offsets of the units the index has been built for
+    std::vector<uint64_t> CoveredUnitOffsets;
+public:
+    bool ReadDebugNames(std::span<const uint8_t> DebugNamesSection, std::span<const uint8_t> InStrSection);
+    bool ReadGdbIndex(std::span<const uint8_t> GdbIndexSection);
+    bool ReadPubTypes(std::span<const uint8_t> PubTypesSection, bool bIsGnuPubTypes);
+
+    inline EDwarfNameIndexKind GetKind() const {
+        return Kind;
+    }
+
+    ///True if the index covers the unit starting at the given offset, that is the types it defines can be found through the index
+    bool CoversUnit(uint64_t UnitOffset) const;
+
+    /**
+     * Appends the offsets of the units that may define the user defined type with the given fully qualified name
+     * Types the table does not list are looked up through their enclosing scopes, so the nested classes come from the units of their outer class
+     */
+    void FindTypeUnits(std::string_view QualifiedName, std::vector<uint64_t>& OutUnitOffsets) const;
+private:
+    ///Looks up the single name in the form the table stores it
+    void FindNamedTypeUnits(std::string_view QualifiedName, std::vector<uint64_t>& OutUnitOffsets) const;
+    void FindDebugNamesTypeUnits(const FDebugNamesTable& Table, std::string_view Name, std::vector<uint64_t>& OutUnitOffsets) const;
+    void FindGdbIndexTypeUnits(std::string_view QualifiedName, std::vector<uint64_t>& OutUnitOffsets) const;
+};
+
+///Returns the last component of the qualified name, e.g. FVector for UE::Core::FVector. Separators inside the template arguments are skipped
+std::string_view GetDwarfUnqualifiedName(std::string_view QualifiedName);
+
+///Returns the qualified name of the scope enclosing the named entry, e.g. UE::Core for UE::Core::FVector, or an empty string at the global scope
+std::string_view GetDwarfEnclosingScopeName(std::string_view QualifiedName);
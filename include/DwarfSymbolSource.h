@@ -0,0 +1,191 @@
+#pragma once
+
+#include "SymbolSource.h"
+#include "Dwarf.h"
+#include "DwarfNameIndex.h"
+#include "ELFFile.h"
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+///Entry of the flattened tree of the unit. Entries are stored in the order they appear in the section, which is also the depth-first order
+struct FDwarfEntry {
+    uint64_t Offset{0};
+    uint64_t AttributesOffset{0};
+    const FDwarfAbbreviation* Abbreviation{nullptr};
+    uint32_t ParentIndex{0};
+    uint32_t NextSiblingIndex{0};
+};
+
+///Directories and files listed by the line table header of the unit, which the DW_AT_decl_file attributes index into
+struct FDwarfLineTableFiles {
+    std::vector<std::string_view> Directories{};
+    ///Name of each file and the index of its directory
+    std::vector<std::pair<std::string_view, uint64_t>> Files{};
+    ///Index of the first file, 0 in DWARF 5 and 1 in the older versions
+    uint64_t FirstFileIndex{0};
+};
+
+///Debug sections the units are read from. Split units are read from the .dwo sections of the package file, everything else from the file itself
+struct FDwarfUnitSections {
+    std::span<const uint8_t> Info{};
+    std::span<const uint8_t> Abbrev{};
+    FDwarfStringSections Strings{};
+    ///Added to the section offsets of the entries, so the entries of the file and of its package file get distinct offsets in the handles and the lookups
+    uint64_t BaseOffset{0};
+    std::unordered_map<uint64_t, std::unique_ptr<FDwarfAbbreviationTable>> AbbreviationTables{};
+};
+
+///Compile unit of .debug_info, together with the properties of its root entry the rest of the entries depend on
+///Header offsets are relative to the section of the unit, the entry offsets handed out are shifted by the base offset of the section
+struct FDwarfUnit {
+    FDwarfUnitHeader Header{};
+    const FDwarfUnitSections* Sections{nullptr};
+    const FDwarfAbbreviationTable* Abbreviations{nullptr};
+    uint64_t StrOffsetsBase{0};
+    uint64_t StmtList{0};
+    bool bHasStmtList{false};
+    std::string_view CompilationDirectory{};
+    ///Offset the accelerator tables list the unit under. Split units are listed under the offset of their skeleton unit
+    uint64_t NameIndexOffset{0};
+    ///Entry tree of the unit, built the first time an entry of the unit is looked at
+    mutable std::unique_ptr<std::vector<FDwarfEntry>> Entries{};
+    ///Files of the line table header, read the first time a source line of the unit is looked up. Null when the unit has no readable line table
+    mutable std::unique_ptr<FDwarfLineTableFiles> LineTableFiles{};
+
+    inline uint64_t GetOffset() const {
+        return Sections->BaseOffset + Header.Offset;
+    }
+    inline uint64_t GetEndOffset() const {
+        return Sections->BaseOffset + Header.EndOffset;
+    }
+};
+
+///Definition of the class found by the index pass. Byte size and member signature tell the identical copies emitted by every unit apart from the conflicting definitions
+struct FDwarfTypeDefinition {
+    uint64_t Offset{0};
+    uint64_t ByteSize{0};
+    uint64_t MemberSignature{0};
+};
+
+class FDwarfTypeDefinitionMap;
+
+///Debug section to read, and the view to point at its data
+struct FDwarfSectionRequest {
+    std::string_view SectionName;
+    std::span<const uint8_t>* OutSectionData;
+};
+
+/**
+ * Symbol source reading the DWARF debug information of the ELF files, e.g. the Linux dedicated server binaries or the .debug files split from them
+ * On open, the units are enumerated, their abbreviations are decoded once per abbreviation set and the qualified names of the
+ * class definitions are indexed by walking the units in parallel. Units covered by an accelerator table (.debug_names, .gdb_index, pubtypes)
+ * are skipped, and only read when the table points a lookup to them. Every unit carries its own copy of the common classes, so the copies are
+ * deduplicated as they are found and each class is later read from a single unit. Everything else is read lazily, a unit at a time
+ * Split DWARF is read from the package file (.dwp) next to the file. Split units are mapped through the unit index of the package and linked to their
+ * skeleton units, their entries are only decoded once a lookup lands in them, same as for the rest of the units
+ * Handles are the .debug_info offsets of the entries, with the high bits selecting the derived symbols (function types of the member functions, array dimensions)
+ */
+class FDwarfSymbolSource final : public ISymbolSource {
+private:
+    ///Log of the file being dumped, kept for the diagnostics of the sections and units read after the file is opened
+    FDumpLog Log;
+    FELFFile ELFFile;
+    FDwarfUnitSections FileSections;
+    ///Package of the split units the skeleton units of the file refer to, if there is one
+    FELFFile PackageFile;
+    FDwarfUnitSections PackageSections;
+    ///Owned data of the compressed sections, which the views above point into
+    std::vector<FMappedRegion> DecompressedSections;
+
+    ///Line table is only needed for the source lines of the dumped types, so it is not decompressed until the first one is looked up
+    mutable std::once_flag LineSectionFlag;
+    mutable std::span<const uint8_t> LineSection;
+    mutable FMappedRegion DecompressedLineSection;
+
+    ///Units of the file followed by the split units of the package, sorted by the offset
+    std::vector<FDwarfUnit> Units;
+    ///Split units by the offset of their skeleton unit, which is what the accelerator tables of the file point to
+    std::unordered_map<uint64_t, const FDwarfUnit*> SkeletonSplitUnits;
+    ///Accelerator table of the file, used to find the definitions without reading all of the units it covers
+    FDwarfNameIndex NameIndex;
+    ///Fully qualified names of the class, structure and union definitions of the units not covered by the name index, mapped to the offset of the first definition
+    std::unordered_map<std::string, uint64_t> UserDefinedTypes;
+    ///Definitions of the units covered by the name index, indexed the first time a lookup lands in the unit
+    mutable std::unordered_map<uint64_t, std::unique_ptr<std::unordered_map<std::string, uint64_t>>> IndexedUnitTypes;
+    mutable std::mutex IndexedUnitTypesLock;
+    ///Offsets of the types described by the type units, by the signature the DW_FORM_ref_sig8 references use
+    std::unordered_map<uint64_t, uint64_t> TypeUnitTypes;
+    ///Entry trees are decoded once per unit, in parallel for the different units. Indexed the same as the units
+    std::unique_ptr<std::once_flag[]> UnitEntriesFlags;
+    ///Line table headers are read once per unit the same way
+    std::unique_ptr<std::once_flag[]> UnitLineTableFlags;
+public:
+    bool Open(const std::filesystem::path& FilePath, const FDumpLog& InLog);
+
+    inline const FDwarfNameIndex& GetNameIndex() const {
+        return NameIndex;
+    }
+
+    FSymbolHandle FindUserDefinedType(const std::string& TypeName) const override;
+    bool GetSymbolInfo(FSymbolHandle Symbol, FSymbolInfo& OutInfo) const override;
+    std::string GetSymbolName(FSymbolHandle Symbol) const override;
+    void GetChildren(FSymbolHandle Symbol, ESymbolTag ChildTag, std::vector<FSymbolHandle>& OutChildren) const override;
+    bool GetSourceLine(FSymbolHandle Symbol, std::string& OutSourceFilePath, int32_t& OutLineNumber) const override;
+
+    ///Sections are only read once the file is opened, and the state built lazily by the lookups is guarded by its own locks and once flags
+    inline bool SupportsConcurrentAccess() const override {
+        return true;
+    }
+private:
+    bool ReadDebugSections(const FELFFile& File, std::span<const FDwarfSectionRequest> SectionRequests);
+    std::span<const uint8_t> GetLineSection() const;
+    bool ReadUnits(std::vector<FDwarfUnit>& OutSkeletonUnits);
+    bool ReadPackageUnits(const std::filesystem::path& FilePath, const std::vector<FDwarfUnit>& SkeletonUnits);
+    bool InitializeUnit(FDwarfUnit& Unit, FDwarfUnitSections& Sections);
+    bool ReadUnitRootEntry(FDwarfUnit& Unit) const;
+    void ReadNameIndex();
+    void BuildTypeNameIndex();
+    void IndexUnitTypeNames(const FDwarfUnit& Unit, FDwarfTypeDefinitionMap& TypeDefinitions) const;
+    const std::unordered_map<std::string, uint64_t>& GetIndexedUnitTypes(const FDwarfUnit& Unit) const;
+    uint64_t FindTypeDefinition(const std::string& QualifiedName) const;
+
+    const FDwarfUnit* FindUnit(uint64_t Offset) const;
+    const FDwarfUnit* FindNameIndexUnit(uint64_t NameIndexOffset) const;
+    const std::vector<FDwarfEntry>& GetUnitEntries(const FDwarfUnit& Unit) const;
+    std::unique_ptr<std::vector<FDwarfEntry>> DecodeUnitEntries(const FDwarfUnit& Unit) const;
+    const FDwarfEntry* FindEntry(uint64_t Offset, const FDwarfUnit*& OutUnit) const;
+    const FDwarfEntry* GetParentEntry(const FDwarfUnit& Unit, const FDwarfEntry& Entry) const;
+    void GetChildEntries(const FDwarfUnit& Unit, const FDwarfEntry& Entry, std::vector<const FDwarfEntry*>& OutChildren) const;
+
+    bool FindAttribute(const FDwarfUnit& Unit, const FDwarfEntry& Entry, EDwarfAttribute Attribute, FDwarfAttributeValue& OutValue) const;
+    bool GetConstantAttribute(const FDwarfUnit& Unit, const FDwarfEntry& Entry, EDwarfAttribute Attribute, uint64_t& OutValue) const;
+    bool HasFlagAttribute(const FDwarfUnit& Unit, const FDwarfEntry& Entry, EDwarfAttribute Attribute) const;
+    uint64_t GetReferenceAttribute(const FDwarfUnit& Unit, const FDwarfEntry& Entry, EDwarfAttribute Attribute) const;
+    ///Recursion depth counts the specification and scope entries followed so far, which only run away in the malformed files
+    std::string_view GetEntryName(const FDwarfUnit& Unit, const FDwarfEntry& Entry, uint32_t RecursionDepth = 0) const;
+    std::string GetQualifiedName(const FDwarfUnit& Unit, const FDwarfEntry& Entry, uint32_t RecursionDepth = 0) const;
+
+    uint64_t StripModifiers(uint64_t TypeOffset, bool& OutIsConst, bool& OutIsVolatile) const;
+    uint64_t ResolveTypeDefinition(uint64_t TypeOffset) const;
+    uint64_t GetTypeSize(FSymbolHandle TypeSymbol) const;
+    uint64_t GetDataMemberLocation(const FDwarfUnit& Unit, const FDwarfEntry& Entry) const;
+    const FDwarfEntry* GetBaseClassEntry(const FDwarfUnit& Unit, const FDwarfEntry& InheritanceEntry, const FDwarfUnit*& OutBaseClassUnit) const;
+    bool GetVirtualTableSlot(const FDwarfUnit& Unit, const FDwarfEntry& FunctionEntry, uint64_t& OutVirtualTableSlot) const;
+    ///Base classes are followed up to the same depth, a class can only be its own base in the malformed files
+    uint32_t GetVirtualTableEntryCount(const FDwarfUnit& Unit, const FDwarfEntry& UDTEntry, uint32_t RecursionDepth = 0) const;
+    bool IsOverridingBaseFunction(const FDwarfUnit& Unit, const FDwarfEntry& UDTEntry, std::string_view FunctionName, uint64_t VirtualTableSlot, bool bIsPrimaryBaseChain, uint32_t RecursionDepth = 0) const;
+    EMemberAccess GetMemberAccess(const FDwarfUnit& Unit, const FDwarfEntry& Entry) const;
+
+    bool GetUserDefinedTypeInfo(const FDwarfUnit& Unit, const FDwarfEntry& Entry, FSymbolInfo& OutInfo) const;
+    bool GetArrayDimensionInfo(const FDwarfUnit& Unit, const FDwarfEntry& Entry, uint32_t Dimension, FSymbolInfo& OutInfo) const;
+    bool GetMemberInfo(const FDwarfUnit& Unit, const FDwarfEntry& Entry, FSymbolInfo& OutInfo) const;
+    bool GetFunctionInfo(const FDwarfUnit& Unit, const FDwarfEntry& Entry, FSymbolInfo& OutInfo) const;
+    const FDwarfLineTableFiles* GetLineTableFiles(const FDwarfUnit& Unit) const;
+    std::unique_ptr<FDwarfLineTableFiles> ReadLineTableFiles(const FDwarfUnit& Unit) const;
+    bool GetSourceFileName(const FDwarfUnit& Unit, uint64_t FileIndex, std::string& OutFilePath) const;
+};
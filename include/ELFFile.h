@@ -0,0 +1,108 @@
+#pragma once
+
+#include "DumpLog.h"
+#include "MappedFile.h"
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+///The header located at the very beginning of the 64-bit ELF file. Matches Elf64_Ehdr
+struct FELFFileHeader {
+    uint8_t Ident[16];
+    uint16_t Type;
+    uint16_t Machine;
+    uint32_t Version;
+    uint64_t Entry;
+    uint64_t ProgramHeaderOffset;
+    uint64_t SectionHeaderOffset;
+    uint32_t Flags;
+    uint16_t HeaderSize;
+    uint16_t ProgramHeaderEntrySize;
+    uint16_t NumProgramHeaders;
+    uint16_t SectionHeaderEntrySize;
+    uint16_t NumSectionHeaders;
+    uint16_t SectionNameTableIndex;
+};
+static_assert(sizeof(FELFFileHeader) == 64, "ELF64 file header must be 64 bytes");
+
+///Entry of the section header table of the 64-bit ELF file. Matches Elf64_Shdr
+struct FELFSectionHeader {
+    uint32_t Name;
+    uint32_t Type;
+    uint64_t Flags;
+    uint64_t Address;
+    uint64_t Offset;
+    uint64_t Size;
+    uint32_t Link;
+    uint32_t Info;
+    uint64_t AddressAlign;
+    uint64_t EntrySize;
+};
+static_assert(sizeof(FELFSectionHeader) == 64, "ELF64 section header must be 64 bytes");
+
+///Header in front of the data of the sections with the SHF_COMPRESSED flag. Matches Elf64_Chdr
+struct FELFCompressionHeader {
+    uint32_t Type;
+    uint32_t Reserved;
+    uint64_t Size;
+    uint64_t AddressAlign;
+};
+static_assert(sizeof(FELFCompressionHeader) == 24, "ELF64 compression header must be 24 bytes");
+
+///Type of the relocatable files, ET_REL. The debug sections of the object files still reference each other through the relocations the linker would apply
+constexpr uint16_t ELFFileTypeRelocatable = 1;
+
+///Section types and flags we need to tell apart
+constexpr uint32_t ELFSectionTypeNoBits = 8;
+constexpr uint64_t ELFSectionFlagCompressed = 0x800;
+
+///Compression algorithms of the SHF_COMPRESSED sections, ELFCOMPRESS_*
+enum class EELFCompressionType : uint32_t {
+    Zlib = 1,
+    Zstd = 2,
+};
+
+///A single section of the ELF file. The data aliases the file mapping, so sections must not outlive the FELFFile they came from
+struct FELFSection {
+    std::string_view Name{};
+    uint32_t Type{0};
+    uint64_t Flags{0};
+    FMappedRegion Region{};
+
+    inline std::span<const uint8_t> GetData() const {
+        return Region.GetData();
+    }
+
+    ///True for the sections compressed with -gz (SHF_COMPRESSED) and the .zdebug_* sections of the older toolchains
+    inline bool IsCompressed() const {
+        return (Flags & ELFSectionFlagCompressed) != 0 || Name.starts_with(".zdebug");
+    }
+};
+
+/**
+ * Read-only view of the sections of the ELF file, either the executable itself or the separate .debug file split from it
+ * Only little endian 64-bit files are supported, which covers all platforms dedicated servers are built for
+ */
+class FELFFile {
+private:
+    FMappedFile MappedFile;
+    std::vector<FELFSection> Sections;
+public:
+    bool Open(const std::filesystem::path& FilePath, const FDumpLog& Log);
+
+    ///Returns the section with the given name, or nullptr if there is no such section or it has no data in this file
+    const FELFSection* FindSection(std::string_view SectionName) const;
+
+    ///Returns the debug section with the given .debug_* name, falling back to its .zdebug_* counterpart the older toolchains compress into
+    const FELFSection* FindDebugSection(std::string_view SectionName) const;
+
+    ///Decompresses the data of the compressed section into an owned region. Each algorithm is only available if the build found its library
+    static bool DecompressSection(const FELFSection& Section, FMappedRegion& OutRegion, const FDumpLog& Log);
+
+    ///Checks the magic of the file without mapping it, used to pick up the debug files that do not have an extension
+    static bool IsELFFile(const std::filesystem::path& FilePath);
+private:
+    bool ReadSectionHeaders(const std::filesystem::path& FilePath, const FDumpLog& Log);
+};
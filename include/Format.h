@@ -0,0 +1,187 @@
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+///Replacement field of the format string, {} or {:[0][width][d|x|X]}. Only the integer arguments take a format spec, char and bool arguments do not
+///Format strings and string arguments are UTF-8, so the formatted text can be written out as is
+struct FFormatSpec {
+    bool bZeroPad{false};
+    uint32_t Width{0};
+    int32_t Base{10};
+    bool bUpperCase{false};
+};
+
+///Integer arguments are printed as numbers and take the format spec. char is printed as the character and bool as true or false instead
+template<typename ArgumentType>
+inline constexpr bool bIsFormatIntegerArgument = std::is_integral_v<ArgumentType> && !std::is_same_v<ArgumentType, char> && !std::is_same_v<ArgumentType, bool>;
+
+///Not constexpr on purpose: calling it while checking the format string at compile time turns the malformed format string into a compile error
+void FormatStringError(const char* Message);
+
+///Parses the replacement field starting right after the opening brace. Returns the position right after the closing brace, or npos if the field is malformed
+constexpr size_t ParseFormatSpec(std::string_view Format, size_t Position, FFormatSpec& OutSpec) {
+    if (Position < Format.size() && Format[Position] == ':') {
+        Position++;
+        if (Position < Format.size() && Format[Position] == '0') {
+            OutSpec.bZeroPad = true;
+            Position++;
+        }
+        while (Position < Format.size() && Format[Position] >= '0' && Format[Position] <= '9') {
+            OutSpec.Width = OutSpec.Width * 10 + static_cast<uint32_t>(Format[Position] - '0');
+            Position++;
+        }
+        if (Position < Format.size() && (Format[Position] == 'x' || Format[Position] == 'X')) {
+            OutSpec.Base = 16;
+            OutSpec.bUpperCase = Format[Position] == 'X';
+            Position++;
+        } else if (Position < Format.size() && Format[Position] == 'd') {
+            Position++;
+        }
+    }
+    if (Position >= Format.size() || Format[Position] != '}') {
+        return std::string_view::npos;
+    }
+    return Position + 1;
+}
+
+/**
+ * Format string with the {} replacement fields, checked against the types of the arguments when the program is compiled
+ * Braces are escaped by doubling them, e.g. "{{}}" formats as "{}". A field count not matching the argument count, an unbalanced brace
+ * or an integer format spec used on a string argument fail the compilation instead of producing garbage at runtime
+ */
+template<typename... ArgTypes>
+class TFormatString {
+private:
+    std::string_view Format;
+public:
+    consteval TFormatString(const char* InFormat) : Format(InFormat) {
+        constexpr bool bIsIntegerArgument[] = {bIsFormatIntegerArgument<ArgTypes>..., false};
+        size_t NumFields = 0;
+
+        for (size_t Position = 0; Position < Format.size();) {
+            const char Character = Format[Position++];
+            if (Character == '{' && Position < Format.size() && Format[Position] == '{') {
+                Position++;
+            } else if (Character == '}') {
+                if (Position >= Format.size() || Format[Position] != '}') {
+                    FormatStringError("Unmatched } in the format string, use }} to format a single }");
+                }
+                Position++;
+            } else if (Character == '{') {
+                FFormatSpec Spec{};
+                const size_t FieldStart = Position;
+                Position = ParseFormatSpec(Format, Position, Spec);
+                if (Position == std::string_view::npos) {
+                    FormatStringError("Malformed replacement field in the format string");
+                }
+                if (NumFields >= sizeof...(ArgTypes)) {
+                    FormatStringError("Format string has more replacement fields than there are arguments");
+                }
+                if (Position - FieldStart > 1 && !bIsIntegerArgument[NumFields]) {
+                    FormatStringError("Format spec is only supported for the integer arguments");
+                }
+                NumFields++;
+            }
+        }
+        if (NumFields != sizeof...(ArgTypes)) {
+            FormatStringError("Format string has fewer replacement fields than there are arguments");
+        }
+    }
+
+    inline std::string_view Get() const {
+        return Format;
+    }
+};
+
+template<typename IntegerType> requires bIsFormatIntegerArgument<IntegerType>
+void AppendFormatArgument(std::string& Output, const FFormatSpec& Spec, IntegerType Argument) {
+    char Digits[72];
+    std::to_chars_result Result{};
+    ///Hexadecimal values are printed as their two's complement, the same way printf prints them
+    if (Spec.Base == 16) {
+        Result = std::to_chars(Digits, Digits + sizeof(Digits), static_cast<std::make_unsigned_t<IntegerType>>(Argument), 16);
+    } else {
+        Result = std::to_chars(Digits, Digits + sizeof(Digits), Argument, 10);
+    }
+    ///Width includes the sign. Zeros go between the sign and the digits, spaces go before the sign
+    const size_t NumCharacters = static_cast<size_t>(Result.ptr - Digits);
+    const size_t NumPadding = NumCharacters < Spec.Width ? Spec.Width - NumCharacters : 0;
+    const char* DigitsBegin = Digits;
+    if (!Spec.bZeroPad) {
+        Output.append(NumPadding, ' ');
+    }
+    if constexpr (std::is_signed_v<IntegerType>) {
+        if (*DigitsBegin == '-') {
+            Output.push_back('-');
+            DigitsBegin++;
+        }
+    }
+    if (Spec.bZeroPad) {
+        Output.append(NumPadding, '0');
+    }
+    for (const char* Digit = DigitsBegin; Digit != Result.ptr; Digit++) {
+        Output.push_back(Spec.bUpperCase && *Digit >= 'a' ? static_cast<char>(*Digit - 'a' + 'A') : *Digit);
+    }
+}
+
+inline void AppendFormatArgument(std::string& Output, const FFormatSpec& /*Spec*/, std::string_view Argument) {
+    Output.append(Argument);
+}
+
+inline void AppendFormatArgument(std::string& Output, const FFormatSpec& /*Spec*/, char Argument) {
+    Output.push_back(Argument);
+}
+
+///Template so that only the bool arguments pick it, the string literals would convert to bool ahead of std::string_view otherwise
+template<typename BoolType> requires std::is_same_v<BoolType, bool>
+void AppendFormatArgument(std::string& Output, const FFormatSpec& /*Spec*/, BoolType Argument) {
+    Output.append(Argument ? "true" : "false");
+}
+
+/**
+ * Appends the formatted string to the output, e.g. FormatTo(Output, "#define {} 0x{:08X}", Name, RVA)
+ * Nothing is allocated besides the growth of the output, so formatting into a reused buffer does not touch the heap once the buffer is large enough
+ */
+template<typename... ArgTypes>
+void FormatTo(std::string& Output, TFormatString<std::type_identity_t<ArgTypes>...> FormatString, const ArgTypes&... Arguments) {
+    const std::string_view FormatView = FormatString.Get();
+    size_t FieldIndex = 0;
+    size_t LiteralStart = 0;
+
+    for (size_t Position = 0; Position < FormatView.size();) {
+        const char Character = FormatView[Position];
+        if (Character != '{' && Character != '}') {
+            Position++;
+            continue;
+        }
+        Output.append(FormatView.substr(LiteralStart, Position - LiteralStart));
+
+        ///Escaped braces keep the second one as the start of the next literal
+        if (Character == '}' || FormatView[Position + 1] == '{') {
+            Position++;
+            LiteralStart = Position;
+            Position++;
+            continue;
+        }
+        FFormatSpec Spec{};
+        Position = ParseFormatSpec(FormatView, Position + 1, Spec);
+        LiteralStart = Position;
+
+        size_t ArgumentIndex = 0;
+        ((ArgumentIndex++ == FieldIndex ? AppendFormatArgument(Output, Spec, Arguments) : void()), ...);
+        FieldIndex++;
+    }
+    Output.append(FormatView.substr(LiteralStart));
+}
+
+///Returns the formatted string. Prefer FormatTo when the result is appended to another string anyway
+template<typename... ArgTypes>
+std::string Format(TFormatString<std::type_identity_t<ArgTypes>...> FormatString, const ArgTypes&... Arguments) {
+    std::string Result;
+    FormatTo<ArgTypes...>(Result, FormatString, Arguments...);
+    return Result;
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "DumpLog.h"
+#include "MappedFile.h"
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+///Indices of the streams that always have the same position in the PDB container
+enum class EPDBFixedStream : uint32_t {
+    OldDirectory = 0,
+    PDBInfo = 1,
+    TPI = 2,
+    DBI = 3,
+    IPI = 4
+};
+
+///Stream index stored in the 16-bit stream index fields of PDB headers when the stream is not present
+constexpr uint16_t InvalidStreamIndex = 0xFFFF;
+
+///Stream size stored in the stream directory for streams that have been deleted
+constexpr uint32_t NilStreamSize = 0xFFFFFFFF;
+
+///The header located at the very beginning of the MSF 7.00 file
+///BlockMapAddr is the first entry of the array of the block map blocks, which continues past the end of the structure
+struct FMSFSuperBlock {
+    char FileMagic[32];
+    uint32_t BlockSize;
+    uint32_t FreeBlockMapBlock;
+    uint32_t NumBlocks;
+    uint32_t NumDirectoryBytes;
+    uint32_t Unknown;
+    uint32_t BlockMapAddr;
+};
+static_assert(sizeof(FMSFSuperBlock) == 56, "MSF super block must be 56 bytes");
+
+///A single stream of the MSF container, presented as one contiguous read-only byte range
+///The data aliases the file mapping whenever possible, so streams must not outlive the FMSFFile they came from
+class FMSFStream {
+private:
+    uint32_t StreamIndex;
+    FMappedRegion Region;
+public:
+    FMSFStream() : StreamIndex(0) {}
+    FMSFStream(uint32_t InStreamIndex, FMappedRegion&& InRegion) : StreamIndex(InStreamIndex), Region(std::move(InRegion)) {}
+
+    inline uint32_t GetStreamIndex() const {
+        return StreamIndex;
+    }
+
+    inline std::span<const uint8_t> GetData() const {
+        return Region.GetData();
+    }
+
+    inline uint64_t GetSize() const {
+        return Region.GetData().size();
+    }
+
+    inline bool IsZeroCopy() const {
+        return Region.IsZeroCopy();
+    }
+
+    inline void AdviseSequentialAccess() const {
+        Region.AdviseSequentialAccess();
+    }
+
+    ///Lets the OS reclaim the pages of the stream after a linear pass over it. The data remains accessible
+    inline void ReleaseResidentPages() const {
+        Region.ReleaseResidentPages();
+    }
+};
+
+///Native reader of the Multi-Stream File container used by the PDB files
+///It maps the file into memory, parses the super block and the stream directory,
+///and then hands out the streams as views into the mapping
+class FMSFFile {
+private:
+    FMappedFile MappedFile;
+    FMSFSuperBlock SuperBlock{};
+    FMappedRegion BlockMapRegion;
+    FMappedRegion DirectoryRegion;
+    std::vector<uint32_t> StreamSizes;
+    std::vector<std::span<const uint32_t>> StreamBlocks;
+public:
+    bool Open(const std::filesystem::path& FilePath, const FDumpLog& Log);
+
+    inline uint32_t GetBlockSize() const {
+        return SuperBlock.BlockSize;
+    }
+
+    inline uint32_t GetNumStreams() const {
+        return static_cast<uint32_t>(StreamSizes.size());
+    }
+
+    inline bool IsStreamPresent(uint32_t StreamIndex) const {
+        return StreamIndex < StreamSizes.size() && StreamSizes[StreamIndex] != NilStreamSize;
+    }
+
+    inline uint64_t GetStreamSize(uint32_t StreamIndex) const {
+        return IsStreamPresent(StreamIndex) ? StreamSizes[StreamIndex] : 0;
+    }
+
+    ///Opens the stream with the given index. Returns false if the stream does not exist
+    bool OpenStream(uint32_t StreamIndex, FMSFStream& OutStream) const;
+
+    inline bool OpenStream(EPDBFixedStream FixedStream, FMSFStream& OutStream) const {
+        return OpenStream(static_cast<uint32_t>(FixedStream), OutStream);
+    }
+private:
+    bool ReadStreamDirectory();
+};
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+///A read-only view of a set of file blocks stitched together into a single contiguous range of memory
+///When the blocks cannot be remapped (different page size, or a platform without fixed mappings),
+///the blocks are copied into an owned buffer instead, which is still presented through the same view
+class FMappedRegion {
+private:
+    const uint8_t* Data;
+    uint64_t Size;
+    void* ReservedAddress;
+    uint64_t ReservedSize;
+    std::vector<uint8_t> MaterializedData;
+public:
+    FMappedRegion();
+    ~FMappedRegion();
+
+    FMappedRegion(const FMappedRegion&) = delete;
+    FMappedRegion& operator=(const FMappedRegion&) = delete;
+    FMappedRegion(FMappedRegion&& Other) noexcept;
+    FMappedRegion& operator=(FMappedRegion&& Other) noexcept;
+
+    inline std::span<const uint8_t> GetData() const {
+        return {Data, static_cast<size_t>(Size)};
+    }
+
+    ///True if the region aliases the file mapping directly instead of owning a copy of the data
+    inline bool IsZeroCopy() const {
+        return MaterializedData.empty();
+    }
+
+    /**
+     * Hints the OS that the region is about to be read front to back, so it reads ahead aggressively
+     * and lets the pages go soon after they have been read. Does nothing for the materialized regions
+     */
+    void AdviseSequentialAccess() const;
+
+    /**
+     * Drops the pages of the region from the resident set of the process once a linear pass over it is done
+     * The data stays valid: the pages are backed by the file, so touching them again simply faults them back in
+     * Does nothing for the materialized regions, as their heap memory is not backed by the file
+     */
+    void ReleaseResidentPages() const;
+
+    static FMappedRegion CreateView(const uint8_t* InData, uint64_t InSize);
+    static FMappedRegion CreateRemapped(void* InReservedAddress, uint64_t InReservedSize, uint64_t InSize);
+    static FMappedRegion CreateMaterialized(std::vector<uint8_t>&& InData);
+private:
+    void Reset();
+};
+
+///Read-only memory mapping of the whole file. The mapping is kept alive for the lifetime of the object
+///and all views handed out by it point directly into the page cache
+class FMappedFile {
+private:
+    const uint8_t* Data;
+    uint64_t Size;
+#ifdef _WIN32
+    void* FileHandle;
+    void* MappingHandle;
+#else
+    int FileDescriptor;
+#endif
+public:
+    FMappedFile();
+    ~FMappedFile();
+
+    FMappedFile(const FMappedFile&) = delete;
+    FMappedFile& operator=(const FMappedFile&) = delete;
+
+    bool Open(const std::filesystem::path& FilePath);
+    void Close();
+
+    inline bool IsOpen() const {
+        return Data != nullptr;
+    }
+
+    inline std::span<const uint8_t> GetData() const {
+        return {Data, static_cast<size_t>(Size)};
+    }
+
+    inline uint64_t GetSize() const {
+        return Size;
+    }
+
+    /**
+     * Maps the given list of equally sized file blocks into a single contiguous region
+     * Consecutive blocks are returned as a direct view of the file mapping, and scattered blocks are
+     * remapped next to each other in a reserved address range when the block size is a multiple of the page size
+     * Only as a last resort the blocks are copied into an owned buffer
+     */
+    FMappedRegion MapBlocks(std::span<const uint32_t> Blocks, uint32_t BlockSize, uint64_t RegionSize) const;
+};
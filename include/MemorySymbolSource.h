@@ -0,0 +1,53 @@
+#pragma once
+
+#include "SymbolSource.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+///Symbol stored by the in-memory symbol source, together with its children
+struct FMemorySymbol {
+    std::string Name{};
+    FSymbolInfo Info{};
+    std::vector<FSymbolHandle> Children{};
+    std::string SourceFilePath{};
+    int32_t SourceLineNumber{0};
+};
+
+/**
+ * Symbol source holding synthetic symbols built in memory
+ * Lets the layout generator run without any debug information file, e.g. on the types described by hand in the tests and the benchmarks
+ * Handles are the 1-based indices of the symbols. The source must not be modified while it is being queried
+ */
+class FMemorySymbolSource final : public ISymbolSource {
+private:
+    std::vector<FMemorySymbol> Symbols;
+    std::unordered_map<std::string, FSymbolHandle> UserDefinedTypes;
+public:
+    ///Adds the symbol with the given properties. UDTs become visible to FindUserDefinedType by their name
+    FSymbolHandle AddSymbol(const std::string& Name, const FSymbolInfo& Info);
+
+    ///Adds the child symbol with the given properties to the parent symbol
+    FSymbolHandle AddChildSymbol(FSymbolHandle Parent, const std::string& Name, const FSymbolInfo& Info);
+
+    FSymbolHandle AddBasicType(EBasicType BasicType, uint64_t Size, bool bIsConst = false);
+    FSymbolHandle AddPointerType(FSymbolHandle PointeeType, uint64_t PointerSize = 8, bool bIsReference = false);
+    FSymbolHandle AddArrayType(FSymbolHandle ElementType, uint32_t ElementCount);
+    FSymbolHandle AddUserDefinedType(const std::string& Name, EUDTKind UDTKind, uint64_t Size, bool bHasConstructor = false);
+    FSymbolHandle AddFunctionType(FSymbolHandle ReturnType, const std::vector<FSymbolHandle>& ArgumentTypes, FSymbolHandle ClassParent = {});
+
+    FSymbolHandle AddBaseClass(FSymbolHandle UDT, FSymbolHandle BaseClassType, int32_t Offset, EMemberAccess Access = EMemberAccess::Public);
+    FSymbolHandle AddMemberVariable(FSymbolHandle UDT, const std::string& Name, FSymbolHandle VariableType, int32_t Offset, EMemberAccess Access = EMemberAccess::Public);
+    FSymbolHandle AddBitfield(FSymbolHandle UDT, const std::string& Name, FSymbolHandle VariableType, int32_t Offset, uint32_t BitPosition, uint32_t BitSize, EMemberAccess Access = EMemberAccess::Public);
+    FSymbolHandle AddVirtualFunction(FSymbolHandle UDT, const std::string& Name, FSymbolHandle FunctionType, int32_t VirtualTableOffset, bool bIsIntroVirtual = true, EMemberAccess Access = EMemberAccess::Public);
+
+    void SetSourceLine(FSymbolHandle Symbol, const std::string& SourceFilePath, int32_t LineNumber);
+
+    FSymbolHandle FindUserDefinedType(const std::string& TypeName) const override;
+    bool GetSymbolInfo(FSymbolHandle Symbol, FSymbolInfo& OutInfo) const override;
+    std::string GetSymbolName(FSymbolHandle Symbol) const override;
+    void GetChildren(FSymbolHandle Symbol, ESymbolTag ChildTag, std::vector<FSymbolHandle>& OutChildren) const override;
+    bool GetSourceLine(FSymbolHandle Symbol, std::string& OutSourceFilePath, int32_t& OutLineNumber) const override;
+private:
+    const FMemorySymbol* GetSymbol(FSymbolHandle Symbol) const;
+};
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "ContentHash.h"
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+///Writes the contents into the file, replacing it if it already exists. The whole buffer is handed to the OS in a single write,
+///which is only repeated for the remainder if the OS writes it partially. Returns false if the file cannot be created or written
+bool WriteFileContents(const std::filesystem::path& FilePath, std::string_view Contents);
+
+///Hash and size of a generated file as it has last been written, as recorded in the manifest of its output directory
+struct FOutputFileRecord {
+    FContentHash ContentHash{};
+    uint64_t Size{0};
+    ///Last write time of the file right after it has been written, in the ticks of std::filesystem::file_time_type
+    int64_t LastWriteTime{0};
+};
+
+/**
+ * Directory the generated files are written into, skipping the files whose contents are the same as the last time they have been written
+ * Rewriting an identical header still bumps its timestamp and recompiles everything that includes it, so the hash and the size of every written file
+ * are kept in a small manifest next to them, and the new contents are compared against the manifest instead of reading the old file back
+ * A file that has been deleted, or has a different size or last write time than it had right after it was written, is always written again
+ * Last write times are only as fine as the file system keeps them, so a file last written within that window of the manifest is read back and hashed,
+ * as a same-size edit made right after it has been written would keep its last write time
+ * Files can be written from several threads at the same time
+ * The changed files are handed over to the shared FAsyncFileWriter, so queueing them returns as soon as they are compared and the writes finish in the background
+ */
+class FOutputDirectory {
+private:
+    std::filesystem::path DirectoryPath;
+    ///Keyed by the UTF-8 file names, relative to the directory
+    std::unordered_map<std::string, FOutputFileRecord> FileRecords;
+    ///Last write time of the loaded manifest, in the ticks of std::filesystem::file_time_type. Zero if there has been no manifest to load
+    int64_t ManifestWriteTime{0};
+    size_t NumWrittenFiles{0};
+    size_t NumUnchangedFiles{0};
+    size_t NumPendingWrites{0};
+    ///UTF-8 names of the files that could not be written
+    std::vector<std::string> FailedFileNames;
+    mutable std::mutex FileRecordsLock;
+    std::condition_variable PendingWritesCondition;
+public:
+    static constexpr const char* ManifestFileName = ".UVTDManifest";
+
+    explicit FOutputDirectory(const std::filesystem::path& InDirectoryPath);
+    ///Waits for the writes still in flight, as they report back to the directory
+    ~FOutputDirectory();
+
+    FOutputDirectory(const FOutputDirectory&) = delete;
+    FOutputDirectory& operator=(const FOutputDirectory&) = delete;
+
+    ///Creates the directory if it does not exist yet and loads the manifest of the previous run
+    ///A missing or malformed manifest is not an error, it only means that all of the files are written again
+    ///The loaded manifest is removed from the disk until it is saved again, so a run interrupted halfway cannot leave records of files it has since overwritten
+    bool Open();
+
+    ///Queues the file with the given UTF-8 name to be written, unless it already has exactly these contents
+    ///Blocks while the queue of the writer is full. Failures are reported by WaitForPendingWrites
+    void WriteFile(const std::string& FileName, std::string Contents);
+
+    ///Blocks until all of the files queued so far have been written. Returns false if any of the files of the directory could not be written
+    bool WaitForPendingWrites();
+
+    ///Saves the manifest with the records of the files written so far, waiting for the pending writes first. Records of the files that have not been written this time are kept, as the files are still there
+    bool SaveManifest();
+
+    inline const std::filesystem::path& GetPath() const {
+        return DirectoryPath;
+    }
+
+    inline size_t GetNumWrittenFiles() const {
+        std::scoped_lock Lock{FileRecordsLock};
+        return NumWrittenFiles;
+    }
+
+    inline size_t GetNumUnchangedFiles() const {
+        std::scoped_lock Lock{FileRecordsLock};
+        return NumUnchangedFiles;
+    }
+
+    inline std::vector<std::string> GetFailedFileNames() const {
+        std::scoped_lock Lock{FileRecordsLock};
+        return FailedFileNames;
+    }
+};
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "MSFFile.h"
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+///Header of the DBI stream, in the "new" format written by every MSVC since Visual C++ 7.0
+struct FDbiStreamHeader {
+    int32_t VersionSignature;
+    uint32_t VersionHeader;
+    uint32_t Age;
+    uint16_t GlobalSymbolStreamIndex;
+    uint16_t BuildNumber;
+    uint16_t PublicSymbolStreamIndex;
+    uint16_t PdbDllVersion;
+    uint16_t SymbolRecordStreamIndex;
+    uint16_t PdbDllRebuild;
+    int32_t ModuleInfoSize;
+    int32_t SectionContributionSize;
+    int32_t SectionMapSize;
+    int32_t SourceInfoSize;
+    int32_t TypeServerMapSize;
+    uint32_t MFCTypeServerIndex;
+    int32_t OptionalDebugHeaderSize;
+    int32_t ECSubstreamSize;
+    uint16_t Flags;
+    uint16_t Machine;
+    uint32_t Padding;
+};
+static_assert(sizeof(FDbiStreamHeader) == 64, "DBI stream header must be 64 bytes");
+
+///Section contribution, describing which module produced a range of a section. Only read as a part of the module info records
+struct FSectionContribution {
+    uint16_t Section;
+    uint16_t Padding1;
+    int32_t Offset;
+    int32_t Size;
+    uint32_t Characteristics;
+    uint16_t ModuleIndex;
+    uint16_t Padding2;
+    uint32_t DataCrc;
+    uint32_t RelocationCrc;
+};
+static_assert(sizeof(FSectionContribution) == 28, "Section contribution entry must be 28 bytes");
+
+///Fixed part of the module info records of the DBI stream. It is followed by the module name and the object file name
+struct FDbiModuleInfoHeader {
+    uint32_t Unused1;
+    FSectionContribution SectionContribution;
+    uint16_t Flags;
+    uint16_t ModuleSymbolStreamIndex;
+    uint32_t SymbolByteSize;
+    uint32_t C11LineInfoByteSize;
+    uint32_t C13LineInfoByteSize;
+    uint16_t SourceFileCount;
+    uint16_t Padding;
+    uint32_t Unused2;
+    uint32_t SourceFileNameIndex;
+    uint32_t PdbFilePathNameIndex;
+};
+static_assert(sizeof(FDbiModuleInfoHeader) == 64, "DBI module info header must be 64 bytes");
+
+struct FDbiModuleInfo {
+    uint16_t ModuleSymbolStreamIndex{InvalidStreamIndex};
+    uint32_t SymbolByteSize{0};
+    std::string_view ModuleName{};
+    std::string_view ObjectFileName{};
+};
+
+///IMAGE_SECTION_HEADER of the executable, as stored in the section header stream of the PDB
+struct FImageSectionHeader {
+    char Name[8];
+    uint32_t VirtualSize;
+    uint32_t VirtualAddress;
+    uint32_t SizeOfRawData;
+    uint32_t PointerToRawData;
+    uint32_t PointerToRelocations;
+    uint32_t PointerToLinenumbers;
+    uint16_t NumberOfRelocations;
+    uint16_t NumberOfLinenumbers;
+    uint32_t Characteristics;
+};
+static_assert(sizeof(FImageSectionHeader) == 40, "Image section header must be 40 bytes");
+
+///Indices of the streams listed in the optional debug header of the DBI stream
+enum class EDbiDebugStream : uint32_t {
+    FPO = 0,
+    Exception = 1,
+    Fixup = 2,
+    OmapToSource = 3,
+    OmapFromSource = 4,
+    SectionHeader = 5,
+    TokenRidMap = 6,
+    XData = 7,
+    PData = 8,
+    NewFPO = 9,
+    OriginalSectionHeader = 10,
+};
+
+/**
+ * Native reader of the DBI stream
+ * Parses the module list and the section headers of the executable, which together allow converting the section:offset addresses
+ * of the module symbols into RVAs. The section contribution, section map and source info substreams are skipped
+ */
+class FPDBDbiStream {
+private:
+    FMSFStream Stream;
+    FMSFStream SectionHeaderStream;
+    FDbiStreamHeader Header{};
+    std::vector<FDbiModuleInfo> Modules;
+    std::vector<FImageSectionHeader> SectionHeaders;
+public:
+    bool Open(const FMSFFile& MSFFile, const FDumpLog& Log);
+
+    inline const FDbiStreamHeader& GetHeader() const {
+        return Header;
+    }
+
+    inline const std::vector<FDbiModuleInfo>& GetModules() const {
+        return Modules;
+    }
+
+    inline const std::vector<FImageSectionHeader>& GetSectionHeaders() const {
+        return SectionHeaders;
+    }
+
+    ///Converts the 1-based section index and the offset into the section to the RVA. Returns 0 if the section does not exist
+    inline uint32_t ConvertSectionOffsetToRVA(uint16_t Section, uint32_t Offset) const {
+        if (Section == 0 || Section > SectionHeaders.size()) {
+            return 0;
+        }
+        return SectionHeaders[Section - 1].VirtualAddress + Offset;
+    }
+private:
+    bool ReadModuleInfo(std::span<const uint8_t> ModuleInfoData);
+    void ReadSectionHeaders(const FMSFFile& MSFFile, std::span<const uint8_t> DebugHeaderData, const FDumpLog& Log);
+};
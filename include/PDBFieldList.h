@@ -0,0 +1,118 @@
+#pragma once
+
+#include "PDBTypeStream.h"
+#include "BinaryReader.h"
+#include <string_view>
+
+///Method properties stored in the bits 2-4 of the CV_fldattr_t field attributes
+enum class EMethodProperty : uint8_t {
+    Vanilla = 0,
+    Virtual = 1,
+    Static = 2,
+    Friend = 3,
+    IntroducingVirtual = 4,
+    PureVirtual = 5,
+    PureIntroducingVirtual = 6,
+};
+
+///Member access stored in the bits 0-1 of the CV_fldattr_t field attributes
+enum class EFieldAccess : uint8_t {
+    None = 0,
+    Private = 1,
+    Protected = 2,
+    Public = 3,
+};
+
+///CV_fldattr_t field attributes shared by all of the field list entries
+struct FFieldAttributes {
+    uint16_t Value{0};
+
+    inline EFieldAccess GetAccess() const {
+        return static_cast<EFieldAccess>(Value & 0x3);
+    }
+    inline EMethodProperty GetMethodProperty() const {
+        return static_cast<EMethodProperty>((Value >> 2) & 0x7);
+    }
+    inline bool IsIntroducingVirtual() const {
+        return GetMethodProperty() == EMethodProperty::IntroducingVirtual || GetMethodProperty() == EMethodProperty::PureIntroducingVirtual;
+    }
+    inline bool IsVirtual() const {
+        const EMethodProperty Property = GetMethodProperty();
+        return Property == EMethodProperty::Virtual || Property == EMethodProperty::PureVirtual || IsIntroducingVirtual();
+    }
+    inline bool IsPureVirtual() const {
+        return GetMethodProperty() == EMethodProperty::PureVirtual || GetMethodProperty() == EMethodProperty::PureIntroducingVirtual;
+    }
+    inline bool IsStatic() const {
+        return GetMethodProperty() == EMethodProperty::Static;
+    }
+    ///Pseudo and compgenx bits, set on the members and methods the compiler generated
+    inline bool IsCompilerGenerated() const {
+        return (Value & (1 << 5)) != 0 || (Value & (1 << 8)) != 0;
+    }
+};
+
+/**
+ * A single entry of the field list, decoded in place
+ * Depending on the kind, only some of the fields are meaningful:
+ *  LF_BCLASS, LF_VBCLASS, LF_IVBCLASS: Attributes, Type (base class), Offset (base offset, or virtual base pointer offset)
+ *  LF_MEMBER, LF_STMEMBER: Attributes, Type, Offset (not for static members), Name
+ *  LF_ONEMETHOD: Attributes, Type (function type), VirtualTableOffset (for introducing virtuals), Name
+ *  LF_METHOD: MethodCount, Type (method list), Name
+ *  LF_NESTTYPE: Type, Name
+ *  LF_VFUNCTAB: Type (virtual table pointer type)
+ *  LF_ENUMERATE: Attributes, Offset (enumerator value), Name
+ */
+struct FFieldRecord {
+    ELeafKind Kind{};
+    FFieldAttributes Attributes{};
+    uint32_t Type{0};
+    uint64_t Offset{0};
+    uint32_t VirtualTableOffset{0};
+    uint16_t MethodCount{0};
+    std::string_view Name{};
+};
+
+/**
+ * Iterates the entries of a LF_FIELDLIST record, following LF_INDEX continuation records transparently
+ * Names are views into the mapped type stream and numeric leaves are decoded in place, so iterating allocates nothing
+ * Continuations are written before the records referencing them, so a continuation that is not below the current record is malformed, which also rules out cycles
+ */
+class FFieldListIterator {
+private:
+    const FPDBTypeStream* TypeStream;
+    FBinaryReader Reader;
+    ///Type index of the field list record currently being read
+    uint32_t RecordTypeIndex;
+    bool bMalformed;
+public:
+    FFieldListIterator(const FPDBTypeStream& InTypeStream, uint32_t FieldListTypeIndex);
+
+    ///Decodes the next entry. Returns false once the end of the field list is reached, or the field list is malformed
+    bool Next(FFieldRecord& OutRecord);
+
+    inline bool IsMalformed() const {
+        return bMalformed;
+    }
+private:
+    bool StartFieldListRecord(uint32_t FieldListTypeIndex);
+    bool ReadNumeric(uint64_t& OutValue);
+    void SkipPadding();
+};
+
+///A single overload of the LF_METHOD entry
+struct FMethodListEntry {
+    FFieldAttributes Attributes{};
+    uint32_t Type{0};
+    uint32_t VirtualTableOffset{0};
+};
+
+///Iterates the overloads stored in the LF_METHODLIST record referenced by the LF_METHOD field list entry
+class FMethodListIterator {
+private:
+    FBinaryReader Reader;
+public:
+    FMethodListIterator(const FPDBTypeStream& TypeStream, uint32_t MethodListTypeIndex);
+
+    bool Next(FMethodListEntry& OutEntry);
+};
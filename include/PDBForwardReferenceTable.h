@@ -0,0 +1,29 @@
+#pragma once
+
+#include "PDBTypeStream.h"
+#include <vector>
+
+struct FForwardReferenceEntry {
+    uint32_t ForwardTypeIndex;
+    uint32_t DefinitionTypeIndex;
+};
+
+/**
+ * Table resolving the forward declared UDT and enum records to the records of their definitions
+ * Built by one parallel pass over the type stream per PDB, matching the declarations to the definitions by their unique names when both have one, and by their names otherwise
+ * The result is a sorted array of pairs, so every later query is a binary search and no definition is ever looked up twice
+ */
+class FPDBForwardReferenceTable {
+private:
+    std::vector<FForwardReferenceEntry> Entries;
+public:
+    void Build(const FPDBTypeStream& TypeStream);
+
+    ///Returns the type index of the definition for the forward declaration with the given index
+    ///If the type is not a forward declaration, or its definition is not present in the PDB, the type index is returned unchanged
+    uint32_t ResolveForwardReference(uint32_t TypeIndex) const;
+
+    inline size_t GetNumEntries() const {
+        return Entries.size();
+    }
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+///Hash function used by the PDB TPI, GSI and /names hash tables (Hasher::lhashPbCb in the reference implementation)
+///Must match the MSVC implementation bit by bit, otherwise lookups land in the wrong buckets
+inline uint32_t HashStringV1(std::string_view String) {
+    uint32_t Result = 0;
+    const auto* Data = reinterpret_cast<const uint8_t*>(String.data());
+    const size_t NumLongs = String.size() / 4;
+
+    for (size_t i = 0; i < NumLongs; i++) {
+        uint32_t Value;
+        memcpy(&Value, Data + i * 4, sizeof(Value));
+        Result ^= Value;
+    }
+    const uint8_t* Remainder = Data + NumLongs * 4;
+    size_t RemainderSize = String.size() % 4;
+
+    ///Maximum of 3 bytes left. Hash a 2 byte word if possible, then hash the possibly remaining byte
+    if (RemainderSize >= 2) {
+        uint16_t Value;
+        memcpy(&Value, Remainder, sizeof(Value));
+        Result ^= static_cast<uint32_t>(Value);
+        Remainder += 2;
+        RemainderSize -= 2;
+    }
+    if (RemainderSize == 1) {
+        Result ^= *Remainder;
+    }
+
+    const uint32_t ToLowerMask = 0x20202020;
+    Result |= ToLowerMask;
+    Result ^= (Result >> 11);
+    return Result ^ (Result >> 16);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "BinaryReader.h"
+#include "MSFFile.h"
+#include <string_view>
+#include <vector>
+
+///Fixed header of the PDB info stream. It is followed by the named stream map and the feature codes
+struct FPDBInfoStreamHeader {
+    uint32_t Version;
+    uint32_t Signature;
+    uint32_t Age;
+    uint8_t Guid[16];
+};
+static_assert(sizeof(FPDBInfoStreamHeader) == 28, "PDB info stream header must be 28 bytes");
+
+///Entry of the named stream map, mapping the stream names like /names or /LinkInfo to the stream indices
+struct FNamedStreamEntry {
+    std::string_view Name;
+    uint32_t StreamIndex;
+};
+
+///Native reader of the PDB info stream. Provides the identity of the PDB and the indices of the named streams
+class FPDBInfoStream {
+private:
+    FMSFStream Stream;
+    FPDBInfoStreamHeader Header{};
+    std::vector<FNamedStreamEntry> NamedStreams;
+public:
+    bool Open(const FMSFFile& MSFFile, const FDumpLog& Log);
+
+    inline const FPDBInfoStreamHeader& GetHeader() const {
+        return Header;
+    }
+
+    ///Returns the index of the stream with the given name, or InvalidStreamIndex if the PDB does not have such a stream
+    uint32_t GetNamedStreamIndex(std::string_view StreamName) const;
+private:
+    bool ReadNamedStreamMap(FBinaryReader& Reader);
+};
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "MSFFile.h"
+#include "PDBDbiStream.h"
+#include "PDBForwardReferenceTable.h"
+#include "PDBInfoStream.h"
+#include "PDBSourceLineIndex.h"
+#include "PDBStringTable.h"
+#include "PDBTypeNameIndex.h"
+#include "PDBSymbolTable.h"
+#include "PDBTypeStream.h"
+#include <filesystem>
+
+///All of the native readers and indices of a single PDB file, built once when the file is opened
+class FPDBSession {
+private:
+    FMSFFile MSFFile;
+    FPDBTypeStream TypeStream;
+    FPDBTypeNameIndex TypeNameIndex;
+    FPDBForwardReferenceTable ForwardReferenceTable;
+    FPDBDbiStream DbiStream;
+    FPDBSymbolTable SymbolTable;
+    bool bHasSymbols{false};
+    FPDBInfoStream InfoStream;
+    FPDBTypeStream IdStream;
+    FPDBStringTable StringTable;
+    FPDBSourceLineIndex SourceLineIndex;
+public:
+    bool Open(const std::filesystem::path& PDBFilePath, const FDumpLog& Log);
+
+    inline const FMSFFile& GetMSFFile() const {
+        return MSFFile;
+    }
+
+    inline const FPDBTypeStream& GetTypeStream() const {
+        return TypeStream;
+    }
+
+    inline const FPDBTypeNameIndex& GetTypeNameIndex() const {
+        return TypeNameIndex;
+    }
+
+    inline const FPDBForwardReferenceTable& GetForwardReferenceTable() const {
+        return ForwardReferenceTable;
+    }
+
+    ///Returns true if the PDB has the DBI stream, and so the symbol table is available
+    inline bool HasSymbols() const {
+        return bHasSymbols;
+    }
+
+    ///Returns true if the addresses of the symbols can be converted into RVAs, which needs the section headers of the executable on top of the symbols
+    inline bool HasSymbolRVAs() const {
+        return bHasSymbols && !DbiStream.GetSectionHeaders().empty();
+    }
+
+    inline const FPDBDbiStream& GetDbiStream() const {
+        return DbiStream;
+    }
+
+    inline const FPDBSymbolTable& GetSymbolTable() const {
+        return SymbolTable;
+    }
+
+    ///Source locations of the type definitions. Empty if the PDB does not have the IPI stream or the /names stream
+    inline const FPDBSourceLineIndex& GetSourceLineIndex() const {
+        return SourceLineIndex;
+    }
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "PDBStringTable.h"
+#include "PDBTypeStream.h"
+#include <string_view>
+#include <unordered_map>
+
+///Source file and the line on which the user defined type has been defined
+struct FUDTSourceLine {
+    std::string_view SourceFile;
+    uint32_t LineNumber;
+};
+
+/**
+ * Maps the type indices of the TPI stream to the source locations of their definitions
+ * Built in a single linear pass over the LF_UDT_SRC_LINE and LF_UDT_MOD_SRC_LINE records of the IPI stream,
+ * with the file names resolved through the LF_STRING_ID records or the /names stream upfront, so lookups are a single hash probe
+ */
+class FPDBSourceLineIndex {
+private:
+    std::unordered_map<uint32_t, FUDTSourceLine> SourceLines;
+public:
+    void Build(const FPDBTypeStream& IdStream, const FPDBStringTable& StringTable);
+
+    ///Returns the source location of the definition of the given type, or nullptr if the PDB does not have it
+    inline const FUDTSourceLine* Find(uint32_t TypeIndex) const {
+        const auto Iterator = SourceLines.find(TypeIndex);
+        return Iterator != SourceLines.end() ? &Iterator->second : nullptr;
+    }
+
+    inline size_t GetNumSourceLines() const {
+        return SourceLines.size();
+    }
+};
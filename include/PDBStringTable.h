@@ -0,0 +1,24 @@
+#pragma once
+
+#include "MSFFile.h"
+#include <string_view>
+
+///Header of the /names stream holding the strings referenced by the offsets from the other streams
+struct FStringTableHeader {
+    uint32_t Signature;
+    uint32_t HashVersion;
+    uint32_t ByteSize;
+};
+static_assert(sizeof(FStringTableHeader) == 12, "String table header must be 12 bytes");
+
+///Native reader of the /names string table. Strings are returned as views into the mapped stream
+class FPDBStringTable {
+private:
+    FMSFStream Stream;
+    std::string_view StringBuffer;
+public:
+    bool Open(const FMSFFile& MSFFile, uint32_t StreamIndex, const FDumpLog& Log);
+
+    ///Returns the string at the given offset of the string buffer, or an empty string if the offset is out of range
+    std::string_view GetString(uint32_t Offset) const;
+};
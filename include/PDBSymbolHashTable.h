@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CodeView.h"
+#include "MSFFile.h"
+#include "PDBDbiStream.h"
+#include <span>
+#include <string_view>
+#include <vector>
+
+///Header of the GSI hash table, shared by the global symbol stream and the public symbol stream
+struct FGSIHashHeader {
+    uint32_t VersionSignature;
+    uint32_t VersionHeader;
+    uint32_t HashRecordsSize;
+    uint32_t BucketsSize;
+};
+static_assert(sizeof(FGSIHashHeader) == 16, "GSI hash header must be 16 bytes");
+
+///Header of the public symbol stream. It is followed by the GSI hash table, the address map and the thunk map
+struct FPSIHeader {
+    uint32_t SymbolHashSize;
+    uint32_t AddressMapSize;
+    uint32_t NumThunks;
+    uint32_t ThunkSize;
+    uint16_t ThunkTableSection;
+    uint16_t Padding;
+    uint32_t ThunkTableOffset;
+    uint32_t NumSections;
+};
+static_assert(sizeof(FPSIHeader) == 28, "PSI header must be 28 bytes");
+
+/**
+ * GSI hash table of the global or the public symbol stream
+ * Symbols are bucketed by the HashStringV1 hash of their name, so finding a symbol by name only decodes the records of one bucket
+ * Buckets are flattened into a single array of symbol record offsets when the table is read
+ */
+class FPDBSymbolHashTable {
+private:
+    std::span<const uint8_t> SymbolRecordData;
+    std::vector<uint32_t> RecordOffsets;
+    std::vector<uint32_t> BucketStarts;
+public:
+    ///Reads the hash table. Symbol record data must be the contents of the symbol record stream the table refers to
+    bool Read(std::span<const uint8_t> HashData, std::span<const uint8_t> InSymbolRecordData, const FDumpLog& Log);
+
+    ///Finds the symbol record with the given name. Returns false if there is no such symbol
+    bool FindSymbol(std::string_view Name, FSymbolRecord& OutRecord) const;
+};
+
+///Public symbols of the executable, with the hash table for the lookups by the decorated name
+class FPDBPublicSymbolTable {
+private:
+    FMSFStream PublicSymbolStream;
+    FPDBSymbolHashTable HashTable;
+public:
+    bool Open(const FMSFFile& MSFFile, const FPDBDbiStream& DbiStream, std::span<const uint8_t> SymbolRecordData, const FDumpLog& Log);
+
+    ///Finds the public symbol by its decorated name, e.g. ??_7AActor@@6B@
+    bool FindSymbolByName(std::string_view DecoratedName, FPublicSymbol& OutSymbol) const;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "SymbolSource.h"
+#include "PDBFieldList.h"
+#include "PDBSession.h"
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+///Single member of the field list of a user defined type: a base class, a data member or a single overload of a method
+struct FPDBMember {
+    ELeafKind Kind{};
+    FFieldAttributes Attributes{};
+    uint32_t Type{0};
+    uint64_t Offset{0};
+    uint32_t VirtualTableOffset{0};
+    std::string_view Name{};
+};
+
+///Members of the user defined type, split by the kind of the symbols they become, in declaration order
+struct FPDBTypeMembers {
+    std::vector<FPDBMember> BaseClasses;
+    std::vector<FPDBMember> DataMembers;
+    std::vector<FPDBMember> Functions;
+};
+
+/**
+ * Symbol source reading the type records straight from the PDB file through the native readers of FPDBSession
+ * Type handles are the type indices, modifiers and forward references included, so the declaration cache sees every distinct spelling of the type once
+ * Members of the user defined types have no type index of their own, so their handles carry the index of the type and the position of the member in it
+ * The field list of a type is decoded the first time one of its members is asked for, and the RVAs come from the symbol table of the DBI stream
+ */
+class FPDBSymbolSource final : public ISymbolSource {
+private:
+    FPDBSession Session;
+    ///Members of the user defined types by their type index, decoded the first time they are looked at
+    mutable std::unordered_map<uint32_t, std::unique_ptr<FPDBTypeMembers>> TypeMembers;
+    mutable std::mutex TypeMembersLock;
+public:
+    bool Open(const std::filesystem::path& PDBFilePath, const FDumpLog& Log);
+
+    inline const FPDBSession& GetSession() const {
+        return Session;
+    }
+
+    FSymbolHandle FindUserDefinedType(const std::string& TypeName) const override;
+    bool GetSymbolInfo(FSymbolHandle Symbol, FSymbolInfo& OutInfo) const override;
+    std::string GetSymbolName(FSymbolHandle Symbol) const override;
+    void GetChildren(FSymbolHandle Symbol, ESymbolTag ChildTag, std::vector<FSymbolHandle>& OutChildren) const override;
+    bool GetSourceLine(FSymbolHandle Symbol, std::string& OutSourceFilePath, int32_t& OutLineNumber) const override;
+    bool GenerateVirtualTableRVALayout(FSymbolHandle UDTSymbol, FVirtualTableRVALayout& OutLayout) const override;
+
+    ///Session is read only once opened, its lazily decoded type stream chunks and fallback name table are built under call_once
+    inline bool SupportsConcurrentAccess() const override {
+        return true;
+    }
+private:
+    const FPDBTypeMembers& GetTypeMembers(uint32_t TypeIndex) const;
+    const FPDBMember* FindMember(FSymbolHandle Symbol) const;
+    bool GetTypeInfo(uint32_t TypeIndex, FSymbolInfo& OutInfo) const;
+    bool IsConstMemberFunction(uint32_t FunctionTypeIndex) const;
+    bool FindOverriddenVirtualTableOffset(uint32_t ClassTypeIndex, std::string_view FunctionName, uint32_t ArgumentList, uint32_t& OutVirtualTableOffset) const;
+    uint32_t FindFunctionRVA(const std::string& QualifiedName, uint32_t FunctionType) const;
+    void AddVirtualFunctionRVA(uint32_t ClassTypeIndex, std::string_view ClassName, const FPDBMember& Function, FVirtualTableRVALayout& OutLayout) const;
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "PDBDbiStream.h"
+#include "PDBSymbolHashTable.h"
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+///Function defined in one of the modules of the executable
+struct FProcedureEntry {
+    std::string_view Name;
+    uint32_t FunctionType;
+    uint32_t RelativeVirtualAddress;
+};
+
+///Returns the decorated name of the primary virtual table of the class, e.g. ??_7AActor@@6B@ for AActor
+///Namespaces and outer classes are emitted innermost first, as the MSVC name decoration does
+std::string MakeVirtualTableSymbolName(std::string_view ClassName);
+
+/**
+ * Addresses of the functions and virtual tables of the executable, gathered from the module symbol streams
+ * and the public symbols of the PDB file. Module streams are walked in parallel, one task per module,
+ * and the results are merged into a single array sorted by the qualified function name
+ * Public symbols are looked up through the GSI hash table of the PDB, so they are never scanned
+ */
+class FPDBSymbolTable {
+private:
+    std::vector<FMSFStream> ModuleStreams;
+    FMSFStream SymbolRecordStream;
+    std::vector<FProcedureEntry> Procedures;
+    FPDBPublicSymbolTable PublicSymbols;
+    const FPDBDbiStream* DbiStream{nullptr};
+public:
+    void Build(const FMSFFile& MSFFile, const FPDBDbiStream& InDbiStream, const FDumpLog& Log);
+
+    ///Returns all of the functions with the given qualified name, e.g. AActor::Tick. Overloads share the name, and can be told apart by their type
+    std::span<const FProcedureEntry> FindProcedures(std::string_view QualifiedName) const;
+
+    ///Returns the RVA of the primary virtual table of the class with the given name, or 0 if the PDB does not have it
+    uint32_t FindVirtualTableRVA(std::string_view ClassName) const;
+
+    ///Returns the RVA of the public symbol with the given decorated name, or 0 if the PDB does not have it
+    uint32_t FindPublicSymbolRVA(std::string_view DecoratedName) const;
+
+    inline size_t GetNumProcedures() const {
+        return Procedures.size();
+    }
+private:
+    void CollectModuleProcedures(const FMSFFile& MSFFile, size_t ModuleIndex, std::vector<FProcedureEntry>& OutProcedures);
+    void OpenPublicSymbols(const FMSFFile& MSFFile, const FDumpLog& Log);
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "PDBTypeStream.h"
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Name to type index lookup for the user defined types of the TPI stream
+ * Built once per PDB from the hash values of the TPI hash stream, which places every definition of a non-scoped UDT
+ * into the bucket of its name, so a lookup is a hash of the name plus a probe of a handful of records
+ * A type missing from its bucket is reported as missing, so lookups of the types absent from the PDB stay as cheap as the hits
+ * This leaves out the local types, which are hashed by their unique names, and the types only ever forward declared
+ * When the PDB has no usable hash values, a name table built by one pass over all of the UDT records is used instead
+ */
+class FPDBTypeNameIndex {
+private:
+    const FPDBTypeStream* TypeStream{nullptr};
+    uint32_t NumHashBuckets{0};
+    std::vector<uint32_t> BucketStarts;
+    std::vector<uint32_t> BucketTypeIndices;
+
+    mutable std::once_flag FallbackIndexFlag;
+    mutable std::unordered_map<std::string_view, uint32_t> FallbackIndex;
+public:
+    void Build(const FPDBTypeStream& InTypeStream);
+
+    ///Returns the type index of the UDT with the given fully qualified name, or 0 if there is no such type
+    ///Full definitions are always preferred over the forward declarations, which are only returned when the PDB has no usable hash values
+    uint32_t FindUserDefinedType(std::string_view TypeName) const;
+
+    ///True if the given record is a class, struct, union or interface record, which is decoded into the tag record
+    static bool IsUserDefinedTypeRecord(const FTypeRecord& Record, FTagRecord& OutTagRecord);
+private:
+    uint32_t FindInHashBucket(std::string_view TypeName) const;
+    void BuildFallbackIndex() const;
+};
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "CodeView.h"
+#include "MSFFile.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class FThreadPool;
+
+///Header of the TPI and IPI streams
+struct FTypeStreamHeader {
+    uint32_t Version;
+    uint32_t HeaderSize;
+    uint32_t TypeIndexBegin;
+    uint32_t TypeIndexEnd;
+    uint32_t TypeRecordBytes;
+    uint16_t HashStreamIndex;
+    uint16_t HashAuxStreamIndex;
+    uint32_t HashKeySize;
+    uint32_t NumHashBuckets;
+    int32_t HashValueBufferOffset;
+    uint32_t HashValueBufferLength;
+    int32_t IndexOffsetBufferOffset;
+    uint32_t IndexOffsetBufferLength;
+    int32_t HashAdjBufferOffset;
+    uint32_t HashAdjBufferLength;
+};
+static_assert(sizeof(FTypeStreamHeader) == 56, "TPI stream header must be 56 bytes");
+
+///Entry of the IndexOffsetBuffer of the hash stream, mapping a type index to the offset of its record
+struct FTypeIndexOffset {
+    uint32_t TypeIndex;
+    uint32_t Offset;
+};
+
+/**
+ * Native reader of the TPI (or IPI) stream
+ * Keeps a flat array mapping every type index to the offset of its record inside of the mapped stream
+ * The array is filled lazily, one IndexOffsetBuffer chunk at a time, the first time any type from the chunk is requested,
+ * so looking up a type is an array access once its chunk has been seen, and no record is decoded until somebody asks for it
+ */
+class FPDBTypeStream {
+private:
+    FMSFStream Stream;
+    FMSFStream HashStream;
+    FTypeStreamHeader Header{};
+    std::span<const uint8_t> RecordData;
+    std::vector<FTypeIndexOffset> Chunks;
+    std::unique_ptr<std::atomic<uint32_t>[]> RecordOffsets;
+    std::unique_ptr<std::once_flag[]> ChunkDecodeFlags;
+    std::unique_ptr<bool[]> ChunkValidFlags;
+public:
+    ///Opens the type stream with the given index. Works for both the TPI and IPI streams as they share the format
+    bool Open(const FMSFFile& MSFFile, EPDBFixedStream StreamType, const FDumpLog& Log);
+
+    inline const FTypeStreamHeader& GetHeader() const {
+        return Header;
+    }
+
+    inline uint32_t GetTypeIndexBegin() const {
+        return Header.TypeIndexBegin;
+    }
+
+    inline uint32_t GetTypeIndexEnd() const {
+        return Header.TypeIndexEnd;
+    }
+
+    inline uint32_t GetNumTypeRecords() const {
+        return Header.TypeIndexEnd - Header.TypeIndexBegin;
+    }
+
+    inline bool IsValidTypeIndex(uint32_t TypeIndex) const {
+        return TypeIndex >= Header.TypeIndexBegin && TypeIndex < Header.TypeIndexEnd;
+    }
+
+    inline const FMSFStream& GetHashStream() const {
+        return HashStream;
+    }
+
+    ///Number of IndexOffsetBuffer chunks the record range is split into. Chunks can be decoded independently of each other
+    inline size_t GetNumChunks() const {
+        return Chunks.size();
+    }
+
+    ///Returns the range of type indices [Begin, End) covered by the given chunk
+    void GetChunkTypeIndexRange(size_t ChunkIndex, uint32_t& OutTypeIndexBegin, uint32_t& OutTypeIndexEnd) const;
+
+    ///Returns the record for the given type index, or an invalid record if the index is out of range or the record is malformed
+    FTypeRecord GetRecord(uint32_t TypeIndex) const;
+
+    /**
+     * Decodes the offsets of all of the records in the stream upfront
+     * Chunks are decoded and validated in parallel on the shared thread pool, each of them writing only its own slice
+     * of the offset table, so there is nothing to merge and no lock to take. Returns false if any chunk is malformed
+     */
+    bool BuildFullIndex() const;
+
+    ///Same as above, decoding the chunks on the given pool instead of the shared one
+    bool BuildFullIndex(FThreadPool& ThreadPool) const;
+
+    ///Lets the OS reclaim the pages of the stream once a linear pass over all of its records is done. Records remain accessible
+    inline void ReleaseResidentPages() const {
+        Stream.ReleaseResidentPages();
+        HashStream.ReleaseResidentPages();
+    }
+private:
+    size_t FindChunkForTypeIndex(uint32_t TypeIndex) const;
+    void DecodeChunkOnce(size_t ChunkIndex) const;
+    bool DecodeChunk(size_t ChunkIndex) const;
+    FTypeRecord GetRecordAtOffset(uint32_t Offset) const;
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+class FThreadPool;
+
+///Runs the task for every index in [0, NumTasks) on the shared work stealing thread pool, and waits for all of them to finish
+///Every index is a separate task, so uneven tasks still balance out between the threads
+void ParallelFor(size_t NumTasks, const std::function<void(size_t)>& Task);
+
+///Same as above, but runs the tasks on the given pool instead of the shared one, e.g. to compare the throughput at different thread counts
+void ParallelFor(FThreadPool& ThreadPool, size_t NumTasks, const std::function<void(size_t)>& Task);
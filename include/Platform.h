@@ -0,0 +1,14 @@
+#pragma once
+
+///Windows builds get these from the Windows headers. Everywhere else we provide the same macros,
+///so the portable parts of the generator can be written the same way as the DIA specific ones
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#ifndef TEXT
+#define TEXT(Text) L##Text
+#endif
+#ifndef FORCEINLINE
+#define FORCEINLINE inline __attribute__((always_inline))
+#endif
+#endif
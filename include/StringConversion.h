@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+///Converts the UTF-8 string into the wide string, used at the boundaries that still speak UTF-16, like DIA and the console output
+inline std::wstring ConvertUTF8ToWide(std::string_view String) {
+    std::wstring Result;
+    Result.reserve(String.size());
+
+    for (size_t i = 0; i < String.size();) {
+        const auto LeadByte = static_cast<uint8_t>(String[i]);
+        uint32_t CodePoint = LeadByte;
+        size_t SequenceLength = 1;
+
+        if (LeadByte >= 0xF0 && i + 3 < String.size()) {
+            CodePoint = ((LeadByte & 0x07) << 18) | ((String[i + 1] & 0x3F) << 12) | ((String[i + 2] & 0x3F) << 6) | (String[i + 3] & 0x3F);
+            SequenceLength = 4;
+        } else if (LeadByte >= 0xE0 && i + 2 < String.size()) {
+            CodePoint = ((LeadByte & 0x0F) << 12) | ((String[i + 1] & 0x3F) << 6) | (String[i + 2] & 0x3F);
+            SequenceLength = 3;
+        } else if (LeadByte >= 0xC0 && i + 1 < String.size()) {
+            CodePoint = ((LeadByte & 0x1F) << 6) | (String[i + 1] & 0x3F);
+            SequenceLength = 2;
+        }
+        i += SequenceLength;
+
+        ///wchar_t is 16-bit on Windows, so code points outside of the BMP need a surrogate pair there
+        if constexpr (sizeof(wchar_t) == 2) {
+            if (CodePoint >= 0x10000) {
+                CodePoint -= 0x10000;
+                Result.push_back(static_cast<wchar_t>(0xD800 + (CodePoint >> 10)));
+                Result.push_back(static_cast<wchar_t>(0xDC00 + (CodePoint & 0x3FF)));
+                continue;
+            }
+        }
+        Result.push_back(static_cast<wchar_t>(CodePoint));
+    }
+    return Result;
+}
+
+///Converts the wide string into UTF-8, used to pass the type names from TypesToDump.txt and the names coming from DIA to the layout generator
+inline std::string ConvertWideToUTF8(std::wstring_view String) {
+    std::string Result;
+    Result.reserve(String.size());
+
+    for (size_t i = 0; i < String.size(); i++) {
+        uint32_t CodePoint = static_cast<uint32_t>(String[i]);
+
+        if constexpr (sizeof(wchar_t) == 2) {
+            if (CodePoint >= 0xD800 && CodePoint < 0xDC00 && i + 1 < String.size()) {
+                CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (static_cast<uint32_t>(String[i + 1]) - 0xDC00);
+                i++;
+            }
+        }
+        if (CodePoint < 0x80) {
+            Result.push_back(static_cast<char>(CodePoint));
+        } else if (CodePoint < 0x800) {
+            Result.push_back(static_cast<char>(0xC0 | (CodePoint >> 6)));
+            Result.push_back(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+        } else if (CodePoint < 0x10000) {
+            Result.push_back(static_cast<char>(0xE0 | (CodePoint >> 12)));
+            Result.push_back(static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F)));
+            Result.push_back(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+        } else {
+            Result.push_back(static_cast<char>(0xF0 | (CodePoint >> 18)));
+            Result.push_back(static_cast<char>(0x80 | ((CodePoint >> 12) & 0x3F)));
+            Result.push_back(static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F)));
+            Result.push_back(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+        }
+    }
+    return Result;
+}
+
+///Converts the UTF-8 string into a path. Going through char8_t makes the conversion explicit, instead of using the ANSI code page on Windows
+inline std::filesystem::path ConvertUTF8ToPath(std::string_view String) {
+    return std::filesystem::path{std::u8string_view{reinterpret_cast<const char8_t*>(String.data()), String.size()}};
+}
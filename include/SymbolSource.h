@@ -0,0 +1,148 @@
+#pragma once
+
+#include "TypeDeclarationCache.h"
+#include "TypeLayout.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///Kinds of the symbols the layout generator works with. Mirrors the subset of the DIA symbol tags it needs
+enum class ESymbolTag : uint8_t {
+    Null,
+    UDT,
+    Enum,
+    BaseType,
+    PointerType,
+    ArrayType,
+    Typedef,
+    FunctionType,
+    FunctionArgType,
+    VTable,
+    BaseClass,
+    Data,
+    Function
+};
+
+///Built-in types. MSVC does not differentiate between long and int, and neither does UE, so there is a single signed and unsigned integer kind
+enum class EBasicType : uint8_t {
+    NoType,
+    Void,
+    Char,
+    WChar,
+    Bool,
+    Int,
+    UInt,
+    Float,
+    Char8,
+    Char16,
+    Char32
+};
+
+enum class EUDTKind : uint8_t {
+    Struct,
+    Class,
+    Union,
+    Interface
+};
+
+///Location of the data symbols. Only this relative variables and bitfields are members of the UDTs
+enum class EDataLocation : uint8_t {
+    Other,
+    ThisRelative,
+    BitField
+};
+
+///Opaque handle of a symbol of the symbol source. Handles are plain values, cheap to copy and only meaningful to the source that created them
+struct FSymbolHandle {
+    uint64_t Id{0};
+
+    inline bool IsValid() const {
+        return Id != 0;
+    }
+
+    inline bool operator==(const FSymbolHandle& Other) const {
+        return Id == Other.Id;
+    }
+};
+
+/**
+ * Properties of a single symbol, fetched in one call
+ * Only the properties that make sense for the symbol tag are filled, the rest keep their default values
+ */
+struct FSymbolInfo {
+    ESymbolTag Tag{ESymbolTag::Null};
+    ///Pointee of the pointers, element of the arrays, underlying type of the typedefs, return type of the function types,
+    ///type of the data members, function arguments and base classes, and function type of the functions
+    FSymbolHandle Type{};
+    ///Class the member function types and the virtual tables belong to
+    FSymbolHandle ClassParent{};
+    EBasicType BasicType{EBasicType::NoType};
+    EUDTKind UDTKind{EUDTKind::Struct};
+    EDataLocation Location{EDataLocation::Other};
+    EMemberAccess Access{EMemberAccess::Unspecified};
+    ///Size of the type in bytes, or the size of the bitfield in bits
+    uint64_t Length{0};
+    ///Offset of the data members and base classes in the object
+    int32_t Offset{0};
+    uint32_t BitPosition{0};
+    ///Number of the array elements, or the number of the virtual table entries for the UDTs
+    uint32_t Count{0};
+    ///Offset of the virtual functions in the virtual table
+    int32_t VirtualBaseOffset{0};
+    bool bIsConst{false};
+    bool bIsVolatile{false};
+    bool bIsReference{false};
+    bool bIsVirtual{false};
+    bool bIsIntroVirtual{false};
+    bool bIsPureVirtual{false};
+    bool bIsStatic{false};
+    bool bIsCompilerGenerated{false};
+    bool bHasConstructor{false};
+};
+
+/**
+ * Backend agnostic source of the symbols the type layouts are generated from
+ * The layout extraction and the declaration generation only talk to this interface, so they work the same
+ * on top of DIA, on top of the native debug info readers, or on top of the synthetic types built in memory
+ */
+class ISymbolSource {
+private:
+    mutable FTypeDeclarationCache DeclarationCache;
+public:
+    virtual ~ISymbolSource() = default;
+
+    ///Declarations generated for the types of this source so far, shared by all of the layouts generated from it
+    inline FTypeDeclarationCache& GetDeclarationCache() const {
+        return DeclarationCache;
+    }
+
+    ///Finds the user defined type with the given fully qualified UTF-8 name. Returns an invalid handle if there is no such type
+    virtual FSymbolHandle FindUserDefinedType(const std::string& TypeName) const = 0;
+
+    ///Retrieves the properties of the symbol. Returns false if the handle does not refer to a valid symbol
+    virtual bool GetSymbolInfo(FSymbolHandle Symbol, FSymbolInfo& OutInfo) const = 0;
+
+    ///Returns the UTF-8 name of the symbol, or an empty string if the symbol has no name
+    virtual std::string GetSymbolName(FSymbolHandle Symbol) const = 0;
+
+    ///Appends the direct children of the symbol with the given tag, in declaration order
+    ///UDTs have base class, data and function children, and function types have function argument children
+    virtual void GetChildren(FSymbolHandle Symbol, ESymbolTag ChildTag, std::vector<FSymbolHandle>& OutChildren) const = 0;
+
+    ///Retrieves the UTF-8 path of the source file and the line the type has been defined on. Returns false if the source does not record it
+    virtual bool GetSourceLine(FSymbolHandle /*Symbol*/, std::string& /*OutSourceFilePath*/, int32_t& /*OutLineNumber*/) const {
+        return false;
+    }
+
+    ///Fills the RVAs of the virtual table, the virtual functions and the constructors of the UDT
+    ///Returns false if the source does not know the RVAs, or if the virtual table of the UDT has not been found
+    virtual bool GenerateVirtualTableRVALayout(FSymbolHandle /*UDTSymbol*/, FVirtualTableRVALayout& /*OutLayout*/) const {
+        return false;
+    }
+
+    ///True if the source can be queried from several threads at the same time, so the layouts of the different types can be generated in parallel
+    ///COM based sources like DIA are bound to the thread that created them, so this is false unless the source opts in
+    virtual bool SupportsConcurrentAccess() const {
+        return false;
+    }
+};
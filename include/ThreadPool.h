@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+///Counts the outstanding tasks submitted as a group, so that the submitter can wait for all of them to finish
+class FTaskGroup {
+private:
+    std::atomic<size_t> NumPendingTasks{0};
+    friend class FThreadPool;
+public:
+    inline bool IsDone() const {
+        return NumPendingTasks.load(std::memory_order_acquire) == 0;
+    }
+};
+
+/**
+ * Work stealing thread pool. Every worker owns a task queue, takes the newest task from its own queue,
+ * and steals the oldest task from the queues of the other workers when it runs out of work
+ * Threads waiting for a task group execute the pending tasks themselves instead of blocking,
+ * so tasks can safely submit and wait for the nested task groups
+ */
+class FThreadPool {
+private:
+    struct FWorkerQueue {
+        std::mutex QueueMutex;
+        std::deque<std::function<void()>> Tasks;
+    };
+    std::vector<std::unique_ptr<FWorkerQueue>> WorkerQueues;
+    std::vector<std::thread> WorkerThreads;
+    std::atomic<size_t> NextSubmitQueue{0};
+    std::atomic<size_t> NumQueuedTasks{0};
+    std::mutex WakeUpMutex;
+    std::condition_variable WakeUpCondition;
+    std::atomic<bool> bShuttingDown{false};
+public:
+    explicit FThreadPool(size_t NumThreads);
+    ~FThreadPool();
+
+    FThreadPool(const FThreadPool&) = delete;
+    FThreadPool& operator=(const FThreadPool&) = delete;
+
+    ///Returns the shared pool sized to the number of cores of the machine
+    static FThreadPool& Get();
+
+    inline size_t GetNumThreads() const {
+        return WorkerThreads.size();
+    }
+
+    ///Queues the task for execution as a part of the given group
+    void Submit(FTaskGroup& TaskGroup, std::function<void()> Task);
+
+    ///Blocks until all of the tasks of the group have finished, running the queued tasks on the calling thread meanwhile
+    void Wait(FTaskGroup& TaskGroup);
+private:
+    void WorkerMain(size_t WorkerIndex);
+    bool TryRunQueuedTask(size_t PreferredQueueIndex);
+};
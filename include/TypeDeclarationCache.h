@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+///Declaration of a type as the member variables and the function signatures reference it, together with how the members of the type get initialized
+struct FCachedTypeDeclaration {
+    std::string Declaration{};
+    bool bIsUDT{false};
+    bool bNeedsValueInit{false};
+    std::string ValueInitDefaultValue{};
+    bool bNeedsNoInitConstructorCall{false};
+};
+
+/**
+ * Declarations generated for the types of a single session, keyed by the type identity (symbol id or type index)
+ * Common types like FString, TArray<...> or UObject* are referenced by the members and the function arguments of almost every class,
+ * so each of them is only walked once per session, and every further reference is a single hash lookup
+ * Safe to use from several threads at the same time. Entries are generated outside of the lock, so generating one may recurse into the cache,
+ * and when two threads race to generate the same entry the first one to finish is kept. Entries are never removed, so the returned references stay valid
+ */
+class FTypeDeclarationCache {
+private:
+    std::unordered_map<uint64_t, FCachedTypeDeclaration> Declarations;
+    ///Default values are only needed for the return types of the generated function bodies, so they are generated separately, on demand
+    std::unordered_map<uint64_t, std::string> DefaultValues;
+    mutable std::shared_mutex DeclarationsLock;
+    mutable std::shared_mutex DefaultValuesLock;
+public:
+    ///Returns the cached declaration of the type, generating it first if the type has not been seen yet
+    const FCachedTypeDeclaration& FindOrAddDeclaration(uint64_t TypeId, const std::function<void(FCachedTypeDeclaration&)>& GenerateDeclaration);
+
+    ///Returns the cached default value of the type, generating it first if the type has not been seen yet
+    const std::string& FindOrAddDefaultValue(uint64_t TypeId, const std::function<std::string()>& GenerateDefaultValue);
+};
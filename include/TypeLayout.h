@@ -0,0 +1,107 @@
+#pragma once
+
+#include "OutputFile.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class EMemberAccess {
+    Unspecified = 0,
+    Private = 1,
+    Protected = 2,
+    Public = 3
+};
+
+///All of the names, declarations and paths of the layouts are UTF-8, and are written into the generated headers as is
+struct FMemberVariable {
+    std::string VariableName{};
+    std::string VariableType{};
+    int32_t VariableOffset{0};
+    int32_t VariableSize{0};
+    EMemberAccess VariableAccess{EMemberAccess::Public};
+    bool bIsBitfield{false};
+    bool bIsArray{false};
+    bool bIsUDT{false};
+    int32_t BitfieldBitPosition{0};
+    int32_t BitfieldBitSize{0};
+    int32_t ArraySize{0};
+    /**
+     * True if the property needs value initialization.
+     * Value initialization is generally needed for all integral types and pointer types,
+     * and also for UDTs with no default constructor
+     * If you do not initialize these types explicitly, they will have garbage value
+     */
+    bool bNeedsValueInit{false};
+
+    /** Value to populate the variable with for default value init */
+    std::string ValueInitDefaultValue{};
+
+    /**
+     * True if the property needs the NoInit constructor call
+     * This is used to prevent the default initialization in places where it shouldn't happen
+     * and generally speaking constructor should do nothing
+     */
+    bool bNeedsNoInitConstructorCall{false};
+};
+
+struct FVirtualFunctionDeclaration {
+    std::string FunctionName{};
+    std::string FunctionDeclaration{};
+    int32_t VirtualTableOffset{0};
+    EMemberAccess FunctionAccess{EMemberAccess::Public};
+};
+
+struct FParentClassInfo {
+    std::string ClassName;
+    EMemberAccess ClassAccess{EMemberAccess::Unspecified};
+    int32_t ClassDataOffset{0};
+    int32_t ClassSize{0};
+    bool bHasConstructor{false};
+};
+
+struct FUserDefinedTypeLayout {
+    std::string ClassName{};
+    std::vector<FParentClassInfo> ParentClasses{};
+    std::vector<FMemberVariable> MemberVariables{};
+    std::vector<FVirtualFunctionDeclaration> VirtualFunctions{};
+    int32_t VirtualTableEntriesCount{0};
+    int32_t TotalTypeSize{0};
+    ///Header the type has been defined in, and the line of the definition. Empty if the PDB does not record it
+    std::string SourceFilePath{};
+    int32_t SourceLineNumber{0};
+};
+
+struct FVirtualFunctionRVA {
+    int32_t VirtualTableSlot{0};
+    std::string FunctionName{};
+    uint32_t FunctionRVA{0};
+};
+
+struct FVirtualTableRVALayout {
+    std::string ClassName{};
+    uint32_t VirtualTableRVA{0};
+    std::vector<FVirtualFunctionRVA> VirtualFunctions{};
+    std::vector<uint32_t> ConstructorRVAs{};
+};
+
+///Sanitizes CPP identifier by replacing :: with __, making it usable in filenames and macros
+std::string SanitizeCppIdentifier(const std::string& Identifier);
+
+///Writes the generated header with the layout macros of the given type into the output directory, unless it is already up to date
+void WriteTypeLayoutFile(FOutputDirectory& OutputDirectory, const FUserDefinedTypeLayout& TypeLayout);
+
+///Writes the generated header with the virtual table and virtual function RVAs of the given type next to its layout header
+void WriteVirtualTableRVAFile(FOutputDirectory& OutputDirectory, const FVirtualTableRVALayout& RVALayout);
+
+///Generated headers of a single type, as a section of the consolidated header
+struct FTypeLayoutSection {
+    std::string ClassName{};
+    std::string Contents{};
+};
+
+///Generates the section of the consolidated header with the layout macros and, if given, the RVAs of the type, under an include guard of its own
+std::string GenerateTypeLayoutSection(const FUserDefinedTypeLayout& TypeLayout, const FVirtualTableRVALayout* RVALayout);
+
+///Writes the sections of all of the dumped types into a single header, instead of a header or two per type
+///Header starts with an index of the byte offsets and the sizes of the sections, so the consumers can find a type without preprocessing the whole file
+void WriteConsolidatedLayoutFile(FOutputDirectory& OutputDirectory, const std::string& FileName, const std::string& DebugFileName, const std::vector<FTypeLayoutSection>& Sections);
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "SymbolSource.h"
+#include "TypeLayout.h"
+#include <string>
+
+///Generates the C++ declaration of the given type, e.g. "class UObject*" or "TIdentity<int32[4]>::Type"
+std::string GenerateTypeDeclarationForSymbol(const ISymbolSource& Source, FSymbolHandle TypeSymbol);
+
+///Fills the layout of the given UDT symbol: its base classes, member variables and intro virtual functions
+void GenerateUserDefinedTypeLayout(const ISymbolSource& Source, FSymbolHandle UDTSymbol, FUserDefinedTypeLayout& OutLayout);
+
+///Looks up the UDT with the given name in the symbol source and writes its layout file. Returns false if the type does not exist
+bool GenerateTypeLayoutFile(FOutputDirectory& OutputDirectory, const ISymbolSource& Source, const std::string& UDTName);
+
+///Writes the layout file of the UDT already found in the symbol source
+void GenerateTypeLayoutFile(FOutputDirectory& OutputDirectory, const ISymbolSource& Source, FSymbolHandle UDTSymbol);
@@ -0,0 +1,438 @@
+#include "AsyncFileWriter.h"
+#include "OutputFile.h"
+#include <algorithm>
+#include <vector>
+
+#ifdef __linux__
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+///Most files taken from the queue and written at once
+static constexpr size_t MaxBatchSize = 64;
+
+///Files are written next to their final path and renamed over it once complete, so a failed write never leaves a truncated file behind
+static std::filesystem::path GetTemporaryFilePath(const std::filesystem::path& FilePath) {
+    std::filesystem::path TemporaryFilePath = FilePath;
+    TemporaryFilePath += ".tmp";
+    return TemporaryFilePath;
+}
+
+///Renames the written temporary file over the file, or removes it if it has not been written in full. Returns true if the file has been replaced
+static bool CommitTemporaryFile(const std::filesystem::path& TemporaryFilePath, const std::filesystem::path& FilePath, bool bWritten) {
+    std::error_code ErrorCode;
+    if (bWritten) {
+        std::filesystem::rename(TemporaryFilePath, FilePath, ErrorCode);
+        if (!ErrorCode) {
+            return true;
+        }
+    }
+    std::filesystem::remove(TemporaryFilePath, ErrorCode);
+    return false;
+}
+
+#ifdef __linux__
+///Single write submitted for a file is capped to this size, the length of the io_uring write being 32-bit
+static constexpr size_t MaxWriteChunkSize = 1u << 30;
+
+/**
+ * Minimal io_uring set up through the raw system calls, implementing only as much as writing the batches of files needs
+ * Every file of the batch has at most one write in flight, so the rings sized to the batch can never overflow
+ */
+class FIoUring {
+private:
+    int RingFileDescriptor{-1};
+    void* SubmissionRing{MAP_FAILED};
+    size_t SubmissionRingSize{0};
+    void* CompletionRing{MAP_FAILED};
+    size_t CompletionRingSize{0};
+    void* SubmissionEntries{MAP_FAILED};
+    size_t SubmissionEntriesSize{0};
+    uint32_t* SubmissionTail{nullptr};
+    uint32_t SubmissionRingMask{0};
+    uint32_t* SubmissionArray{nullptr};
+    uint32_t* CompletionHead{nullptr};
+    uint32_t* CompletionTail{nullptr};
+    uint32_t CompletionRingMask{0};
+    io_uring_cqe* CompletionEntries{nullptr};
+    uint32_t NumUnsubmittedEntries{0};
+public:
+    FIoUring() = default;
+    ~FIoUring();
+
+    FIoUring(const FIoUring&) = delete;
+    FIoUring& operator=(const FIoUring&) = delete;
+
+    ///Sets up the ring. Returns false if io_uring is not available, e.g. on the old kernels or when it is blocked by seccomp
+    bool Initialize(uint32_t NumEntries);
+
+    inline bool IsInitialized() const {
+        return RingFileDescriptor != -1;
+    }
+
+    ///Queues the write of the data at the offset of the file. The user data identifies the write in its completion
+    void QueueWrite(int FileDescriptor, const char* Data, uint32_t Size, uint64_t Offset, uint64_t UserData);
+
+    ///Submits the queued writes and waits for at least one write to complete. Returns false if the ring cannot be used anymore
+    bool SubmitAndWait();
+
+    ///Waits for at least one of the submitted writes to complete, without submitting the queued ones. Returns false if the ring cannot be waited on
+    bool Wait();
+
+    ///Writes queued since the last successful submission. The kernel has not seen them, so they never complete
+    inline uint32_t GetNumUnsubmittedEntries() const {
+        return NumUnsubmittedEntries;
+    }
+
+    ///Calls the callback with the user data and the result of every completed write, the number of bytes written or the negated errno
+    template<typename CallbackType>
+    void ReapCompletions(const CallbackType& Callback) {
+        uint32_t Head = *CompletionHead;
+        const uint32_t Tail = std::atomic_ref<uint32_t>{*CompletionTail}.load(std::memory_order_acquire);
+        for (; Head != Tail; Head++) {
+            const io_uring_cqe& Completion = CompletionEntries[Head & CompletionRingMask];
+            Callback(Completion.user_data, Completion.res);
+        }
+        std::atomic_ref<uint32_t>{*CompletionHead}.store(Head, std::memory_order_release);
+    }
+
+    void Reset();
+};
+
+FIoUring::~FIoUring() {
+    Reset();
+}
+
+bool FIoUring::Initialize(uint32_t NumEntries) {
+    io_uring_params Params{};
+    const long FileDescriptor = syscall(__NR_io_uring_setup, NumEntries, &Params);
+    if (FileDescriptor < 0) {
+        return false;
+    }
+    RingFileDescriptor = static_cast<int>(FileDescriptor);
+
+    SubmissionRingSize = Params.sq_off.array + Params.sq_entries * sizeof(uint32_t);
+    CompletionRingSize = Params.cq_off.cqes + Params.cq_entries * sizeof(io_uring_cqe);
+    ///Newer kernels map both of the rings with a single mapping
+    const bool bSingleMapping = (Params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (bSingleMapping) {
+        SubmissionRingSize = CompletionRingSize = std::max(SubmissionRingSize, CompletionRingSize);
+    }
+    SubmissionRing = mmap(nullptr, SubmissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFileDescriptor, IORING_OFF_SQ_RING);
+    if (SubmissionRing == MAP_FAILED) {
+        Reset();
+        return false;
+    }
+    CompletionRing = bSingleMapping ? SubmissionRing : mmap(nullptr, CompletionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFileDescriptor, IORING_OFF_CQ_RING);
+    SubmissionEntriesSize = Params.sq_entries * sizeof(io_uring_sqe);
+    SubmissionEntries = mmap(nullptr, SubmissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFileDescriptor, IORING_OFF_SQES);
+    if (CompletionRing == MAP_FAILED || SubmissionEntries == MAP_FAILED) {
+        Reset();
+        return false;
+    }
+
+    auto* SubmissionRingData = static_cast<uint8_t*>(SubmissionRing);
+    SubmissionTail = reinterpret_cast<uint32_t*>(SubmissionRingData + Params.sq_off.tail);
+    SubmissionRingMask = *reinterpret_cast<const uint32_t*>(SubmissionRingData + Params.sq_off.ring_mask);
+    SubmissionArray = reinterpret_cast<uint32_t*>(SubmissionRingData + Params.sq_off.array);
+
+    auto* CompletionRingData = static_cast<uint8_t*>(CompletionRing);
+    CompletionHead = reinterpret_cast<uint32_t*>(CompletionRingData + Params.cq_off.head);
+    CompletionTail = reinterpret_cast<uint32_t*>(CompletionRingData + Params.cq_off.tail);
+    CompletionRingMask = *reinterpret_cast<const uint32_t*>(CompletionRingData + Params.cq_off.ring_mask);
+    CompletionEntries = reinterpret_cast<io_uring_cqe*>(CompletionRingData + Params.cq_off.cqes);
+    return true;
+}
+
+void FIoUring::QueueWrite(int FileDescriptor, const char* Data, uint32_t Size, uint64_t Offset, uint64_t UserData) {
+    ///Only this thread produces the submissions, so the tail can be read without synchronization
+    const uint32_t Tail = *SubmissionTail;
+    const uint32_t EntryIndex = Tail & SubmissionRingMask;
+
+    io_uring_sqe& Entry = static_cast<io_uring_sqe*>(SubmissionEntries)[EntryIndex];
+    std::memset(&Entry, 0, sizeof(Entry));
+    Entry.opcode = IORING_OP_WRITE;
+    Entry.fd = FileDescriptor;
+    Entry.addr = reinterpret_cast<uint64_t>(Data);
+    Entry.len = Size;
+    Entry.off = Offset;
+    Entry.user_data = UserData;
+    SubmissionArray[EntryIndex] = EntryIndex;
+
+    std::atomic_ref<uint32_t>{*SubmissionTail}.store(Tail + 1, std::memory_order_release);
+    NumUnsubmittedEntries++;
+}
+
+bool FIoUring::SubmitAndWait() {
+    while (true) {
+        const long Result = syscall(__NR_io_uring_enter, RingFileDescriptor, NumUnsubmittedEntries, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+        if (Result >= 0) {
+            NumUnsubmittedEntries -= static_cast<uint32_t>(Result);
+            return true;
+        }
+        ///The completion ring is full or the kernel is short on memory, reaping the completions makes room for the submissions
+        if (errno == EAGAIN || errno == EBUSY) {
+            return true;
+        }
+        if (errno != EINTR) {
+            return false;
+        }
+    }
+}
+
+bool FIoUring::Wait() {
+    while (true) {
+        const long Result = syscall(__NR_io_uring_enter, RingFileDescriptor, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+        if (Result >= 0) {
+            return true;
+        }
+        if (errno != EINTR) {
+            return false;
+        }
+    }
+}
+
+void FIoUring::Reset() {
+    if (SubmissionEntries != MAP_FAILED) {
+        munmap(SubmissionEntries, SubmissionEntriesSize);
+    }
+    if (CompletionRing != MAP_FAILED && CompletionRing != SubmissionRing) {
+        munmap(CompletionRing, CompletionRingSize);
+    }
+    if (SubmissionRing != MAP_FAILED) {
+        munmap(SubmissionRing, SubmissionRingSize);
+    }
+    if (RingFileDescriptor != -1) {
+        close(RingFileDescriptor);
+    }
+    RingFileDescriptor = -1;
+    SubmissionRing = CompletionRing = SubmissionEntries = MAP_FAILED;
+    NumUnsubmittedEntries = 0;
+}
+
+///File of the batch being written through io_uring
+struct FBatchWrite {
+    int FileDescriptor{-1};
+    std::string_view Contents;
+    size_t NumBytesWritten{0};
+    ///Write has been queued on the ring and its completion has not been reaped yet, so the kernel may still be using the buffer and the file
+    bool bInFlight{false};
+    bool bCompleted{false};
+    bool bSucceeded{false};
+};
+
+///Outcome of writing the batch through io_uring
+enum class EBatchWriteResult : uint8_t {
+    ///Every write has completed, and the ring can be used for the next batch
+    Completed,
+    ///Every write has completed, but the ring has failed and should not be used anymore
+    RingFailed,
+    ///Ring has failed while the writes were in flight, and could not be waited on. Their buffers and files have to outlive the ring
+    WritesAbandoned,
+};
+
+///Writes the rest of the contents starting at the given offset with the blocking writes
+static bool WriteRemainingContents(int FileDescriptor, std::string_view Contents, size_t Offset) {
+    while (Offset < Contents.size()) {
+        const ssize_t NumBytesWritten = pwrite(FileDescriptor, Contents.data() + Offset, Contents.size() - Offset, static_cast<off_t>(Offset));
+        if (NumBytesWritten < 0 && errno == EINTR) {
+            continue;
+        }
+        if (NumBytesWritten <= 0) {
+            return false;
+        }
+        Offset += static_cast<size_t>(NumBytesWritten);
+    }
+    return true;
+}
+
+/**
+ * Writes all of the opened files of the batch with a single submission, resubmitting the rest of the files written partially
+ * When the ring fails, the writes the kernel already has are waited for before the rest of the files is written with the blocking writes,
+ * as the buffers and the files of the batch are released as soon as this returns
+ */
+static EBatchWriteResult WriteBatchWithIoUring(FIoUring& IoUring, std::vector<FBatchWrite>& Writes) {
+    size_t NumWritesInFlight = 0;
+    const auto QueueNextChunk = [&](size_t WriteIndex) {
+        FBatchWrite& Write = Writes[WriteIndex];
+        const size_t ChunkSize = std::min(Write.Contents.size() - Write.NumBytesWritten, MaxWriteChunkSize);
+        IoUring.QueueWrite(Write.FileDescriptor, Write.Contents.data() + Write.NumBytesWritten, static_cast<uint32_t>(ChunkSize), Write.NumBytesWritten, WriteIndex);
+        Write.bInFlight = true;
+        NumWritesInFlight++;
+    };
+    for (size_t WriteIndex = 0; WriteIndex < Writes.size(); WriteIndex++) {
+        FBatchWrite& Write = Writes[WriteIndex];
+        if (Write.FileDescriptor == -1) {
+            Write.bCompleted = true;
+        } else if (Write.Contents.empty()) {
+            Write.bCompleted = Write.bSucceeded = true;
+        } else {
+            QueueNextChunk(WriteIndex);
+        }
+    }
+
+    bool bIoUringUsable = true;
+    bool bDraining = false;
+    while (NumWritesInFlight != 0) {
+        if (!bDraining && !IoUring.SubmitAndWait()) {
+            bIoUringUsable = false;
+            bDraining = true;
+        }
+        if (bDraining) {
+            ///Queued writes the kernel has not taken never complete, only the submitted ones are waited for
+            if (NumWritesInFlight == IoUring.GetNumUnsubmittedEntries()) {
+                break;
+            }
+            if (!IoUring.Wait()) {
+                return EBatchWriteResult::WritesAbandoned;
+            }
+        }
+        IoUring.ReapCompletions([&](uint64_t WriteIndex, int32_t Result) {
+            FBatchWrite& Write = Writes[WriteIndex];
+            Write.bInFlight = false;
+            NumWritesInFlight--;
+
+            if (Result > 0) {
+                Write.NumBytesWritten += static_cast<size_t>(Result);
+            }
+            if (Write.NumBytesWritten == Write.Contents.size()) {
+                Write.bCompleted = Write.bSucceeded = true;
+                return;
+            }
+            ///Failed ring takes no more submissions, the rest of the file is written with the blocking writes once the ring is drained
+            if (bDraining) {
+                return;
+            }
+            if (Result > 0 || Result == -EINTR || Result == -EAGAIN) {
+                QueueNextChunk(WriteIndex);
+                return;
+            }
+            ///Kernels before 5.6 reject IORING_OP_WRITE, and the real errors like ENOSPC are reported by the blocking write the same way
+            Write.bSucceeded = WriteRemainingContents(Write.FileDescriptor, Write.Contents, Write.NumBytesWritten);
+            Write.bCompleted = true;
+            bIoUringUsable &= Result != -EINVAL;
+        });
+    }
+
+    ///Writes cut short by the failed ring, none of which the kernel is using anymore
+    for (FBatchWrite& Write : Writes) {
+        if (!Write.bCompleted) {
+            Write.bInFlight = false;
+            Write.bSucceeded = WriteRemainingContents(Write.FileDescriptor, Write.Contents, Write.NumBytesWritten);
+            Write.bCompleted = true;
+        }
+    }
+    return bIoUringUsable ? EBatchWriteResult::Completed : EBatchWriteResult::RingFailed;
+}
+#endif
+
+FAsyncFileWriter::FAsyncFileWriter(size_t InMaxQueuedBytes) : MaxQueuedBytes(InMaxQueuedBytes) {
+    WriterThread = std::thread{[this]() { WriterMain(); }};
+}
+
+FAsyncFileWriter::~FAsyncFileWriter() {
+    {
+        std::lock_guard Lock{QueueMutex};
+        bShuttingDown = true;
+    }
+    QueueNotEmptyCondition.notify_all();
+    WriterThread.join();
+}
+
+FAsyncFileWriter& FAsyncFileWriter::Get() {
+    static FAsyncFileWriter SharedFileWriter{64 * 1024 * 1024};
+    return SharedFileWriter;
+}
+
+void FAsyncFileWriter::WriteFile(std::filesystem::path FilePath, std::string Contents, FWriteCompletion OnCompleted) {
+    const size_t NumBytes = Contents.size();
+    {
+        std::unique_lock Lock{QueueMutex};
+        QueueNotFullCondition.wait(Lock, [&]() {
+            return NumQueuedBytes == 0 || NumQueuedBytes + NumBytes <= MaxQueuedBytes;
+        });
+        NumQueuedBytes += NumBytes;
+        QueuedFiles.push_back(FQueuedFile{std::move(FilePath), std::move(Contents), std::move(OnCompleted)});
+    }
+    QueueNotEmptyCondition.notify_one();
+}
+
+void FAsyncFileWriter::WriterMain() {
+#ifdef __linux__
+    ///Buffers of the writes abandoned on a failed ring are kept until the ring is gone. Declared first, so they are released after it
+    std::vector<std::string> AbandonedBuffers;
+    FIoUring IoUring;
+    IoUring.Initialize(MaxBatchSize);
+#endif
+    std::vector<FQueuedFile> Batch;
+    Batch.reserve(MaxBatchSize);
+
+    while (true) {
+        size_t NumBatchBytes = 0;
+        {
+            std::unique_lock Lock{QueueMutex};
+            QueueNotEmptyCondition.wait(Lock, [&]() {
+                return bShuttingDown || !QueuedFiles.empty();
+            });
+            ///Files queued before the shutdown are still written
+            if (QueuedFiles.empty()) {
+                return;
+            }
+            while (!QueuedFiles.empty() && Batch.size() < MaxBatchSize) {
+                NumBatchBytes += QueuedFiles.front().Contents.size();
+                Batch.push_back(std::move(QueuedFiles.front()));
+                QueuedFiles.pop_front();
+            }
+        }
+
+#ifdef __linux__
+        if (IoUring.IsInitialized()) {
+            ///Files are opened on this thread, only the writes themselves go through the ring
+            std::vector<FBatchWrite> Writes(Batch.size());
+            for (size_t FileIndex = 0; FileIndex < Batch.size(); FileIndex++) {
+                Writes[FileIndex].FileDescriptor = open(GetTemporaryFilePath(Batch[FileIndex].FilePath).c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+                Writes[FileIndex].Contents = Batch[FileIndex].Contents;
+            }
+            const EBatchWriteResult Result = WriteBatchWithIoUring(IoUring, Writes);
+            if (Result != EBatchWriteResult::Completed) {
+                IoUring.Reset();
+            }
+            for (size_t FileIndex = 0; FileIndex < Batch.size(); FileIndex++) {
+                const FBatchWrite& Write = Writes[FileIndex];
+                const std::filesystem::path TemporaryFilePath = GetTemporaryFilePath(Batch[FileIndex].FilePath);
+                ///Kernel may still write into the file descriptor of the abandoned write, so it is never closed and cannot be reused for another file
+                if (Write.bInFlight) {
+                    AbandonedBuffers.push_back(std::move(Batch[FileIndex].Contents));
+                    CommitTemporaryFile(TemporaryFilePath, Batch[FileIndex].FilePath, false);
+                    Batch[FileIndex].OnCompleted(false);
+                    continue;
+                }
+                bool bSucceeded = Write.bCompleted && Write.bSucceeded;
+                if (Write.FileDescriptor != -1) {
+                    bSucceeded &= close(Write.FileDescriptor) == 0;
+                }
+                Batch[FileIndex].OnCompleted(CommitTemporaryFile(TemporaryFilePath, Batch[FileIndex].FilePath, bSucceeded));
+            }
+        } else
+#endif
+        {
+            for (FQueuedFile& QueuedFile : Batch) {
+                const std::filesystem::path TemporaryFilePath = GetTemporaryFilePath(QueuedFile.FilePath);
+                QueuedFile.OnCompleted(CommitTemporaryFile(TemporaryFilePath, QueuedFile.FilePath, WriteFileContents(TemporaryFilePath, QueuedFile.Contents)));
+            }
+        }
+        Batch.clear();
+
+        {
+            std::lock_guard Lock{QueueMutex};
+            NumQueuedBytes -= NumBatchBytes;
+        }
+        QueueNotFullCondition.notify_all();
+    }
+}
@@ -0,0 +1,261 @@
+#include "CodeView.h"
+#include "BinaryReader.h"
+
+bool ReadNumericLeaf(std::span<const uint8_t> Data, size_t& InOutPosition, uint64_t& OutValue) {
+    FBinaryReader Reader{Data, InOutPosition};
+    uint16_t LeafValue = 0;
+    if (!Reader.Read(LeafValue)) {
+        return false;
+    }
+
+    ///Values below LF_NUMERIC are stored inline
+    if (LeafValue < static_cast<uint16_t>(ENumericLeaf::Char)) {
+        OutValue = LeafValue;
+        InOutPosition = Reader.GetPosition();
+        return true;
+    }
+
+    bool bSucceeded = false;
+    switch (static_cast<ENumericLeaf>(LeafValue)) {
+        case ENumericLeaf::Char: {
+            int8_t Value = 0;
+            bSucceeded = Reader.Read(Value);
+            OutValue = static_cast<uint64_t>(static_cast<int64_t>(Value));
+            break;
+        }
+        case ENumericLeaf::Short: {
+            int16_t Value = 0;
+            bSucceeded = Reader.Read(Value);
+            OutValue = static_cast<uint64_t>(static_cast<int64_t>(Value));
+            break;
+        }
+        case ENumericLeaf::UShort: {
+            uint16_t Value = 0;
+            bSucceeded = Reader.Read(Value);
+            OutValue = Value;
+            break;
+        }
+        case ENumericLeaf::Long: {
+            int32_t Value = 0;
+            bSucceeded = Reader.Read(Value);
+            OutValue = static_cast<uint64_t>(static_cast<int64_t>(Value));
+            break;
+        }
+        case ENumericLeaf::ULong: {
+            uint32_t Value = 0;
+            bSucceeded = Reader.Read(Value);
+            OutValue = Value;
+            break;
+        }
+        case ENumericLeaf::Quadword:
+        case ENumericLeaf::UQuadword: {
+            uint64_t Value = 0;
+            bSucceeded = Reader.Read(Value);
+            OutValue = Value;
+            break;
+        }
+        default:
+            ///Floating point and variable length numeric leaves never appear in the records we decode
+            return false;
+    }
+    if (bSucceeded) {
+        InOutPosition = Reader.GetPosition();
+    }
+    return bSucceeded;
+}
+
+bool IsTagRecordKind(ELeafKind Kind) {
+    return Kind == ELeafKind::Class || Kind == ELeafKind::Structure || Kind == ELeafKind::Interface ||
+           Kind == ELeafKind::Union || Kind == ELeafKind::Enum;
+}
+
+bool DecodeModifierRecord(const FTypeRecord& Record, FModifierRecord& OutRecord) {
+    FBinaryReader Reader{Record.Data};
+    return Record.Kind == ELeafKind::Modifier && Reader.Read(OutRecord.ModifiedType) && Reader.Read(OutRecord.Modifiers);
+}
+
+bool DecodePointerRecord(const FTypeRecord& Record, FPointerRecord& OutRecord) {
+    FBinaryReader Reader{Record.Data};
+    if (Record.Kind != ELeafKind::Pointer || !Reader.Read(OutRecord.ReferentType) || !Reader.Read(OutRecord.Attributes)) {
+        return false;
+    }
+    ///Pointers to members additionally store the class they are pointing into
+    const EPointerMode PointerMode = OutRecord.GetMode();
+    if (PointerMode == EPointerMode::PointerToDataMember || PointerMode == EPointerMode::PointerToMemberFunction) {
+        return Reader.Read(OutRecord.ContainingClass);
+    }
+    OutRecord.ContainingClass = 0;
+    return true;
+}
+
+bool DecodeProcedureRecord(const FTypeRecord& Record, FProcedureRecord& OutRecord) {
+    FBinaryReader Reader{Record.Data};
+    OutRecord = FProcedureRecord{};
+
+    if (Record.Kind == ELeafKind::Procedure) {
+        return Reader.Read(OutRecord.ReturnType) && Reader.Read(OutRecord.CallingConvention) &&
+               Reader.Read(OutRecord.Options) && Reader.Read(OutRecord.ParameterCount) &&
+               Reader.Read(OutRecord.ArgumentList);
+    }
+    if (Record.Kind == ELeafKind::MemberFunction) {
+        return Reader.Read(OutRecord.ReturnType) && Reader.Read(OutRecord.ClassType) &&
+               Reader.Read(OutRecord.ThisType) && Reader.Read(OutRecord.CallingConvention) &&
+               Reader.Read(OutRecord.Options) && Reader.Read(OutRecord.ParameterCount) &&
+               Reader.Read(OutRecord.ArgumentList) && Reader.Read(OutRecord.ThisAdjustment);
+    }
+    return false;
+}
+
+bool DecodeArgumentListRecord(const FTypeRecord& Record, FArgumentListRecord& OutRecord) {
+    FBinaryReader Reader{Record.Data};
+    if (Record.Kind != ELeafKind::ArgumentList || !Reader.Read(OutRecord.ArgumentCount)) {
+        return false;
+    }
+    return Reader.ReadBytes(static_cast<size_t>(OutRecord.ArgumentCount) * sizeof(uint32_t), OutRecord.ArgumentTypes);
+}
+
+bool DecodeArrayRecord(const FTypeRecord& Record, FArrayRecord& OutRecord) {
+    FBinaryReader Reader{Record.Data};
+    if (Record.Kind != ELeafKind::Array || !Reader.Read(OutRecord.ElementType) || !Reader.Read(OutRecord.IndexType)) {
+        return false;
+    }
+    size_t Position = Reader.GetPosition();
+    if (!ReadNumericLeaf(Record.Data, Position, OutRecord.Size) || !Reader.Seek(Position)) {
+        return false;
+    }
+    return Reader.ReadCString(OutRecord.Name);
+}
+
+bool DecodeTagRecord(const FTypeRecord& Record, FTagRecord& OutRecord) {
+    FBinaryReader Reader{Record.Data};
+    OutRecord = FTagRecord{};
+    OutRecord.Kind = Record.Kind;
+
+    if (!Reader.Read(OutRecord.MemberCount) || !Reader.Read(OutRecord.Options)) {
+        return false;
+    }
+
+    switch (Record.Kind) {
+        case ELeafKind::Class:
+        case ELeafKind::Structure:
+        case ELeafKind::Interface: {
+            if (!Reader.Read(OutRecord.FieldList) || !Reader.Read(OutRecord.DerivedFrom) || !Reader.Read(OutRecord.VTableShape)) {
+                return false;
+            }
+            size_t Position = Reader.GetPosition();
+            if (!ReadNumericLeaf(Record.Data, Position, OutRecord.Size) || !Reader.Seek(Position)) {
+                return false;
+            }
+            break;
+        }
+        case ELeafKind::Union: {
+            if (!Reader.Read(OutRecord.FieldList)) {
+                return false;
+            }
+            size_t Position = Reader.GetPosition();
+            if (!ReadNumericLeaf(Record.Data, Position, OutRecord.Size) || !Reader.Seek(Position)) {
+                return false;
+            }
+            break;
+        }
+        case ELeafKind::Enum: {
+            if (!Reader.Read(OutRecord.UnderlyingType) || !Reader.Read(OutRecord.FieldList)) {
+                return false;
+            }
+            break;
+        }
+        default:
+            return false;
+    }
+
+    if (!Reader.ReadCString(OutRecord.Name)) {
+        return false;
+    }
+    if ((OutRecord.Options & CO_HasUniqueName) != 0) {
+        ///Unique name is optional, and some producers omit it despite setting the flag
+        Reader.ReadCString(OutRecord.UniqueName);
+    }
+    return true;
+}
+
+bool DecodeBitFieldRecord(const FTypeRecord& Record, FBitFieldRecord& OutRecord) {
+    FBinaryReader Reader{Record.Data};
+    return Record.Kind == ELeafKind::BitField && Reader.Read(OutRecord.Type) &&
+           Reader.Read(OutRecord.BitLength) && Reader.Read(OutRecord.BitPosition);
+}
+
+bool DecodeVTableShapeRecord(const FTypeRecord& Record, uint16_t& OutEntryCount) {
+    FBinaryReader Reader{Record.Data};
+    return Record.Kind == ELeafKind::VTableShape && Reader.Read(OutEntryCount);
+}
+
+bool DecodeUDTSourceLineRecord(const FTypeRecord& Record, FUDTSourceLineRecord& OutRecord) {
+    FBinaryReader Reader{Record.Data};
+    if ((Record.Kind != ELeafKind::UDTSourceLine && Record.Kind != ELeafKind::UDTModuleSourceLine) ||
+        !Reader.Read(OutRecord.UDT) || !Reader.Read(OutRecord.SourceFile) || !Reader.Read(OutRecord.LineNumber)) {
+        return false;
+    }
+    return Record.Kind == ELeafKind::UDTSourceLine || Reader.Read(OutRecord.Module);
+}
+
+bool DecodeStringIdRecord(const FTypeRecord& Record, FStringIdRecord& OutRecord) {
+    FBinaryReader Reader{Record.Data};
+    return Record.Kind == ELeafKind::StringId && Reader.Read(OutRecord.SubstringList) && Reader.ReadCString(OutRecord.String);
+}
+
+bool ReadSymbolRecord(std::span<const uint8_t> Data, size_t& InOutPosition, FSymbolRecord& OutRecord) {
+    ///Positions come from the hash tables and the address maps too, so they are not trusted to be within the data
+    if (InOutPosition >= Data.size()) {
+        return false;
+    }
+    FBinaryReader Reader{Data, InOutPosition};
+    uint16_t RecordLength = 0;
+    uint16_t RecordKind = 0;
+
+    ///Record length covers the kind field but not the length field itself
+    if (!Reader.Read(RecordLength) || RecordLength < sizeof(uint16_t) || !Reader.Read(RecordKind) ||
+        !Reader.ReadBytes(RecordLength - sizeof(uint16_t), OutRecord.Data)) {
+        return false;
+    }
+    OutRecord.Kind = static_cast<ESymbolKind>(RecordKind);
+    InOutPosition = Reader.GetPosition();
+    return true;
+}
+
+bool GetSymbolName(const FSymbolRecord& Record, std::string_view& OutName) {
+    FBinaryReader Reader{Record.Data};
+    switch (Record.Kind) {
+        ///S_PUB32, S_GDATA32 and S_LDATA32 have the flags or the type, the offset and the section before the name
+        ///S_PROCREF and S_LPROCREF have the name checksum, the symbol offset and the module index in the same place
+        case ESymbolKind::PublicSymbol:
+        case ESymbolKind::GlobalData:
+        case ESymbolKind::LocalData:
+        case ESymbolKind::ProcedureReference:
+        case ESymbolKind::LocalProcedureReference:
+            return Reader.Skip(sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint16_t)) && Reader.ReadCString(OutName);
+        case ESymbolKind::UserDefinedType:
+            return Reader.Skip(sizeof(uint32_t)) && Reader.ReadCString(OutName);
+        case ESymbolKind::Constant: {
+            uint64_t Value = 0;
+            size_t Position = sizeof(uint32_t);
+            return ReadNumericLeaf(Record.Data, Position, Value) && Reader.Seek(Position) && Reader.ReadCString(OutName);
+        }
+        default:
+            return false;
+    }
+}
+
+bool DecodeProcedureSymbol(const FSymbolRecord& Record, FProcedureSymbol& OutSymbol) {
+    FBinaryReader Reader{Record.Data};
+    return (Record.Kind == ESymbolKind::GlobalProcedure || Record.Kind == ESymbolKind::LocalProcedure) &&
+           Reader.Read(OutSymbol.Parent) && Reader.Read(OutSymbol.End) && Reader.Read(OutSymbol.Next) &&
+           Reader.Read(OutSymbol.CodeSize) && Reader.Read(OutSymbol.DebugStart) && Reader.Read(OutSymbol.DebugEnd) &&
+           Reader.Read(OutSymbol.FunctionType) && Reader.Read(OutSymbol.Offset) && Reader.Read(OutSymbol.Section) &&
+           Reader.Read(OutSymbol.Flags) && Reader.ReadCString(OutSymbol.Name);
+}
+
+bool DecodePublicSymbol(const FSymbolRecord& Record, FPublicSymbol& OutSymbol) {
+    FBinaryReader Reader{Record.Data};
+    return Record.Kind == ESymbolKind::PublicSymbol && Reader.Read(OutSymbol.Flags) && Reader.Read(OutSymbol.Offset) &&
+           Reader.Read(OutSymbol.Section) && Reader.ReadCString(OutSymbol.Name);
+}
@@ -0,0 +1,227 @@
+#include "DiaSymbolSource.h"
+#include "StringConversion.h"
+
+static ESymbolTag ConvertSymbolTag(DWORD SymbolTag) {
+    switch (SymbolTag) {
+        case SymTagUDT: return ESymbolTag::UDT;
+        case SymTagEnum: return ESymbolTag::Enum;
+        case SymTagBaseType: return ESymbolTag::BaseType;
+        case SymTagPointerType: return ESymbolTag::PointerType;
+        case SymTagArrayType: return ESymbolTag::ArrayType;
+        case SymTagTypedef: return ESymbolTag::Typedef;
+        case SymTagFunctionType: return ESymbolTag::FunctionType;
+        case SymTagFunctionArgType: return ESymbolTag::FunctionArgType;
+        case SymTagVTable: return ESymbolTag::VTable;
+        case SymTagBaseClass: return ESymbolTag::BaseClass;
+        case SymTagData: return ESymbolTag::Data;
+        case SymTagFunction: return ESymbolTag::Function;
+        default: return ESymbolTag::Null;
+    }
+}
+
+static enum SymTagEnum ConvertToDiaSymbolTag(ESymbolTag SymbolTag) {
+    switch (SymbolTag) {
+        case ESymbolTag::UDT: return SymTagUDT;
+        case ESymbolTag::Enum: return SymTagEnum;
+        case ESymbolTag::BaseType: return SymTagBaseType;
+        case ESymbolTag::PointerType: return SymTagPointerType;
+        case ESymbolTag::ArrayType: return SymTagArrayType;
+        case ESymbolTag::Typedef: return SymTagTypedef;
+        case ESymbolTag::FunctionType: return SymTagFunctionType;
+        case ESymbolTag::FunctionArgType: return SymTagFunctionArgType;
+        case ESymbolTag::VTable: return SymTagVTable;
+        case ESymbolTag::BaseClass: return SymTagBaseClass;
+        case ESymbolTag::Data: return SymTagData;
+        case ESymbolTag::Function: return SymTagFunction;
+        default: return SymTagNull;
+    }
+}
+
+static EBasicType ConvertBasicType(DWORD BasicType) {
+    switch (BasicType) {
+        case btVoid: return EBasicType::Void;
+        case btChar: return EBasicType::Char;
+        case btWChar: return EBasicType::WChar;
+        case btBool: return EBasicType::Bool;
+        ///MSVC does not differentiate between long and int
+        case btInt:
+        case btLong: return EBasicType::Int;
+        case btUInt:
+        case btULong: return EBasicType::UInt;
+        case btFloat: return EBasicType::Float;
+        case btChar8: return EBasicType::Char8;
+        case btChar16: return EBasicType::Char16;
+        case btChar32: return EBasicType::Char32;
+        default: return EBasicType::NoType;
+    }
+}
+
+static EMemberAccess ConvertAccess(DWORD Access) {
+    if (Access == CV_private) {
+        return EMemberAccess::Private;
+    } else if (Access == CV_protected) {
+        return EMemberAccess::Protected;
+    } else if (Access == CV_public) {
+        return EMemberAccess::Public;
+    }
+    return EMemberAccess::Unspecified;
+}
+
+FDiaSymbolSource::FDiaSymbolSource(const CComPtr<IDiaSession>& InSession, const CComPtr<IDiaSymbol>& InGlobalScope) : Session(InSession), GlobalScope(InGlobalScope) {
+}
+
+CComPtr<IDiaSymbol> FDiaSymbolSource::GetSymbol(FSymbolHandle Symbol) const {
+    CComPtr<IDiaSymbol> DiaSymbol{};
+    if (Symbol.IsValid()) {
+        Session->symbolById(static_cast<DWORD>(Symbol.Id), &DiaSymbol);
+    }
+    return DiaSymbol;
+}
+
+FSymbolHandle FDiaSymbolSource::MakeHandle(const CComPtr<IDiaSymbol>& Symbol) {
+    DWORD SymbolIndexId = 0;
+    if (!Symbol || FAILED(Symbol->get_symIndexId(&SymbolIndexId))) {
+        return FSymbolHandle{};
+    }
+    return FSymbolHandle{SymbolIndexId};
+}
+
+FSymbolHandle FDiaSymbolSource::FindUserDefinedType(const std::string& TypeName) const {
+    CComPtr<IDiaEnumSymbols> SymbolsEnumerator{};
+    if (FAILED(GlobalScope->findChildrenEx(SymTagUDT, ConvertUTF8ToWide(TypeName).c_str(), nsfUndecoratedName, &SymbolsEnumerator)) || !SymbolsEnumerator) {
+        return FSymbolHandle{};
+    }
+    CComPtr<IDiaSymbol> UDTSymbol{};
+    SymbolsEnumerator->Item(0, &UDTSymbol);
+    return MakeHandle(UDTSymbol);
+}
+
+bool FDiaSymbolSource::GetSymbolInfo(FSymbolHandle Symbol, FSymbolInfo& OutInfo) const {
+    const CComPtr<IDiaSymbol> DiaSymbol = GetSymbol(Symbol);
+    DWORD SymbolTag = SymTagNull;
+    if (!DiaSymbol || FAILED(DiaSymbol->get_symTag(&SymbolTag))) {
+        return false;
+    }
+    OutInfo = FSymbolInfo{};
+    OutInfo.Tag = ConvertSymbolTag(SymbolTag);
+
+    ///Properties which do not apply to the symbol simply fail to be retrieved, leaving the default values in place
+    CComPtr<IDiaSymbol> TypeSymbol{};
+    if (SUCCEEDED(DiaSymbol->get_type(&TypeSymbol))) {
+        OutInfo.Type = MakeHandle(TypeSymbol);
+    }
+    CComPtr<IDiaSymbol> ClassParentSymbol{};
+    if (SUCCEEDED(DiaSymbol->get_classParent(&ClassParentSymbol))) {
+        OutInfo.ClassParent = MakeHandle(ClassParentSymbol);
+    }
+
+    DWORD BasicType = btNoType;
+    if (SUCCEEDED(DiaSymbol->get_baseType(&BasicType))) {
+        OutInfo.BasicType = ConvertBasicType(BasicType);
+    }
+    DWORD UDTKind = UdtStruct;
+    if (SUCCEEDED(DiaSymbol->get_udtKind(&UDTKind))) {
+        OutInfo.UDTKind = UDTKind == UdtClass ? EUDTKind::Class : UDTKind == UdtUnion ? EUDTKind::Union :
+            UDTKind == UdtInterface ? EUDTKind::Interface : EUDTKind::Struct;
+    }
+    DWORD Access = 0;
+    if (SUCCEEDED(DiaSymbol->get_access(&Access))) {
+        OutInfo.Access = ConvertAccess(Access);
+    }
+
+    ///Only this relative variables and bitfields declared on the type are its members
+    DWORD DataKind = DataIsUnknown;
+    DWORD LocationType = LocIsNull;
+    if (SymbolTag == SymTagData && SUCCEEDED(DiaSymbol->get_dataKind(&DataKind)) && SUCCEEDED(DiaSymbol->get_locationType(&LocationType)) && DataKind == DataIsMember) {
+        OutInfo.Location = LocationType == LocIsThisRel ? EDataLocation::ThisRelative : LocationType == LocIsBitField ? EDataLocation::BitField : EDataLocation::Other;
+    }
+
+    ULONGLONG Length = 0;
+    if (SUCCEEDED(DiaSymbol->get_length(&Length))) {
+        OutInfo.Length = Length;
+    }
+    LONG Offset = 0;
+    if (SUCCEEDED(DiaSymbol->get_offset(&Offset))) {
+        OutInfo.Offset = (int32_t) Offset;
+    }
+    DWORD BitPosition = 0;
+    if (SUCCEEDED(DiaSymbol->get_bitPosition(&BitPosition))) {
+        OutInfo.BitPosition = BitPosition;
+    }
+    DWORD Count = 0;
+    if (SymbolTag == SymTagArrayType && SUCCEEDED(DiaSymbol->get_count(&Count))) {
+        OutInfo.Count = Count;
+    }
+    ///For the UDTs the count is the number of the virtual table entries, taken from the virtual table shape
+    CComPtr<IDiaSymbol> VirtualTableShape{};
+    if (SymbolTag == SymTagUDT && SUCCEEDED(DiaSymbol->get_virtualTableShape(&VirtualTableShape)) && VirtualTableShape &&
+        SUCCEEDED(VirtualTableShape->get_count(&Count))) {
+        OutInfo.Count = Count;
+    }
+    DWORD VirtualBaseOffset = 0;
+    if (SUCCEEDED(DiaSymbol->get_virtualBaseOffset(&VirtualBaseOffset))) {
+        OutInfo.VirtualBaseOffset = (int32_t) VirtualBaseOffset;
+    }
+
+    BOOL bFlag = FALSE;
+    OutInfo.bIsConst = SUCCEEDED(DiaSymbol->get_constType(&bFlag)) && bFlag;
+    OutInfo.bIsVolatile = SUCCEEDED(DiaSymbol->get_volatileType(&bFlag)) && bFlag;
+    OutInfo.bIsReference = SUCCEEDED(DiaSymbol->get_reference(&bFlag)) && bFlag;
+    OutInfo.bIsVirtual = SUCCEEDED(DiaSymbol->get_virtual(&bFlag)) && bFlag;
+    OutInfo.bIsIntroVirtual = SUCCEEDED(DiaSymbol->get_intro(&bFlag)) && bFlag;
+    OutInfo.bIsPureVirtual = SUCCEEDED(DiaSymbol->get_pure(&bFlag)) && bFlag;
+    OutInfo.bIsStatic = SUCCEEDED(DiaSymbol->get_isStatic(&bFlag)) && bFlag;
+    OutInfo.bIsCompilerGenerated = SUCCEEDED(DiaSymbol->get_compilerGenerated(&bFlag)) && bFlag;
+    OutInfo.bHasConstructor = SUCCEEDED(DiaSymbol->get_constructor(&bFlag)) && bFlag;
+    return true;
+}
+
+std::string FDiaSymbolSource::GetSymbolName(FSymbolHandle Symbol) const {
+    const CComPtr<IDiaSymbol> DiaSymbol = GetSymbol(Symbol);
+    std::string ResultName;
+
+    BSTR SymbolName{};
+    if (DiaSymbol && SUCCEEDED(DiaSymbol->get_name(&SymbolName)) && SymbolName) {
+        ResultName = ConvertWideToUTF8(SymbolName);
+        SysFreeString(SymbolName);
+    }
+    return ResultName;
+}
+
+void FDiaSymbolSource::GetChildren(FSymbolHandle Symbol, ESymbolTag ChildTag, std::vector<FSymbolHandle>& OutChildren) const {
+    const CComPtr<IDiaSymbol> DiaSymbol = GetSymbol(Symbol);
+    CComPtr<IDiaEnumSymbols> ChildSymbols{};
+    if (!DiaSymbol || FAILED(DiaSymbol->findChildrenEx(ConvertToDiaSymbolTag(ChildTag), nullptr, nsNone, &ChildSymbols)) || !ChildSymbols) {
+        return;
+    }
+    LONG SymbolCount = 0;
+    ChildSymbols->get_Count(&SymbolCount);
+
+    for (LONG i = 0; i < SymbolCount; i++) {
+        CComPtr<IDiaSymbol> ChildSymbol{};
+        if (SUCCEEDED(ChildSymbols->Item(i, &ChildSymbol)) && ChildSymbol) {
+            OutChildren.push_back(MakeHandle(ChildSymbol));
+        }
+    }
+}
+
+bool FDiaSymbolSource::GetSourceLine(FSymbolHandle Symbol, std::string& OutSourceFilePath, int32_t& OutLineNumber) const {
+    const CComPtr<IDiaSymbol> DiaSymbol = GetSymbol(Symbol);
+
+    ///Resolve the header the type has been defined in, from the LF_UDT_SRC_LINE records of the PDB
+    CComPtr<IDiaLineNumber> DefinitionLineNumber{};
+    if (!DiaSymbol || DiaSymbol->getSrcLineOnTypeDefn(&DefinitionLineNumber) != S_OK || !DefinitionLineNumber) {
+        return false;
+    }
+    CComPtr<IDiaSourceFile> SourceFile{};
+    BSTR SourceFileName{};
+    if (SUCCEEDED(DefinitionLineNumber->get_sourceFile(&SourceFile)) && SourceFile && SUCCEEDED(SourceFile->get_fileName(&SourceFileName))) {
+        OutSourceFilePath = ConvertWideToUTF8(SourceFileName);
+        SysFreeString(SourceFileName);
+    }
+    DWORD LineNumber{0};
+    if (SUCCEEDED(DefinitionLineNumber->get_lineNumber(&LineNumber))) {
+        OutLineNumber = (int32_t) LineNumber;
+    }
+    return !OutSourceFilePath.empty();
+}
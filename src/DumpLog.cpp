@@ -0,0 +1,20 @@
+#include "DumpLog.h"
+#include <iostream>
+
+std::mutex FDumpLog::OutputLock;
+
+FDumpLog::FDumpLog(const std::filesystem::path& DebugFilePath, bool bIsLabelled) {
+    if (bIsLabelled) {
+        Prefix = L"[" + DebugFilePath.filename().wstring() + L"] ";
+    }
+}
+
+void FDumpLog::Info(const std::wstring& Message) const {
+    std::lock_guard Lock{OutputLock};
+    std::wcout << Prefix << Message << std::endl;
+}
+
+void FDumpLog::Error(const std::wstring& Message) const {
+    std::lock_guard Lock{OutputLock};
+    std::wcerr << Prefix << Message << std::endl;
+}
@@ -0,0 +1,434 @@
+#include "Dwarf.h"
+#include <algorithm>
+
+///Unit lengths above this value are reserved, except for the one marking the 64-bit DWARF format
+static constexpr uint32_t DwarfReservedLengthStart = 0xFFFFFFF0;
+static constexpr uint32_t Dwarf64BitLengthMarker = 0xFFFFFFFF;
+
+bool ReadDwarfOffset(FBinaryReader& Reader, bool bIs64Bit, uint64_t& OutOffset) {
+    if (bIs64Bit) {
+        return Reader.Read(OutOffset);
+    }
+    uint32_t Offset32 = 0;
+    if (!Reader.Read(Offset32)) {
+        return false;
+    }
+    OutOffset = Offset32;
+    return true;
+}
+
+///Reads the little endian unsigned integer of the given size, used for the sizes that are not known at compile time (addresses, 3-byte indices)
+static bool ReadDwarfSizedValue(FBinaryReader& Reader, uint32_t Size, uint64_t& OutValue) {
+    std::span<const uint8_t> Bytes;
+    if (Size > sizeof(uint64_t) || !Reader.ReadBytes(Size, Bytes)) {
+        return false;
+    }
+    OutValue = 0;
+    for (uint32_t i = 0; i < Size; i++) {
+        OutValue |= static_cast<uint64_t>(Bytes[i]) << (i * 8);
+    }
+    return true;
+}
+
+static bool ReadDwarfBlock(FBinaryReader& Reader, uint64_t BlockSize, FDwarfAttributeValue& OutValue) {
+    OutValue.Value = BlockSize;
+    return BlockSize <= Reader.GetRemaining() && Reader.ReadBytes(static_cast<size_t>(BlockSize), OutValue.Block);
+}
+
+bool ReadDwarfInitialLength(FBinaryReader& Reader, bool& OutIs64Bit, uint64_t& OutLength) {
+    uint32_t Length32 = 0;
+    if (!Reader.Read(Length32)) {
+        return false;
+    }
+    OutIs64Bit = false;
+    OutLength = Length32;
+    if (Length32 == Dwarf64BitLengthMarker) {
+        OutIs64Bit = true;
+        if (!Reader.Read(OutLength)) {
+            return false;
+        }
+    } else if (Length32 >= DwarfReservedLengthStart) {
+        return false;
+    }
+    return OutLength <= Reader.GetRemaining();
+}
+
+bool FDwarfAbbreviationTable::Read(std::span<const uint8_t> AbbrevSection, uint64_t Offset) {
+    FBinaryReader Reader{AbbrevSection};
+    if (!Reader.Seek(static_cast<size_t>(Offset))) {
+        return false;
+    }
+
+    while (true) {
+        uint64_t Code = 0;
+        if (!Reader.ReadULEB128(Code)) {
+            return false;
+        }
+        ///Zero code terminates the abbreviation set
+        if (Code == 0) {
+            break;
+        }
+
+        uint64_t Tag = 0;
+        uint8_t HasChildren = 0;
+        if (!Reader.ReadULEB128(Tag) || !Reader.Read(HasChildren)) {
+            return false;
+        }
+        FDwarfAbbreviation Abbreviation{Code, static_cast<EDwarfTag>(Tag), HasChildren != 0, static_cast<uint32_t>(AttributeSpecs.size()), 0};
+
+        while (true) {
+            uint64_t Attribute = 0;
+            uint64_t Form = 0;
+            if (!Reader.ReadULEB128(Attribute) || !Reader.ReadULEB128(Form)) {
+                return false;
+            }
+            int64_t ImplicitConst = 0;
+            if (static_cast<EDwarfForm>(Form) == EDwarfForm::ImplicitConst && !Reader.ReadSLEB128(ImplicitConst)) {
+                return false;
+            }
+            if (Attribute == 0 && Form == 0) {
+                break;
+            }
+            AttributeSpecs.push_back(FDwarfAttributeSpec{static_cast<EDwarfAttribute>(Attribute), static_cast<EDwarfForm>(Form), ImplicitConst});
+            Abbreviation.NumAttributes++;
+        }
+        Abbreviations.push_back(Abbreviation);
+    }
+
+    ///Sequential codes can be looked up by index, anything else is sorted for the binary search
+    bool bCodesAreSequential = true;
+    for (size_t i = 1; i < Abbreviations.size(); i++) {
+        if (Abbreviations[i].Code != Abbreviations[0].Code + i) {
+            bCodesAreSequential = false;
+            break;
+        }
+    }
+    if (bCodesAreSequential && !Abbreviations.empty()) {
+        FirstSequentialCode = Abbreviations[0].Code;
+    } else {
+        std::sort(Abbreviations.begin(), Abbreviations.end(), [](const FDwarfAbbreviation& A, const FDwarfAbbreviation& B) {
+            return A.Code < B.Code;
+        });
+    }
+    return true;
+}
+
+const FDwarfAbbreviation* FDwarfAbbreviationTable::Find(uint64_t Code) const {
+    if (FirstSequentialCode != 0) {
+        if (Code < FirstSequentialCode || Code - FirstSequentialCode >= Abbreviations.size()) {
+            return nullptr;
+        }
+        return &Abbreviations[Code - FirstSequentialCode];
+    }
+    const auto Iterator = std::lower_bound(Abbreviations.begin(), Abbreviations.end(), Code, [](const FDwarfAbbreviation& Abbreviation, uint64_t Value) {
+        return Abbreviation.Code < Value;
+    });
+    if (Iterator == Abbreviations.end() || Iterator->Code != Code) {
+        return nullptr;
+    }
+    return &*Iterator;
+}
+
+bool ReadDwarfUnitHeader(std::span<const uint8_t> InfoSection, uint64_t Offset, FDwarfUnitHeader& OutHeader) {
+    FBinaryReader Reader{InfoSection};
+    if (!Reader.Seek(static_cast<size_t>(Offset))) {
+        return false;
+    }
+    OutHeader = FDwarfUnitHeader{};
+    OutHeader.Offset = Offset;
+
+    uint64_t UnitLength = 0;
+    if (!ReadDwarfInitialLength(Reader, OutHeader.bIs64Bit, UnitLength)) {
+        return false;
+    }
+    OutHeader.EndOffset = Reader.GetPosition() + UnitLength;
+
+    if (!Reader.Read(OutHeader.Version) || OutHeader.Version < 2 || OutHeader.Version > 5) {
+        return false;
+    }
+
+    ///DWARF 5 moved the address size in front of the abbreviation offset and added the unit type
+    if (OutHeader.Version >= 5) {
+        uint8_t UnitType = 0;
+        if (!Reader.Read(UnitType) || !Reader.Read(OutHeader.AddressSize) || !ReadDwarfOffset(Reader, OutHeader.bIs64Bit, OutHeader.AbbrevOffset)) {
+            return false;
+        }
+        OutHeader.UnitType = static_cast<EDwarfUnitType>(UnitType);
+
+        if (OutHeader.UnitType == EDwarfUnitType::Skeleton || OutHeader.UnitType == EDwarfUnitType::SplitCompile) {
+            if (!Reader.Read(OutHeader.DwoId)) {
+                return false;
+            }
+        } else if (OutHeader.UnitType == EDwarfUnitType::Type || OutHeader.UnitType == EDwarfUnitType::SplitType) {
+            if (!Reader.Read(OutHeader.TypeSignature) || !ReadDwarfOffset(Reader, OutHeader.bIs64Bit, OutHeader.TypeOffset)) {
+                return false;
+            }
+            OutHeader.TypeOffset += Offset;
+        }
+    } else {
+        if (!ReadDwarfOffset(Reader, OutHeader.bIs64Bit, OutHeader.AbbrevOffset) || !Reader.Read(OutHeader.AddressSize)) {
+            return false;
+        }
+    }
+    OutHeader.FirstDIEOffset = Reader.GetPosition();
+    return OutHeader.FirstDIEOffset <= OutHeader.EndOffset;
+}
+
+bool FDwarfAttributeValue::IsReference() const {
+    switch (Form) {
+        case EDwarfForm::Ref1:
+        case EDwarfForm::Ref2:
+        case EDwarfForm::Ref4:
+        case EDwarfForm::Ref8:
+        case EDwarfForm::RefUData:
+        case EDwarfForm::RefAddr:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool FDwarfAttributeValue::IsString() const {
+    switch (Form) {
+        case EDwarfForm::String:
+        case EDwarfForm::Strp:
+        case EDwarfForm::LineStrp:
+        case EDwarfForm::Strx:
+        case EDwarfForm::Strx1:
+        case EDwarfForm::Strx2:
+        case EDwarfForm::Strx3:
+        case EDwarfForm::Strx4:
+        case EDwarfForm::GNUStrIndex:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool FDwarfAttributeValue::IsSigned() const {
+    return Form == EDwarfForm::SData || Form == EDwarfForm::ImplicitConst;
+}
+
+bool ReadDwarfFormValue(FBinaryReader& Reader, EDwarfForm Form, const FDwarfUnitHeader& Unit, FDwarfAttributeValue& OutValue) {
+    OutValue = FDwarfAttributeValue{};
+    OutValue.Form = Form;
+
+    switch (Form) {
+        case EDwarfForm::Addr:
+            return ReadDwarfSizedValue(Reader, Unit.AddressSize, OutValue.Value);
+        case EDwarfForm::Data1:
+        case EDwarfForm::Flag:
+        case EDwarfForm::Strx1:
+        case EDwarfForm::Addrx1:
+            return ReadDwarfSizedValue(Reader, 1, OutValue.Value);
+        case EDwarfForm::Data2:
+        case EDwarfForm::Strx2:
+        case EDwarfForm::Addrx2:
+            return ReadDwarfSizedValue(Reader, 2, OutValue.Value);
+        case EDwarfForm::Strx3:
+        case EDwarfForm::Addrx3:
+            return ReadDwarfSizedValue(Reader, 3, OutValue.Value);
+        case EDwarfForm::Data4:
+        case EDwarfForm::Strx4:
+        case EDwarfForm::Addrx4:
+        case EDwarfForm::RefSup4:
+            return ReadDwarfSizedValue(Reader, 4, OutValue.Value);
+        case EDwarfForm::Data8:
+        case EDwarfForm::RefSig8:
+        case EDwarfForm::RefSup8:
+            return ReadDwarfSizedValue(Reader, 8, OutValue.Value);
+        case EDwarfForm::Data16:
+            return ReadDwarfBlock(Reader, 16, OutValue);
+        case EDwarfForm::Block1: {
+            uint8_t BlockSize = 0;
+            return Reader.Read(BlockSize) && ReadDwarfBlock(Reader, BlockSize, OutValue);
+        }
+        case EDwarfForm::Block2: {
+            uint16_t BlockSize = 0;
+            return Reader.Read(BlockSize) && ReadDwarfBlock(Reader, BlockSize, OutValue);
+        }
+        case EDwarfForm::Block4: {
+            uint32_t BlockSize = 0;
+            return Reader.Read(BlockSize) && ReadDwarfBlock(Reader, BlockSize, OutValue);
+        }
+        case EDwarfForm::Block:
+        case EDwarfForm::ExprLoc: {
+            uint64_t BlockSize = 0;
+            return Reader.ReadULEB128(BlockSize) && ReadDwarfBlock(Reader, BlockSize, OutValue);
+        }
+        case EDwarfForm::String:
+            return Reader.ReadCString(OutValue.String);
+        case EDwarfForm::SData: {
+            int64_t SignedValue = 0;
+            if (!Reader.ReadSLEB128(SignedValue)) {
+                return false;
+            }
+            OutValue.Value = static_cast<uint64_t>(SignedValue);
+            return true;
+        }
+        case EDwarfForm::UData:
+        case EDwarfForm::Strx:
+        case EDwarfForm::Addrx:
+        case EDwarfForm::LocListx:
+        case EDwarfForm::RngListx:
+        case EDwarfForm::GNUAddrIndex:
+        case EDwarfForm::GNUStrIndex:
+            return Reader.ReadULEB128(OutValue.Value);
+        case EDwarfForm::Strp:
+        case EDwarfForm::LineStrp:
+        case EDwarfForm::SecOffset:
+        case EDwarfForm::StrpSup:
+        case EDwarfForm::GNURefAlt:
+        case EDwarfForm::GNUStrpAlt:
+            return ReadDwarfOffset(Reader, Unit.bIs64Bit, OutValue.Value);
+        ///Unit relative references are converted to the section offsets right away
+        case EDwarfForm::Ref1:
+        case EDwarfForm::Ref2:
+        case EDwarfForm::Ref4:
+        case EDwarfForm::Ref8: {
+            const uint32_t ReferenceSize = Form == EDwarfForm::Ref1 ? 1 : Form == EDwarfForm::Ref2 ? 2 : Form == EDwarfForm::Ref4 ? 4 : 8;
+            if (!ReadDwarfSizedValue(Reader, ReferenceSize, OutValue.Value)) {
+                return false;
+            }
+            OutValue.Value += Unit.Offset;
+            return true;
+        }
+        case EDwarfForm::RefUData:
+            if (!Reader.ReadULEB128(OutValue.Value)) {
+                return false;
+            }
+            OutValue.Value += Unit.Offset;
+            return true;
+        ///DWARF 2 stored the section references with the size of the address, later versions use the offset size
+        case EDwarfForm::RefAddr:
+            if (Unit.Version <= 2) {
+                return ReadDwarfSizedValue(Reader, Unit.AddressSize, OutValue.Value);
+            }
+            return ReadDwarfOffset(Reader, Unit.bIs64Bit, OutValue.Value);
+        case EDwarfForm::FlagPresent:
+            OutValue.Value = 1;
+            return true;
+        case EDwarfForm::ImplicitConst:
+            return true;
+        case EDwarfForm::Indirect: {
+            uint64_t ActualForm = 0;
+            if (!Reader.ReadULEB128(ActualForm) || static_cast<EDwarfForm>(ActualForm) == EDwarfForm::Indirect) {
+                return false;
+            }
+            return ReadDwarfFormValue(Reader, static_cast<EDwarfForm>(ActualForm), Unit, OutValue);
+        }
+        default:
+            return false;
+    }
+}
+
+bool ReadDwarfAttributeValue(FBinaryReader& Reader, const FDwarfAttributeSpec& Spec, const FDwarfUnitHeader& Unit, FDwarfAttributeValue& OutValue) {
+    if (Spec.Form == EDwarfForm::ImplicitConst) {
+        OutValue = FDwarfAttributeValue{};
+        OutValue.Form = EDwarfForm::ImplicitConst;
+        OutValue.Value = static_cast<uint64_t>(Spec.ImplicitConst);
+        return true;
+    }
+    return ReadDwarfFormValue(Reader, Spec.Form, Unit, OutValue);
+}
+
+bool GetDwarfStringAtOffset(std::span<const uint8_t> Section, uint64_t Offset, std::string_view& OutString) {
+    FBinaryReader Reader{Section};
+    return Offset < Section.size() && Reader.Seek(static_cast<size_t>(Offset)) && Reader.ReadCString(OutString);
+}
+
+bool ResolveDwarfString(const FDwarfStringSections& Sections, const FDwarfUnitHeader& Unit, uint64_t StrOffsetsBase, const FDwarfAttributeValue& Value, std::string_view& OutString) {
+    switch (Value.Form) {
+        case EDwarfForm::String:
+            OutString = Value.String;
+            return true;
+        case EDwarfForm::Strp:
+            return GetDwarfStringAtOffset(Sections.Str, Value.Value, OutString);
+        case EDwarfForm::LineStrp:
+            return GetDwarfStringAtOffset(Sections.LineStr, Value.Value, OutString);
+        ///Indexed strings go through the string offsets table of the unit first
+        case EDwarfForm::Strx:
+        case EDwarfForm::Strx1:
+        case EDwarfForm::Strx2:
+        case EDwarfForm::Strx3:
+        case EDwarfForm::Strx4:
+        case EDwarfForm::GNUStrIndex: {
+            FBinaryReader Reader{Sections.StrOffsets};
+            uint64_t StringOffset = 0;
+            if (!Reader.Seek(static_cast<size_t>(StrOffsetsBase + Value.Value * Unit.GetOffsetSize())) || !ReadDwarfOffset(Reader, Unit.bIs64Bit, StringOffset)) {
+                return false;
+            }
+            return GetDwarfStringAtOffset(Sections.Str, StringOffset, OutString);
+        }
+        default:
+            return false;
+    }
+}
+
+///Section identifiers of the package index columns. Both index versions agree on the ones we read
+static constexpr uint32_t DwarfPackageSectionInfo = 1;
+static constexpr uint32_t DwarfPackageSectionAbbrev = 3;
+static constexpr uint32_t DwarfPackageSectionStrOffsets = 6;
+
+bool ReadDwarfPackageIndex(std::span<const uint8_t> IndexSection, std::vector<FDwarfPackageContribution>& OutContributions) {
+    if (IndexSection.empty()) {
+        return true;
+    }
+    ///Version is a 4-byte field in the GNU index, and a 2-byte field followed by 2 bytes of padding in DWARF 5, which reads the same
+    FBinaryReader Reader{IndexSection};
+    uint32_t Version = 0, NumColumns = 0, NumUnits = 0, NumSlots = 0;
+    if (!Reader.Read(Version) || (Version != 2 && Version != 5) || !Reader.Read(NumColumns) || !Reader.Read(NumUnits) || !Reader.Read(NumSlots)) {
+        return false;
+    }
+    ///Packages without the type units still have the index, with no columns at all
+    if (NumUnits == 0) {
+        return true;
+    }
+    ///Hash table of the signatures, the parallel table of the 1-based row indices, the column identifiers, and the offset and size rows
+    const uint64_t TableSize = static_cast<uint64_t>(NumSlots) * (sizeof(uint64_t) + sizeof(uint32_t)) + static_cast<uint64_t>(NumColumns) * sizeof(uint32_t) +
+        static_cast<uint64_t>(NumUnits) * NumColumns * sizeof(uint32_t) * 2;
+    if (NumColumns == 0 || TableSize > Reader.GetRemaining()) {
+        return false;
+    }
+    const size_t SignaturesOffset = Reader.GetPosition();
+    const size_t RowIndicesOffset = SignaturesOffset + NumSlots * sizeof(uint64_t);
+    const size_t ColumnsOffset = RowIndicesOffset + NumSlots * sizeof(uint32_t);
+    const size_t OffsetRowsOffset = ColumnsOffset + NumColumns * sizeof(uint32_t);
+
+    const size_t FirstContribution = OutContributions.size();
+    OutContributions.resize(FirstContribution + NumUnits);
+
+    for (uint32_t Slot = 0; Slot < NumSlots; Slot++) {
+        const uint32_t RowIndex = ReadUnaligned<uint32_t>(IndexSection.data() + RowIndicesOffset + Slot * sizeof(uint32_t));
+        if (RowIndex == 0 || RowIndex > NumUnits) {
+            continue;
+        }
+        OutContributions[FirstContribution + RowIndex - 1].Signature = ReadUnaligned<uint64_t>(IndexSection.data() + SignaturesOffset + Slot * sizeof(uint64_t));
+    }
+    for (uint32_t Column = 0; Column < NumColumns; Column++) {
+        const uint32_t SectionId = ReadUnaligned<uint32_t>(IndexSection.data() + ColumnsOffset + Column * sizeof(uint32_t));
+        for (uint32_t Row = 0; Row < NumUnits; Row++) {
+            const uint64_t Offset = ReadUnaligned<uint32_t>(IndexSection.data() + OffsetRowsOffset + (static_cast<size_t>(Row) * NumColumns + Column) * sizeof(uint32_t));
+            FDwarfPackageContribution& Contribution = OutContributions[FirstContribution + Row];
+
+            if (SectionId == DwarfPackageSectionInfo) {
+                Contribution.InfoOffset = Offset;
+                Contribution.bHasInfo = true;
+            } else if (SectionId == DwarfPackageSectionAbbrev) {
+                Contribution.AbbrevOffset = Offset;
+            } else if (SectionId == DwarfPackageSectionStrOffsets) {
+                Contribution.StrOffsetsOffset = Offset;
+            }
+        }
+    }
+    return true;
+}
+
+bool EvaluateDwarfConstantExpression(std::span<const uint8_t> Expression, uint64_t& OutValue) {
+    FBinaryReader Reader{Expression};
+    uint8_t Opcode = 0;
+    if (!Reader.Read(Opcode) || (Opcode != DwarfOpConstU && Opcode != DwarfOpPlusUConst)) {
+        return false;
+    }
+    return Reader.ReadULEB128(OutValue) && Reader.IsAtEnd();
+}
@@ -0,0 +1,411 @@
+#include "DwarfNameIndex.h"
+#include <algorithm>
+
+///DW_IDX_* index attributes of the .debug_names entries
+static constexpr uint64_t DebugNamesIndexCompileUnit = 0x1;
+static constexpr uint64_t DebugNamesIndexTypeUnit = 0x2;
+
+///Symbol kind stored in the bits 28-30 of the .gdb_index CU vector entries. Indices built before version 7 do not store it
+static constexpr uint32_t GdbIndexSymbolKindShift = 28;
+static constexpr uint32_t GdbIndexSymbolKindMask = 0x7;
+static constexpr uint32_t GdbIndexSymbolKindNone = 0;
+static constexpr uint32_t GdbIndexSymbolKindType = 1;
+static constexpr uint32_t GdbIndexUnitIndexMask = 0x00FFFFFF;
+///Oldest version using the current hash function and storing the symbol kinds
+static constexpr uint32_t MinGdbIndexVersion = 7;
+
+///Hash function of the .debug_names hash table, the DJB hash of the case folded name
+///Only the ASCII letters are folded, identifiers of the type names do not use the rest of Unicode in practice
+static uint32_t HashDebugNamesString(std::string_view String) {
+    uint32_t Hash = 5381;
+    for (const char Character : String) {
+        uint32_t Value = static_cast<uint8_t>(Character);
+        if (Value >= 'A' && Value <= 'Z') {
+            Value += 'a' - 'A';
+        }
+        Hash = Hash * 33 + Value;
+    }
+    return Hash;
+}
+
+///Hash function of the .gdb_index symbol table (mapped_index_string_hash in gdb). Case insensitive since version 5 of the index
+static uint32_t HashGdbIndexString(std::string_view String) {
+    uint32_t Hash = 0;
+    for (const char Character : String) {
+        uint32_t Value = static_cast<uint8_t>(Character);
+        if (Value >= 'A' && Value <= 'Z') {
+            Value += 'a' - 'A';
+        }
+        Hash = Hash * 67 + Value - 113;
+    }
+    return Hash;
+}
+
+static bool ReadSectionOffsets(FBinaryReader& Reader, bool bIs64Bit, uint32_t NumOffsets, std::vector<uint64_t>& OutOffsets) {
+    OutOffsets.resize(NumOffsets);
+    for (uint64_t& Offset : OutOffsets) {
+        if (!ReadDwarfOffset(Reader, bIs64Bit, Offset)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint64_t ReadTableOffset(std::span<const uint8_t> Table, bool bIs64Bit, uint32_t Index) {
+    return bIs64Bit ? ReadUnaligned<uint64_t>(Table.data() + Index * sizeof(uint64_t)) : ReadUnaligned<uint32_t>(Table.data() + Index * sizeof(uint32_t));
+}
+
+///Offset the last component of the qualified name starts at, 0 for the names at the global scope
+static size_t GetDwarfUnqualifiedNameOffset(std::string_view QualifiedName) {
+    int32_t NestingDepth = 0;
+    size_t NameStart = 0;
+    for (size_t i = 0; i < QualifiedName.size(); i++) {
+        const char Character = QualifiedName[i];
+        if (Character == '<' || Character == '(') {
+            NestingDepth++;
+        } else if (Character == '>' || Character == ')') {
+            NestingDepth--;
+        } else if (Character == ':' && NestingDepth == 0 && i + 1 < QualifiedName.size() && QualifiedName[i + 1] == ':') {
+            NameStart = i + 2;
+            i++;
+        }
+    }
+    return NameStart;
+}
+
+std::string_view GetDwarfUnqualifiedName(std::string_view QualifiedName) {
+    return QualifiedName.substr(GetDwarfUnqualifiedNameOffset(QualifiedName));
+}
+
+std::string_view GetDwarfEnclosingScopeName(std::string_view QualifiedName) {
+    const size_t NameStart = GetDwarfUnqualifiedNameOffset(QualifiedName);
+    return NameStart != 0 ? QualifiedName.substr(0, NameStart - 2) : std::string_view{};
+}
+
+bool FDwarfNameIndex::ReadDebugNames(std::span<const uint8_t> DebugNamesSection, std::span<const uint8_t> InStrSection) {
+    StrSection = InStrSection;
+    FBinaryReader Reader{DebugNamesSection};
+
+    while (!Reader.IsAtEnd()) {
+        FDebugNamesTable Table{};
+        uint64_t TableLength = 0;
+        if (!ReadDwarfInitialLength(Reader, Table.bIs64Bit, TableLength)) {
+            return false;
+        }
+        const size_t TableEnd = Reader.GetPosition() + static_cast<size_t>(TableLength);
+
+        uint16_t Version = 0;
+        uint16_t Padding = 0;
+        uint32_t NumCompileUnits = 0;
+        uint32_t NumLocalTypeUnits = 0;
+        uint32_t NumForeignTypeUnits = 0;
+        uint32_t AbbreviationTableSize = 0;
+        uint32_t AugmentationStringSize = 0;
+        if (!Reader.Read(Version) || Version != 5 || !Reader.Read(Padding) || !Reader.Read(NumCompileUnits) || !Reader.Read(NumLocalTypeUnits) ||
+            !Reader.Read(NumForeignTypeUnits) || !Reader.Read(Table.NumBuckets) || !Reader.Read(Table.NumNames) ||
+            !Reader.Read(AbbreviationTableSize) || !Reader.Read(AugmentationStringSize) || !Reader.Skip(AugmentationStringSize)) {
+            return false;
+        }
+
+        const size_t OffsetSize = Table.bIs64Bit ? sizeof(uint64_t) : sizeof(uint32_t);
+        std::span<const uint8_t> AbbreviationTable;
+        if (!ReadSectionOffsets(Reader, Table.bIs64Bit, NumCompileUnits, Table.CompileUnitOffsets) ||
+            !ReadSectionOffsets(Reader, Table.bIs64Bit, NumLocalTypeUnits, Table.TypeUnitOffsets) ||
+            !Reader.Skip(static_cast<size_t>(NumForeignTypeUnits) * sizeof(uint64_t)) ||
+            !Reader.ReadBytes(static_cast<size_t>(Table.NumBuckets) * sizeof(uint32_t), Table.Buckets) ||
+            ///Hashes are only stored along with the hash table, the tables without buckets are searched linearly
+            !Reader.ReadBytes(Table.NumBuckets != 0 ? static_cast<size_t>(Table.NumNames) * sizeof(uint32_t) : 0, Table.Hashes) ||
+            !Reader.ReadBytes(static_cast<size_t>(Table.NumNames) * OffsetSize, Table.StringOffsets) ||
+            !Reader.ReadBytes(static_cast<size_t>(Table.NumNames) * OffsetSize, Table.EntryOffsets) ||
+            !Reader.ReadBytes(AbbreviationTableSize, AbbreviationTable) || Reader.GetPosition() > TableEnd) {
+            return false;
+        }
+        Table.EntryPool = DebugNamesSection.subspan(Reader.GetPosition(), TableEnd - Reader.GetPosition());
+
+        FBinaryReader AbbreviationReader{AbbreviationTable};
+        while (true) {
+            uint64_t Code = 0;
+            uint64_t Tag = 0;
+            if (!AbbreviationReader.ReadULEB128(Code)) {
+                return false;
+            }
+            if (Code == 0) {
+                break;
+            }
+            if (!AbbreviationReader.ReadULEB128(Tag)) {
+                return false;
+            }
+            std::vector<FDwarfAttributeSpec> AttributeSpecs;
+            while (true) {
+                uint64_t IndexAttribute = 0;
+                uint64_t Form = 0;
+                if (!AbbreviationReader.ReadULEB128(IndexAttribute) || !AbbreviationReader.ReadULEB128(Form)) {
+                    return false;
+                }
+                int64_t ImplicitConst = 0;
+                if (static_cast<EDwarfForm>(Form) == EDwarfForm::ImplicitConst && !AbbreviationReader.ReadSLEB128(ImplicitConst)) {
+                    return false;
+                }
+                if (IndexAttribute == 0 && Form == 0) {
+                    break;
+                }
+                AttributeSpecs.push_back(FDwarfAttributeSpec{static_cast<EDwarfAttribute>(IndexAttribute), static_cast<EDwarfForm>(Form), ImplicitConst});
+            }
+            Table.Abbreviations.insert({Code, {static_cast<EDwarfTag>(Tag), std::move(AttributeSpecs)}});
+        }
+
+        CoveredUnitOffsets.insert(CoveredUnitOffsets.end(), Table.CompileUnitOffsets.begin(), Table.CompileUnitOffsets.end());
+        CoveredUnitOffsets.insert(CoveredUnitOffsets.end(), Table.TypeUnitOffsets.begin(), Table.TypeUnitOffsets.end());
+        DebugNamesTables.push_back(std::move(Table));
+        Reader.Seek(TableEnd);
+    }
+
+    std::sort(CoveredUnitOffsets.begin(), CoveredUnitOffsets.end());
+    Kind = EDwarfNameIndexKind::DebugNames;
+    return true;
+}
+
+bool FDwarfNameIndex::ReadGdbIndex(std::span<const uint8_t> GdbIndexSection) {
+    FBinaryReader Reader{GdbIndexSection};
+    uint32_t Version = 0;
+    uint32_t UnitListOffset = 0;
+    uint32_t TypeUnitListOffset = 0;
+    uint32_t AddressAreaOffset = 0;
+    uint32_t SymbolTableOffset = 0;
+    uint32_t ConstantPoolOffset = 0;
+    if (!Reader.Read(Version) || Version < MinGdbIndexVersion || !Reader.Read(UnitListOffset) || !Reader.Read(TypeUnitListOffset) ||
+        !Reader.Read(AddressAreaOffset) || !Reader.Read(SymbolTableOffset) || !Reader.Read(ConstantPoolOffset)) {
+        return false;
+    }
+    if (UnitListOffset > TypeUnitListOffset || SymbolTableOffset > ConstantPoolOffset || ConstantPoolOffset > GdbIndexSection.size()) {
+        return false;
+    }
+
+    ///Unit list holds the offset and the length of every compile unit, in the order the CU vectors refer to them by
+    const uint32_t NumUnits = (TypeUnitListOffset - UnitListOffset) / (2 * sizeof(uint64_t));
+    GdbIndexUnitOffsets.resize(NumUnits);
+    for (uint32_t i = 0; i < NumUnits; i++) {
+        GdbIndexUnitOffsets[i] = ReadUnaligned<uint64_t>(GdbIndexSection.data() + UnitListOffset + i * 2 * sizeof(uint64_t));
+    }
+
+    ///Symbol table is an open addressing hash table whose size is a power of two
+    const uint32_t NumSymbolSlots = (ConstantPoolOffset - SymbolTableOffset) / (2 * sizeof(uint32_t));
+    if (NumSymbolSlots == 0 || (NumSymbolSlots & (NumSymbolSlots - 1)) != 0) {
+        return false;
+    }
+    GdbIndexSymbolTable = GdbIndexSection.subspan(SymbolTableOffset, NumSymbolSlots * 2 * sizeof(uint32_t));
+    GdbIndexConstantPool = GdbIndexSection.subspan(ConstantPoolOffset);
+
+    CoveredUnitOffsets = GdbIndexUnitOffsets;
+    std::sort(CoveredUnitOffsets.begin(), CoveredUnitOffsets.end());
+    Kind = EDwarfNameIndexKind::GdbIndex;
+    return true;
+}
+
+bool FDwarfNameIndex::ReadPubTypes(std::span<const uint8_t> PubTypesSection, bool bIsGnuPubTypes) {
+    FBinaryReader Reader{PubTypesSection};
+
+    while (!Reader.IsAtEnd()) {
+        bool bIs64Bit = false;
+        uint64_t SetLength = 0;
+        if (!ReadDwarfInitialLength(Reader, bIs64Bit, SetLength)) {
+            return false;
+        }
+        const size_t SetEnd = Reader.GetPosition() + static_cast<size_t>(SetLength);
+
+        uint16_t Version = 0;
+        uint64_t UnitOffset = 0;
+        uint64_t UnitLength = 0;
+        if (!Reader.Read(Version) || !ReadDwarfOffset(Reader, bIs64Bit, UnitOffset) || !ReadDwarfOffset(Reader, bIs64Bit, UnitLength)) {
+            return false;
+        }
+        CoveredUnitOffsets.push_back(UnitOffset);
+
+        ///Names are listed with the unit relative offsets of their entries, a zero offset terminates the set
+        while (Reader.GetPosition() < SetEnd) {
+            uint64_t EntryOffset = 0;
+            if (!ReadDwarfOffset(Reader, bIs64Bit, EntryOffset)) {
+                return false;
+            }
+            if (EntryOffset == 0) {
+                break;
+            }
+            uint8_t GnuFlags = 0;
+            std::string_view TypeName;
+            if ((bIsGnuPubTypes && !Reader.Read(GnuFlags)) || !Reader.ReadCString(TypeName)) {
+                return false;
+            }
+            std::vector<uint64_t>& UnitOffsets = PubTypeUnitOffsets[TypeName];
+            if (UnitOffsets.empty() || UnitOffsets.back() != UnitOffset) {
+                UnitOffsets.push_back(UnitOffset);
+            }
+        }
+        Reader.Seek(SetEnd);
+    }
+
+    std::sort(CoveredUnitOffsets.begin(), CoveredUnitOffsets.end());
+    Kind = EDwarfNameIndexKind::PubTypes;
+    return true;
+}
+
+bool FDwarfNameIndex::CoversUnit(uint64_t UnitOffset) const {
+    return std::binary_search(CoveredUnitOffsets.begin(), CoveredUnitOffsets.end(), UnitOffset);
+}
+
+void FDwarfNameIndex::FindTypeUnits(std::string_view QualifiedName, std::vector<uint64_t>& OutUnitOffsets) const {
+    ///Every table is searched the same way, starting with the type itself and walking out through its enclosing scopes until one of them is listed.
+    ///Nested classes are missing from the pubtypes and the .gdb_index written by GCC and gold, but are defined by the units defining their outer class
+    const size_t NumUnitOffsets = OutUnitOffsets.size();
+    for (std::string_view Name = QualifiedName; !Name.empty() && OutUnitOffsets.size() == NumUnitOffsets; Name = GetDwarfEnclosingScopeName(Name)) {
+        FindNamedTypeUnits(Name, OutUnitOffsets);
+    }
+}
+
+void FDwarfNameIndex::FindNamedTypeUnits(std::string_view QualifiedName, std::vector<uint64_t>& OutUnitOffsets) const {
+    switch (Kind) {
+        case EDwarfNameIndexKind::DebugNames: {
+            ///Scopes are separate entries of .debug_names, so only the last component of the name is listed
+            const std::string_view UnqualifiedName = GetDwarfUnqualifiedName(QualifiedName);
+            for (const FDebugNamesTable& Table : DebugNamesTables) {
+                FindDebugNamesTypeUnits(Table, UnqualifiedName, OutUnitOffsets);
+            }
+            break;
+        }
+        case EDwarfNameIndexKind::GdbIndex:
+            FindGdbIndexTypeUnits(QualifiedName, OutUnitOffsets);
+            break;
+        case EDwarfNameIndexKind::PubTypes: {
+            const auto Iterator = PubTypeUnitOffsets.find(QualifiedName);
+            if (Iterator != PubTypeUnitOffsets.end()) {
+                OutUnitOffsets.insert(OutUnitOffsets.end(), Iterator->second.begin(), Iterator->second.end());
+            }
+            break;
+        }
+        case EDwarfNameIndexKind::None:
+            break;
+    }
+}
+
+void FDwarfNameIndex::FindDebugNamesTypeUnits(const FDebugNamesTable& Table, std::string_view Name, std::vector<uint64_t>& OutUnitOffsets) const {
+    const uint32_t Hash = HashDebugNamesString(Name);
+    uint32_t FirstNameIndex = 0;
+    uint32_t LastNameIndex = Table.NumNames;
+
+    ///Names of the bucket are stored next to each other, starting at the 1-based index stored in the bucket
+    if (Table.NumBuckets != 0) {
+        const uint32_t BucketNameIndex = ReadUnaligned<uint32_t>(Table.Buckets.data() + (Hash % Table.NumBuckets) * sizeof(uint32_t));
+        if (BucketNameIndex == 0 || BucketNameIndex > Table.NumNames) {
+            return;
+        }
+        FirstNameIndex = BucketNameIndex - 1;
+    }
+
+    for (uint32_t NameIndex = FirstNameIndex; NameIndex < LastNameIndex; NameIndex++) {
+        if (Table.NumBuckets != 0) {
+            const uint32_t NameHash = ReadUnaligned<uint32_t>(Table.Hashes.data() + NameIndex * sizeof(uint32_t));
+            if (NameHash % Table.NumBuckets != Hash % Table.NumBuckets) {
+                break;
+            }
+            if (NameHash != Hash) {
+                continue;
+            }
+        }
+        std::string_view IndexedName;
+        if (!GetDwarfStringAtOffset(StrSection, ReadTableOffset(Table.StringOffsets, Table.bIs64Bit, NameIndex), IndexedName) || IndexedName != Name) {
+            continue;
+        }
+
+        const uint64_t EntryOffset = ReadTableOffset(Table.EntryOffsets, Table.bIs64Bit, NameIndex);
+        FBinaryReader EntryReader{Table.EntryPool};
+        if (!EntryReader.Seek(static_cast<size_t>(EntryOffset))) {
+            continue;
+        }
+        FDwarfUnitHeader IndexUnitHeader{};
+        IndexUnitHeader.Version = 5;
+        IndexUnitHeader.AddressSize = sizeof(uint64_t);
+        IndexUnitHeader.bIs64Bit = Table.bIs64Bit;
+
+        ///Entry list of the name is terminated by the zero abbreviation code
+        uint64_t AbbreviationCode = 0;
+        while (EntryReader.ReadULEB128(AbbreviationCode) && AbbreviationCode != 0) {
+            const auto AbbreviationIterator = Table.Abbreviations.find(AbbreviationCode);
+            if (AbbreviationIterator == Table.Abbreviations.end()) {
+                break;
+            }
+            const auto& [Tag, AttributeSpecs] = AbbreviationIterator->second;
+
+            ///Indices with a single compile unit are allowed to omit DW_IDX_compile_unit
+            uint64_t CompileUnitIndex = Table.CompileUnitOffsets.size() == 1 ? 0 : UINT64_MAX;
+            uint64_t TypeUnitIndex = UINT64_MAX;
+            bool bIsEntryValid = true;
+            for (const FDwarfAttributeSpec& Spec : AttributeSpecs) {
+                FDwarfAttributeValue Value{};
+                if (!ReadDwarfAttributeValue(EntryReader, Spec, IndexUnitHeader, Value)) {
+                    bIsEntryValid = false;
+                    break;
+                }
+                if (static_cast<uint64_t>(Spec.Attribute) == DebugNamesIndexCompileUnit) {
+                    CompileUnitIndex = Value.Value;
+                } else if (static_cast<uint64_t>(Spec.Attribute) == DebugNamesIndexTypeUnit) {
+                    TypeUnitIndex = Value.Value;
+                }
+            }
+            if (!bIsEntryValid) {
+                break;
+            }
+            if (!IsDwarfUserDefinedTypeTag(Tag)) {
+                continue;
+            }
+            ///Foreign type units live in the split DWARF files, which we do not read
+            if (TypeUnitIndex != UINT64_MAX) {
+                if (TypeUnitIndex < Table.TypeUnitOffsets.size()) {
+                    OutUnitOffsets.push_back(Table.TypeUnitOffsets[TypeUnitIndex]);
+                }
+            } else if (CompileUnitIndex < Table.CompileUnitOffsets.size()) {
+                OutUnitOffsets.push_back(Table.CompileUnitOffsets[CompileUnitIndex]);
+            }
+        }
+        ///Every name is present only once in the table
+        break;
+    }
+}
+
+void FDwarfNameIndex::FindGdbIndexTypeUnits(std::string_view QualifiedName, std::vector<uint64_t>& OutUnitOffsets) const {
+    const uint32_t NumSymbolSlots = static_cast<uint32_t>(GdbIndexSymbolTable.size() / (2 * sizeof(uint32_t)));
+    const uint32_t SlotMask = NumSymbolSlots - 1;
+    const uint32_t Hash = HashGdbIndexString(QualifiedName);
+    const uint32_t ProbeStep = ((Hash * 17) & SlotMask) | 1;
+
+    uint32_t SlotIndex = Hash & SlotMask;
+    for (uint32_t NumProbes = 0; NumProbes < NumSymbolSlots; NumProbes++, SlotIndex = (SlotIndex + ProbeStep) & SlotMask) {
+        const uint8_t* Slot = GdbIndexSymbolTable.data() + SlotIndex * 2 * sizeof(uint32_t);
+        const uint32_t NameOffset = ReadUnaligned<uint32_t>(Slot);
+        const uint32_t UnitVectorOffset = ReadUnaligned<uint32_t>(Slot + sizeof(uint32_t));
+        if (NameOffset == 0 && UnitVectorOffset == 0) {
+            return;
+        }
+        std::string_view SymbolName;
+        if (!GetDwarfStringAtOffset(GdbIndexConstantPool, NameOffset, SymbolName) || SymbolName != QualifiedName) {
+            continue;
+        }
+
+        FBinaryReader UnitVectorReader{GdbIndexConstantPool};
+        uint32_t NumUnitVectorEntries = 0;
+        if (!UnitVectorReader.Seek(UnitVectorOffset) || !UnitVectorReader.Read(NumUnitVectorEntries)) {
+            return;
+        }
+        for (uint32_t i = 0; i < NumUnitVectorEntries; i++) {
+            uint32_t UnitVectorEntry = 0;
+            if (!UnitVectorReader.Read(UnitVectorEntry)) {
+                return;
+            }
+            const uint32_t SymbolKind = (UnitVectorEntry >> GdbIndexSymbolKindShift) & GdbIndexSymbolKindMask;
+            const uint32_t UnitIndex = UnitVectorEntry & GdbIndexUnitIndexMask;
+            ///Indices past the compile unit list refer to the .debug_types units, which we do not read
+            if ((SymbolKind == GdbIndexSymbolKindType || SymbolKind == GdbIndexSymbolKindNone) && UnitIndex < GdbIndexUnitOffsets.size()) {
+                OutUnitOffsets.push_back(GdbIndexUnitOffsets[UnitIndex]);
+            }
+        }
+        return;
+    }
+}
@@ -0,0 +1,1676 @@
+#include "DwarfSymbolSource.h"
+#include "ParallelFor.h"
+#include <algorithm>
+
+///Derived symbols share the offset of the entry they come from, and are told apart by the variant stored in the high bits of the handle
+enum class EDwarfHandleVariant : uint8_t {
+    Entry = 0x00,
+    ///Function type of the DW_TAG_subprogram, DWARF does not have a separate entry for it
+    FunctionType = 0x01,
+    ///Member function type the DW_TAG_ptr_to_member_type points to, which needs the containing class of the pointer
+    MemberFunctionPointerType = 0x02,
+    ///Inner dimensions of the multidimensional DW_TAG_array_type, the outermost dimension is the entry itself
+    ArrayDimension = 0x10,
+};
+
+static constexpr uint32_t HandleVariantShift = 48;
+static constexpr uint64_t HandleOffsetMask = (1ull << HandleVariantShift) - 1;
+///Handle of the void type, which DWARF represents by the absence of the type attribute. Low bits carry the const and volatile modifiers
+static constexpr uint64_t VoidHandleFlag = 1ull << 63;
+static constexpr uint64_t VoidHandleConstFlag = 0x1;
+static constexpr uint64_t VoidHandleVolatileFlag = 0x2;
+
+static constexpr uint32_t InvalidEntryIndex = 0xFFFFFFFF;
+
+///Limit of the modifier and typedef chains we follow, protecting us from the reference cycles in the malformed files
+static constexpr uint32_t MaxTypeChainLength = 64;
+///Limit of the specification, scope and base class chains the names and the virtual tables are resolved through, for the same reason
+static constexpr uint32_t MaxEntryRecursionDepth = 64;
+
+///DW_LNCT_path, content type of the path entries of the DWARF 5 line table header
+static constexpr uint64_t DwarfLineContentPath = 0x1;
+static constexpr uint64_t DwarfLineContentDirectoryIndex = 0x2;
+
+static FSymbolHandle MakeEntryHandle(uint64_t EntryOffset, uint32_t Variant = static_cast<uint32_t>(EDwarfHandleVariant::Entry)) {
+    return FSymbolHandle{(static_cast<uint64_t>(Variant) << HandleVariantShift) | (EntryOffset & HandleOffsetMask)};
+}
+
+static FSymbolHandle MakeVoidHandle(bool bIsConst, bool bIsVolatile) {
+    return FSymbolHandle{VoidHandleFlag | (bIsConst ? VoidHandleConstFlag : 0) | (bIsVolatile ? VoidHandleVolatileFlag : 0)};
+}
+
+///Type attributes are optional in DWARF, and a missing type means void
+static FSymbolHandle MakeTypeHandle(uint64_t TypeOffset) {
+    return TypeOffset != 0 ? MakeEntryHandle(TypeOffset) : MakeVoidHandle(false, false);
+}
+
+///Tags whose names become a part of the qualified names of the entries nested in them
+static bool IsScopeTag(EDwarfTag Tag) {
+    return IsDwarfUserDefinedTypeTag(Tag) || Tag == EDwarfTag::Namespace;
+}
+
+static bool IsModifierTag(EDwarfTag Tag) {
+    return Tag == EDwarfTag::ConstType || Tag == EDwarfTag::VolatileType || Tag == EDwarfTag::RestrictType || Tag == EDwarfTag::AtomicType;
+}
+
+///Name used for the scopes DWARF leaves unnamed, matching the way the compilers spell them in the diagnostics
+static std::string_view GetUnnamedScopeName(EDwarfTag Tag) {
+    return Tag == EDwarfTag::Namespace ? "(anonymous namespace)" : "<unnamed-tag>";
+}
+
+///Strips the template arguments from the name of the class, leaving the name its constructors and destructors are declared with
+static std::string_view GetClassNameWithoutTemplateArguments(std::string_view ClassName) {
+    return ClassName.substr(0, ClassName.find('<'));
+}
+
+static EBasicType ConvertBaseTypeEncoding(EDwarfBaseTypeEncoding Encoding, std::string_view TypeName, uint64_t TypeSize) {
+    const bool bIsIntegerSize = TypeSize == 1 || TypeSize == 2 || TypeSize == 4 || TypeSize == 8;
+
+    ///Dedicated character types are told apart by their names, because not every compiler gives them the UTF encoding
+    if (TypeName == "char8_t") {
+        return EBasicType::Char8;
+    }
+    if (TypeName == "char16_t") {
+        return EBasicType::WChar;
+    }
+    if (TypeName == "char32_t") {
+        return EBasicType::Char32;
+    }
+    if (TypeName == "wchar_t") {
+        return TypeSize == 2 ? EBasicType::WChar : EBasicType::Char32;
+    }
+
+    switch (Encoding) {
+        case EDwarfBaseTypeEncoding::Boolean:
+            return EBasicType::Bool;
+        case EDwarfBaseTypeEncoding::Float:
+            return TypeSize == 4 || TypeSize == 8 ? EBasicType::Float : EBasicType::NoType;
+        case EDwarfBaseTypeEncoding::Signed:
+            return bIsIntegerSize ? EBasicType::Int : EBasicType::NoType;
+        case EDwarfBaseTypeEncoding::Unsigned:
+            return bIsIntegerSize ? EBasicType::UInt : EBasicType::NoType;
+        ///Plain char is signed on x86 and unsigned on ARM, but in both cases it is a distinct type from the explicitly signed and unsigned ones
+        case EDwarfBaseTypeEncoding::SignedChar:
+            return TypeName == "char" ? EBasicType::Char : EBasicType::Int;
+        case EDwarfBaseTypeEncoding::UnsignedChar:
+            return TypeName == "char" ? EBasicType::Char : EBasicType::UInt;
+        ///UE defines TCHAR as char16_t on Linux, which is the same character type wchar_t is on Windows
+        case EDwarfBaseTypeEncoding::UTF:
+            switch (TypeSize) {
+                case 1: return EBasicType::Char8;
+                case 2: return EBasicType::WChar;
+                case 4: return EBasicType::Char32;
+                default: return EBasicType::NoType;
+            }
+        default:
+            return EBasicType::NoType;
+    }
+}
+
+bool FDwarfSymbolSource::Open(const std::filesystem::path& FilePath, const FDumpLog& InLog) {
+    Log = InLog;
+    if (!ELFFile.Open(FilePath, Log)) {
+        return false;
+    }
+
+    const FDwarfSectionRequest SectionRequests[] = {
+        {".debug_info", &FileSections.Info},
+        {".debug_abbrev", &FileSections.Abbrev},
+        {".debug_str", &FileSections.Strings.Str},
+        {".debug_line_str", &FileSections.Strings.LineStr},
+        {".debug_str_offsets", &FileSections.Strings.StrOffsets},
+    };
+    if (!ReadDebugSections(ELFFile, SectionRequests)) {
+        Log.Error(L"Failed to read the debug sections of ELF file " + FilePath.wstring());
+        return false;
+    }
+    if (FileSections.Info.empty() || FileSections.Abbrev.empty()) {
+        Log.Error(L"ELF file " + FilePath.wstring() + L" does not contain DWARF debug information");
+        return false;
+    }
+
+    std::vector<FDwarfUnit> SkeletonUnits;
+    if (!ReadUnits(SkeletonUnits)) {
+        Log.Error(L"Failed to read the DWARF units of ELF file " + FilePath.wstring());
+        return false;
+    }
+    if (!SkeletonUnits.empty() && !ReadPackageUnits(FilePath, SkeletonUnits)) {
+        return false;
+    }
+    UnitEntriesFlags = std::make_unique<std::once_flag[]>(Units.size());
+    UnitLineTableFlags = std::make_unique<std::once_flag[]>(Units.size());
+    ReadNameIndex();
+    BuildTypeNameIndex();
+    return true;
+}
+
+bool FDwarfSymbolSource::ReadDebugSections(const FELFFile& File, std::span<const FDwarfSectionRequest> SectionRequests) {
+    std::vector<const FELFSection*> CompressedSections;
+    std::vector<std::span<const uint8_t>*> CompressedSectionData;
+
+    ///Missing sections are not an error, they simply stay empty
+    for (const FDwarfSectionRequest& SectionRequest : SectionRequests) {
+        const FELFSection* Section = File.FindDebugSection(SectionRequest.SectionName);
+        if (Section == nullptr) {
+            continue;
+        }
+        if (Section->IsCompressed()) {
+            CompressedSections.push_back(Section);
+            CompressedSectionData.push_back(SectionRequest.OutSectionData);
+        } else {
+            *SectionRequest.OutSectionData = Section->GetData();
+        }
+    }
+
+    ///Every section is a separate compressed stream, so the sections are decompressed in parallel
+    std::vector<FMappedRegion> DecompressedRegions(CompressedSections.size());
+    std::vector<uint8_t> DecompressionResults(CompressedSections.size());
+    ParallelFor(CompressedSections.size(), [&](size_t SectionIndex) {
+        DecompressionResults[SectionIndex] = FELFFile::DecompressSection(*CompressedSections[SectionIndex], DecompressedRegions[SectionIndex], Log);
+    });
+
+    for (size_t i = 0; i < CompressedSections.size(); i++) {
+        if (!DecompressionResults[i]) {
+            return false;
+        }
+        ///Moving the region keeps its buffer, so the view stays valid
+        *CompressedSectionData[i] = DecompressedRegions[i].GetData();
+        DecompressedSections.push_back(std::move(DecompressedRegions[i]));
+    }
+    return true;
+}
+
+std::span<const uint8_t> FDwarfSymbolSource::GetLineSection() const {
+    std::call_once(LineSectionFlag, [this]() {
+        const FELFSection* Section = ELFFile.FindDebugSection(".debug_line");
+        if (Section == nullptr) {
+            return;
+        }
+        if (!Section->IsCompressed()) {
+            LineSection = Section->GetData();
+        } else if (FELFFile::DecompressSection(*Section, DecompressedLineSection, Log)) {
+            LineSection = DecompressedLineSection.GetData();
+        }
+    });
+    return LineSection;
+}
+
+bool FDwarfSymbolSource::ReadUnits(std::vector<FDwarfUnit>& OutSkeletonUnits) {
+    uint64_t UnitOffset = 0;
+    while (UnitOffset < FileSections.Info.size()) {
+        FDwarfUnit Unit{};
+        if (!ReadDwarfUnitHeader(FileSections.Info, UnitOffset, Unit.Header)) {
+            return false;
+        }
+        UnitOffset = Unit.Header.EndOffset;
+
+        ///Split units belong to the .dwo files, a stray one in the file has no skeleton unit to attach to
+        if (Unit.Header.UnitType == EDwarfUnitType::SplitCompile || Unit.Header.UnitType == EDwarfUnitType::SplitType) {
+            continue;
+        }
+        if (!InitializeUnit(Unit, FileSections)) {
+            return false;
+        }
+
+        ///Skeleton units only carry the line table and point to the split unit holding the entries. DWARF 4 marks them with DW_AT_GNU_dwo_id instead of the unit type
+        if (Unit.Header.UnitType == EDwarfUnitType::Skeleton || Unit.Header.DwoId != 0) {
+            OutSkeletonUnits.push_back(std::move(Unit));
+            continue;
+        }
+        Units.push_back(std::move(Unit));
+    }
+    return true;
+}
+
+bool FDwarfSymbolSource::ReadPackageUnits(const std::filesystem::path& FilePath, const std::vector<FDwarfUnit>& SkeletonUnits) {
+    ///Packages are named after the file, the same way the debuggers look for them
+    std::filesystem::path PackagePath = FilePath;
+    PackagePath += ".dwp";
+    if (!std::filesystem::exists(PackagePath)) {
+        PackagePath = FilePath;
+        PackagePath.replace_extension(".dwp");
+    }
+    if (!std::filesystem::exists(PackagePath)) {
+        ///Types of the split units would silently go missing from the dump, so the file is not dumped at all
+        Log.Error(L"ELF file " + FilePath.wstring() + L" uses split DWARF, but package file " + PackagePath.wstring() + L" holding the types of its " + std::to_wstring(SkeletonUnits.size()) + L" split units was not found, package the .dwo files with dwp or llvm-dwp");
+        return false;
+    }
+    if (!PackageFile.Open(PackagePath, Log)) {
+        return false;
+    }
+
+    std::span<const uint8_t> CompileUnitIndex;
+    std::span<const uint8_t> TypeUnitIndex;
+    const FDwarfSectionRequest SectionRequests[] = {
+        {".debug_info.dwo", &PackageSections.Info},
+        {".debug_abbrev.dwo", &PackageSections.Abbrev},
+        {".debug_str.dwo", &PackageSections.Strings.Str},
+        {".debug_str_offsets.dwo", &PackageSections.Strings.StrOffsets},
+        {".debug_cu_index", &CompileUnitIndex},
+        {".debug_tu_index", &TypeUnitIndex},
+    };
+    std::vector<FDwarfPackageContribution> Contributions;
+    if (!ReadDebugSections(PackageFile, SectionRequests) || !ReadDwarfPackageIndex(CompileUnitIndex, Contributions) || !ReadDwarfPackageIndex(TypeUnitIndex, Contributions)) {
+        Log.Error(L"Failed to read the unit index of DWARF package file " + PackagePath.wstring());
+        return false;
+    }
+
+    ///Entries of the package follow the entries of the file in the offset space, and the units are kept sorted by the offset
+    PackageSections.BaseOffset = FileSections.Info.size();
+    std::sort(Contributions.begin(), Contributions.end(), [](const FDwarfPackageContribution& A, const FDwarfPackageContribution& B) {
+        return A.InfoOffset < B.InfoOffset;
+    });
+    std::unordered_map<uint64_t, const FDwarfUnit*> SkeletonUnitsByDwoId;
+    for (const FDwarfUnit& SkeletonUnit : SkeletonUnits) {
+        SkeletonUnitsByDwoId.insert({SkeletonUnit.Header.DwoId, &SkeletonUnit});
+    }
+
+    for (const FDwarfPackageContribution& Contribution : Contributions) {
+        ///DWARF 4 type units live in .debug_types.dwo, which is not read, the same as .debug_types
+        if (!Contribution.bHasInfo) {
+            continue;
+        }
+        FDwarfUnit Unit{};
+        if (!ReadDwarfUnitHeader(PackageSections.Info, Contribution.InfoOffset, Unit.Header)) {
+            Log.Error(L"Failed to read the split unit at offset " + std::to_wstring(Contribution.InfoOffset) + L" of DWARF package file " + PackagePath.wstring());
+            return false;
+        }
+        ///Split units do not have DW_AT_str_offsets_base, their string offsets start at their contribution, after the header in DWARF 5
+        Unit.Header.AbbrevOffset += Contribution.AbbrevOffset;
+        Unit.StrOffsetsBase = Contribution.StrOffsetsOffset;
+        if (Unit.Header.Version >= 5) {
+            FBinaryReader StrOffsetsReader{PackageSections.Strings.StrOffsets};
+            bool bIs64BitStrOffsets = false;
+            uint64_t StrOffsetsLength = 0;
+            if (StrOffsetsReader.Seek(static_cast<size_t>(Contribution.StrOffsetsOffset)) && ReadDwarfInitialLength(StrOffsetsReader, bIs64BitStrOffsets, StrOffsetsLength)) {
+                Unit.StrOffsetsBase = StrOffsetsReader.GetPosition() + sizeof(uint16_t) * 2;
+            }
+        }
+        if (!InitializeUnit(Unit, PackageSections)) {
+            Log.Error(L"Failed to read the split unit at offset " + std::to_wstring(Contribution.InfoOffset) + L" of DWARF package file " + PackagePath.wstring());
+            return false;
+        }
+
+        ///Split compile units take the line table from their skeleton unit, and are listed under its offset by the accelerator tables of the file
+        const auto SkeletonIterator = Unit.Header.UnitType != EDwarfUnitType::SplitType ? SkeletonUnitsByDwoId.find(Unit.Header.DwoId) : SkeletonUnitsByDwoId.end();
+        if (SkeletonIterator != SkeletonUnitsByDwoId.end()) {
+            const FDwarfUnit& SkeletonUnit = *SkeletonIterator->second;
+            Unit.StmtList = SkeletonUnit.StmtList;
+            Unit.bHasStmtList = SkeletonUnit.bHasStmtList;
+            Unit.NameIndexOffset = SkeletonUnit.Header.Offset;
+            if (Unit.CompilationDirectory.empty()) {
+                Unit.CompilationDirectory = SkeletonUnit.CompilationDirectory;
+            }
+        }
+        Units.push_back(std::move(Unit));
+    }
+
+    for (const FDwarfUnit& Unit : Units) {
+        if (Unit.NameIndexOffset != Unit.GetOffset()) {
+            SkeletonSplitUnits.insert({Unit.NameIndexOffset, &Unit});
+        }
+    }
+    return true;
+}
+
+bool FDwarfSymbolSource::InitializeUnit(FDwarfUnit& Unit, FDwarfUnitSections& Sections) {
+    Unit.Sections = &Sections;
+    Unit.NameIndexOffset = Unit.GetOffset();
+
+    ///Units of the same object file share a single abbreviation set, so each set is decoded only once
+    auto& AbbreviationTable = Sections.AbbreviationTables[Unit.Header.AbbrevOffset];
+    if (!AbbreviationTable) {
+        AbbreviationTable = std::make_unique<FDwarfAbbreviationTable>();
+        if (!AbbreviationTable->Read(Sections.Abbrev, Unit.Header.AbbrevOffset)) {
+            return false;
+        }
+    }
+    Unit.Abbreviations = AbbreviationTable.get();
+
+    if (!ReadUnitRootEntry(Unit)) {
+        return false;
+    }
+    ///Type units hold the types moved out of the compile units with -fdebug-types-section, which refer to them by the signature
+    if (Unit.Header.UnitType == EDwarfUnitType::Type || Unit.Header.UnitType == EDwarfUnitType::SplitType) {
+        TypeUnitTypes.insert({Unit.Header.TypeSignature, Sections.BaseOffset + Unit.Header.TypeOffset});
+    }
+    return true;
+}
+
+bool FDwarfSymbolSource::ReadUnitRootEntry(FDwarfUnit& Unit) const {
+    FBinaryReader Reader{Unit.Sections->Info.first(static_cast<size_t>(Unit.Header.EndOffset))};
+    uint64_t AbbreviationCode = 0;
+    if (!Reader.Seek(static_cast<size_t>(Unit.Header.FirstDIEOffset)) || !Reader.ReadULEB128(AbbreviationCode)) {
+        return false;
+    }
+    const FDwarfAbbreviation* Abbreviation = Unit.Abbreviations->Find(AbbreviationCode);
+    if (Abbreviation == nullptr) {
+        return false;
+    }
+
+    ///The string offsets base can come after the strings that need it, so the compilation directory is resolved at the end
+    FDwarfAttributeValue CompilationDirectory{};
+    bool bHasCompilationDirectory = false;
+
+    for (const FDwarfAttributeSpec& Spec : Unit.Abbreviations->GetAttributeSpecs(*Abbreviation)) {
+        FDwarfAttributeValue Value{};
+        if (!ReadDwarfAttributeValue(Reader, Spec, Unit.Header, Value)) {
+            return false;
+        }
+        if (Spec.Attribute == EDwarfAttribute::StrOffsetsBase) {
+            Unit.StrOffsetsBase = Value.Value;
+        } else if (Spec.Attribute == EDwarfAttribute::StmtList) {
+            Unit.StmtList = Value.Value;
+            Unit.bHasStmtList = true;
+        } else if (Spec.Attribute == EDwarfAttribute::CompDir) {
+            CompilationDirectory = Value;
+            bHasCompilationDirectory = true;
+        } else if (Spec.Attribute == EDwarfAttribute::GNUDwoId) {
+            ///Pre-standard split DWARF keeps the DWO id in the root entry of both the skeleton and the split unit
+            Unit.Header.DwoId = Value.Value;
+        }
+    }
+    if (bHasCompilationDirectory) {
+        ResolveDwarfString(Unit.Sections->Strings, Unit.Header, Unit.StrOffsetsBase, CompilationDirectory, Unit.CompilationDirectory);
+    }
+    return true;
+}
+
+///Number of the independently locked parts of the definition map. Large enough for the units indexed at the same time to rarely meet on the same lock
+static constexpr size_t NumTypeDefinitionShards = 64;
+
+static uint64_t CombineHash(uint64_t Seed, uint64_t Value) {
+    return Seed ^ (Value + 0x9E3779B97F4A7C15ull + (Seed << 6) + (Seed >> 2));
+}
+
+/**
+ * Concurrent map of the qualified class names to their definitions, filled by the units indexed in parallel
+ * Copies of the same class are dropped on insertion, so the memory use is bounded by the number of distinct classes rather than the number of units
+ * The definition with the lowest offset is kept, which makes the result independent of the order the units finish in
+ */
+class FDwarfTypeDefinitionMap {
+private:
+    struct FMappedDefinition {
+        FDwarfTypeDefinition Definition;
+        ///Set once a copy with a different layout has been seen. Does not depend on the insertion order, since the kept definition is always one of the seen copies
+        bool bHasConflictingCopies;
+    };
+    struct FShard {
+        std::mutex ShardLock;
+        std::unordered_map<std::string, FMappedDefinition> Definitions;
+    };
+    std::vector<FShard> Shards{NumTypeDefinitionShards};
+public:
+    void Add(std::string_view QualifiedName, const FDwarfTypeDefinition& Definition) {
+        FShard& Shard = Shards[std::hash<std::string_view>{}(QualifiedName) % Shards.size()];
+        std::lock_guard Lock{Shard.ShardLock};
+
+        const auto [Iterator, bInserted] = Shard.Definitions.try_emplace(std::string{QualifiedName}, FMappedDefinition{Definition, false});
+        if (bInserted) {
+            return;
+        }
+        FMappedDefinition& ExistingDefinition = Iterator->second;
+        if (ExistingDefinition.Definition.ByteSize != Definition.ByteSize || ExistingDefinition.Definition.MemberSignature != Definition.MemberSignature) {
+            ExistingDefinition.bHasConflictingCopies = true;
+        }
+        if (Definition.Offset < ExistingDefinition.Definition.Offset) {
+            ExistingDefinition.Definition = Definition;
+        }
+    }
+
+    ///Moves the offsets of the kept definitions into the lookup map, returns the number of classes that had conflicting definitions
+    size_t MoveOffsetsTo(std::unordered_map<std::string, uint64_t>& OutTypeOffsets) {
+        size_t NumDefinitions = 0;
+        for (const FShard& Shard : Shards) {
+            NumDefinitions += Shard.Definitions.size();
+        }
+        OutTypeOffsets.reserve(NumDefinitions);
+
+        size_t NumConflictingTypes = 0;
+        for (FShard& Shard : Shards) {
+            while (!Shard.Definitions.empty()) {
+                auto Node = Shard.Definitions.extract(Shard.Definitions.begin());
+                NumConflictingTypes += Node.mapped().bHasConflictingCopies ? 1 : 0;
+                OutTypeOffsets.insert({std::move(Node.key()), Node.mapped().Definition.Offset});
+            }
+        }
+        return NumConflictingTypes;
+    }
+};
+
+void FDwarfSymbolSource::ReadNameIndex() {
+    std::span<const uint8_t> DebugNamesSection;
+    std::span<const uint8_t> GdbIndexSection;
+    std::span<const uint8_t> GnuPubTypesSection;
+    std::span<const uint8_t> PubTypesSection;
+    const FDwarfSectionRequest SectionRequests[] = {
+        {".debug_names", &DebugNamesSection},
+        {".gdb_index", &GdbIndexSection},
+        {".debug_gnu_pubtypes", &GnuPubTypesSection},
+        {".debug_pubtypes", &PubTypesSection},
+    };
+    if (!ReadDebugSections(ELFFile, SectionRequests)) {
+        return;
+    }
+
+    ///Tables are tried from the most to the least precise one, a table that fails to read is simply not used
+    bool bHasNameIndex = false;
+    if (!DebugNamesSection.empty()) {
+        bHasNameIndex = NameIndex.ReadDebugNames(DebugNamesSection, FileSections.Strings.Str);
+    } else if (!GdbIndexSection.empty()) {
+        bHasNameIndex = NameIndex.ReadGdbIndex(GdbIndexSection);
+    } else if (!GnuPubTypesSection.empty()) {
+        bHasNameIndex = NameIndex.ReadPubTypes(GnuPubTypesSection, true);
+    } else if (!PubTypesSection.empty()) {
+        bHasNameIndex = NameIndex.ReadPubTypes(PubTypesSection, false);
+    }
+    if (!bHasNameIndex) {
+        NameIndex = FDwarfNameIndex{};
+    }
+}
+
+void FDwarfSymbolSource::BuildTypeNameIndex() {
+    ///Units without the accelerator table, e.g. the ones of the libraries built without -gpubnames, still have to be scanned
+    std::vector<const FDwarfUnit*> UnitsToIndex;
+    for (const FDwarfUnit& Unit : Units) {
+        if (!NameIndex.CoversUnit(Unit.NameIndexOffset)) {
+            UnitsToIndex.push_back(&Unit);
+        }
+    }
+    if (UnitsToIndex.empty()) {
+        return;
+    }
+
+    ///Sections are read once, so let the OS read ahead and drop the pages once we are done. Decompressed sections live on the heap and are left alone
+    std::vector<const FELFSection*> MappedInfoSections;
+    for (const FELFSection* InfoSection : {ELFFile.FindDebugSection(".debug_info"), PackageFile.FindDebugSection(".debug_info.dwo")}) {
+        if (InfoSection != nullptr && !InfoSection->IsCompressed()) {
+            InfoSection->Region.AdviseSequentialAccess();
+            MappedInfoSections.push_back(InfoSection);
+        }
+    }
+
+    ///Units are independent of each other, so every unit is a separate task writing into the shared concurrent map
+    FDwarfTypeDefinitionMap TypeDefinitions;
+    ParallelFor(UnitsToIndex.size(), [&](size_t UnitIndex) {
+        IndexUnitTypeNames(*UnitsToIndex[UnitIndex], TypeDefinitions);
+    });
+    for (const FELFSection* InfoSection : MappedInfoSections) {
+        InfoSection->Region.ReleaseResidentPages();
+    }
+
+    const size_t NumConflictingTypes = TypeDefinitions.MoveOffsetsTo(UserDefinedTypes);
+    if (NumConflictingTypes != 0) {
+        Log.Error(L"Found " + std::to_wstring(NumConflictingTypes) + L" classes with conflicting definitions in different units, the first definition in the file is used for them");
+    }
+}
+
+void FDwarfSymbolSource::IndexUnitTypeNames(const FDwarfUnit& Unit, FDwarfTypeDefinitionMap& TypeDefinitions) const {
+    struct FIndexScope {
+        size_t PrefixLength;
+        bool bIsIndexed;
+        ///Class definition whose members are being collected, added to the map once all of them have been seen
+        bool bIsTypeDefinition;
+        FDwarfTypeDefinition TypeDefinition;
+    };
+    std::vector<FIndexScope> Scopes;
+    std::string ScopePrefix;
+
+    ///Qualified names of the class declarations of this unit. Classes defined outside of their scope refer to them through DW_AT_specification
+    std::unordered_map<uint64_t, std::string> DeclarationNames;
+
+    FBinaryReader Reader{Unit.Sections->Info.first(static_cast<size_t>(Unit.Header.EndOffset))};
+    Reader.Seek(static_cast<size_t>(Unit.Header.FirstDIEOffset));
+
+    while (!Reader.IsAtEnd()) {
+        const uint64_t EntryOffset = Unit.Sections->BaseOffset + Reader.GetPosition();
+        uint64_t AbbreviationCode = 0;
+        if (!Reader.ReadULEB128(AbbreviationCode)) {
+            return;
+        }
+        ///Null entry terminates the list of the children of the current scope
+        if (AbbreviationCode == 0) {
+            if (!Scopes.empty()) {
+                const FIndexScope& Scope = Scopes.back();
+                if (Scope.bIsTypeDefinition) {
+                    ///Prefix of the class scope is the qualified name of the class followed by the "::" separator
+                    TypeDefinitions.Add(std::string_view{ScopePrefix}.substr(0, ScopePrefix.size() - 2), Scope.TypeDefinition);
+                }
+                ScopePrefix.resize(Scope.PrefixLength);
+                Scopes.pop_back();
+            }
+            continue;
+        }
+        const FDwarfAbbreviation* Abbreviation = Unit.Abbreviations->Find(AbbreviationCode);
+        if (Abbreviation == nullptr) {
+            Log.Error(L"DWARF entry at offset " + std::to_wstring(EntryOffset) + L" uses unknown abbreviation code " + std::to_wstring(AbbreviationCode));
+            return;
+        }
+
+        FDwarfAttributeValue NameValue{};
+        FDwarfAttributeValue LocationValue{};
+        bool bHasName = false;
+        bool bIsDeclaration = false;
+        uint64_t SpecificationOffset = 0;
+        uint64_t SiblingOffset = 0;
+        uint64_t ByteSize = 0;
+
+        for (const FDwarfAttributeSpec& Spec : Unit.Abbreviations->GetAttributeSpecs(*Abbreviation)) {
+            FDwarfAttributeValue Value{};
+            if (!ReadDwarfAttributeValue(Reader, Spec, Unit.Header, Value)) {
+                return;
+            }
+            if (Spec.Attribute == EDwarfAttribute::Name) {
+                NameValue = Value;
+                bHasName = true;
+            } else if (Spec.Attribute == EDwarfAttribute::Declaration) {
+                bIsDeclaration = Value.Value != 0;
+            } else if (Spec.Attribute == EDwarfAttribute::Specification && Value.IsReference()) {
+                SpecificationOffset = Unit.Sections->BaseOffset + Value.Value;
+            } else if (Spec.Attribute == EDwarfAttribute::Sibling && Value.IsReference()) {
+                SiblingOffset = Value.Value;
+            } else if (Spec.Attribute == EDwarfAttribute::ByteSize) {
+                ByteSize = Value.Value;
+            } else if (Spec.Attribute == EDwarfAttribute::DataMemberLocation || Spec.Attribute == EDwarfAttribute::DataBitOffset) {
+                LocationValue = Value;
+            }
+        }
+
+        const bool bIsParentIndexed = Scopes.empty() || Scopes.back().bIsIndexed;
+        const EDwarfTag Tag = Abbreviation->Tag;
+
+        ///Data members and bases of the class being indexed make up its signature. Names and locations are enough to tell the different layouts apart
+        if ((Tag == EDwarfTag::Member || Tag == EDwarfTag::Inheritance) && !Scopes.empty() && Scopes.back().bIsTypeDefinition) {
+            std::string_view MemberName;
+            if (bHasName) {
+                ResolveDwarfString(Unit.Sections->Strings, Unit.Header, Unit.StrOffsetsBase, NameValue, MemberName);
+            }
+            const std::string_view LocationBlock{reinterpret_cast<const char*>(LocationValue.Block.data()), LocationValue.Block.size()};
+            uint64_t& MemberSignature = Scopes.back().TypeDefinition.MemberSignature;
+            MemberSignature = CombineHash(MemberSignature, std::hash<std::string_view>{}(MemberName));
+            MemberSignature = CombineHash(MemberSignature, LocationBlock.empty() ? LocationValue.Value : std::hash<std::string_view>{}(LocationBlock));
+        }
+
+        if (IsScopeTag(Tag) && bIsParentIndexed) {
+            std::string QualifiedName;
+            const auto DeclarationIterator = SpecificationOffset != 0 ? DeclarationNames.find(SpecificationOffset) : DeclarationNames.end();
+
+            if (DeclarationIterator != DeclarationNames.end()) {
+                QualifiedName = DeclarationIterator->second;
+            } else {
+                std::string_view EntryName;
+                if (!bHasName || !ResolveDwarfString(Unit.Sections->Strings, Unit.Header, Unit.StrOffsetsBase, NameValue, EntryName)) {
+                    EntryName = GetUnnamedScopeName(Tag);
+                }
+                QualifiedName.reserve(ScopePrefix.size() + EntryName.size());
+                QualifiedName.append(ScopePrefix).append(EntryName);
+            }
+
+            ///Only the named definitions make it to the index, since all copies describe the same layout the one with the lowest offset is kept
+            const bool bIsTypeDefinition = IsDwarfUserDefinedTypeTag(Tag) && !bIsDeclaration && (bHasName || SpecificationOffset != 0);
+            if (IsDwarfUserDefinedTypeTag(Tag) && bIsDeclaration) {
+                DeclarationNames.insert({EntryOffset, QualifiedName});
+            }
+            if (Abbreviation->bHasChildren) {
+                Scopes.push_back(FIndexScope{ScopePrefix.size(), true, bIsTypeDefinition, FDwarfTypeDefinition{EntryOffset, ByteSize, 0}});
+                ScopePrefix = std::move(QualifiedName);
+                ScopePrefix.append("::");
+            } else if (bIsTypeDefinition) {
+                TypeDefinitions.Add(QualifiedName, FDwarfTypeDefinition{EntryOffset, ByteSize, 0});
+            }
+        } else if (Abbreviation->bHasChildren) {
+            ///Children of the functions and the other non-scope entries are never looked up by name, so skip them whenever we can
+            const bool bIsUnitEntry = Tag == EDwarfTag::CompileUnit || Tag == EDwarfTag::PartialUnit || Tag == EDwarfTag::TypeUnit;
+            if (!bIsUnitEntry && SiblingOffset > Reader.GetPosition() && Reader.Seek(static_cast<size_t>(SiblingOffset))) {
+                continue;
+            }
+            Scopes.push_back(FIndexScope{ScopePrefix.size(), bIsUnitEntry && bIsParentIndexed, false, FDwarfTypeDefinition{}});
+        }
+    }
+}
+
+const std::unordered_map<std::string, uint64_t>& FDwarfSymbolSource::GetIndexedUnitTypes(const FDwarfUnit& Unit) const {
+    {
+        std::lock_guard Lock{IndexedUnitTypesLock};
+        const auto Iterator = IndexedUnitTypes.find(Unit.GetOffset());
+        if (Iterator != IndexedUnitTypes.end()) {
+            return *Iterator->second;
+        }
+    }
+    ///Unit is indexed outside of the lock, so that the lookups landing in the other units do not wait for it
+    FDwarfTypeDefinitionMap TypeDefinitions;
+    IndexUnitTypeNames(Unit, TypeDefinitions);
+    auto UnitTypes = std::make_unique<std::unordered_map<std::string, uint64_t>>();
+    TypeDefinitions.MoveOffsetsTo(*UnitTypes);
+
+    std::lock_guard Lock{IndexedUnitTypesLock};
+    return *IndexedUnitTypes.try_emplace(Unit.GetOffset(), std::move(UnitTypes)).first->second;
+}
+
+uint64_t FDwarfSymbolSource::FindTypeDefinition(const std::string& QualifiedName) const {
+    const auto Iterator = UserDefinedTypes.find(QualifiedName);
+    uint64_t DefinitionOffset = Iterator != UserDefinedTypes.end() ? Iterator->second : 0;
+    if (NameIndex.GetKind() == EDwarfNameIndexKind::None) {
+        return DefinitionOffset;
+    }
+
+    ///Same as the full scan, the first definition in the file wins. Units are visited in order, so the first unit defining the type has it
+    std::vector<uint64_t> CandidateUnitOffsets;
+    NameIndex.FindTypeUnits(QualifiedName, CandidateUnitOffsets);
+    std::vector<const FDwarfUnit*> CandidateUnits;
+    for (const uint64_t UnitOffset : CandidateUnitOffsets) {
+        const FDwarfUnit* Unit = FindNameIndexUnit(UnitOffset);
+        if (Unit != nullptr) {
+            CandidateUnits.push_back(Unit);
+        }
+    }
+    std::sort(CandidateUnits.begin(), CandidateUnits.end(), [](const FDwarfUnit* A, const FDwarfUnit* B) {
+        return A->GetOffset() < B->GetOffset();
+    });
+    CandidateUnits.erase(std::unique(CandidateUnits.begin(), CandidateUnits.end()), CandidateUnits.end());
+
+    for (const FDwarfUnit* Unit : CandidateUnits) {
+        if (DefinitionOffset != 0 && Unit->GetOffset() > DefinitionOffset) {
+            break;
+        }
+        const std::unordered_map<std::string, uint64_t>& UnitTypes = GetIndexedUnitTypes(*Unit);
+        const auto UnitIterator = UnitTypes.find(QualifiedName);
+        if (UnitIterator != UnitTypes.end()) {
+            DefinitionOffset = DefinitionOffset != 0 ? std::min(DefinitionOffset, UnitIterator->second) : UnitIterator->second;
+            break;
+        }
+    }
+    return DefinitionOffset;
+}
+
+const FDwarfUnit* FDwarfSymbolSource::FindUnit(uint64_t Offset) const {
+    const auto Iterator = std::upper_bound(Units.begin(), Units.end(), Offset, [](uint64_t Value, const FDwarfUnit& Unit) {
+        return Value < Unit.GetOffset();
+    });
+    if (Iterator == Units.begin()) {
+        return nullptr;
+    }
+    const FDwarfUnit& Unit = *(Iterator - 1);
+    return Offset < Unit.GetEndOffset() ? &Unit : nullptr;
+}
+
+const FDwarfUnit* FDwarfSymbolSource::FindNameIndexUnit(uint64_t NameIndexOffset) const {
+    const auto Iterator = SkeletonSplitUnits.find(NameIndexOffset);
+    if (Iterator != SkeletonSplitUnits.end()) {
+        return Iterator->second;
+    }
+    const FDwarfUnit* Unit = FindUnit(NameIndexOffset);
+    return Unit != nullptr && Unit->GetOffset() == NameIndexOffset ? Unit : nullptr;
+}
+
+const std::vector<FDwarfEntry>& FDwarfSymbolSource::GetUnitEntries(const FDwarfUnit& Unit) const {
+    ///Entries are written inside of call_once, so every thread that went through it observes the whole tree
+    std::call_once(UnitEntriesFlags[&Unit - Units.data()], [this, &Unit]() {
+        Unit.Entries = DecodeUnitEntries(Unit);
+    });
+    return *Unit.Entries;
+}
+
+std::unique_ptr<std::vector<FDwarfEntry>> FDwarfSymbolSource::DecodeUnitEntries(const FDwarfUnit& Unit) const {
+    auto Entries = std::make_unique<std::vector<FDwarfEntry>>();
+
+    ///Index of the parent of each nesting level, and the index of the last entry seen on that level to link the siblings
+    std::vector<uint32_t> ParentStack;
+    std::vector<uint32_t> LastSiblingStack{InvalidEntryIndex};
+
+    FBinaryReader Reader{Unit.Sections->Info.first(static_cast<size_t>(Unit.Header.EndOffset))};
+    Reader.Seek(static_cast<size_t>(Unit.Header.FirstDIEOffset));
+
+    while (!Reader.IsAtEnd()) {
+        const uint64_t EntryOffset = Unit.Sections->BaseOffset + Reader.GetPosition();
+        uint64_t AbbreviationCode = 0;
+        if (!Reader.ReadULEB128(AbbreviationCode)) {
+            break;
+        }
+        if (AbbreviationCode == 0) {
+            if (!ParentStack.empty()) {
+                ParentStack.pop_back();
+                LastSiblingStack.pop_back();
+            }
+            continue;
+        }
+        const FDwarfAbbreviation* Abbreviation = Unit.Abbreviations->Find(AbbreviationCode);
+        if (Abbreviation == nullptr) {
+            break;
+        }
+
+        FDwarfEntry Entry{};
+        Entry.Offset = EntryOffset;
+        Entry.AttributesOffset = Reader.GetPosition();
+        Entry.Abbreviation = Abbreviation;
+        Entry.ParentIndex = ParentStack.empty() ? InvalidEntryIndex : ParentStack.back();
+        Entry.NextSiblingIndex = InvalidEntryIndex;
+
+        bool bAttributesValid = true;
+        for (const FDwarfAttributeSpec& Spec : Unit.Abbreviations->GetAttributeSpecs(*Abbreviation)) {
+            FDwarfAttributeValue Value{};
+            if (!ReadDwarfAttributeValue(Reader, Spec, Unit.Header, Value)) {
+                bAttributesValid = false;
+                break;
+            }
+        }
+        if (!bAttributesValid) {
+            break;
+        }
+
+        const auto EntryIndex = static_cast<uint32_t>(Entries->size());
+        if (LastSiblingStack.back() != InvalidEntryIndex) {
+            (*Entries)[LastSiblingStack.back()].NextSiblingIndex = EntryIndex;
+        }
+        LastSiblingStack.back() = EntryIndex;
+        Entries->push_back(Entry);
+
+        if (Abbreviation->bHasChildren) {
+            ParentStack.push_back(EntryIndex);
+            LastSiblingStack.push_back(InvalidEntryIndex);
+        }
+    }
+    return Entries;
+}
+
+const FDwarfEntry* FDwarfSymbolSource::FindEntry(uint64_t Offset, const FDwarfUnit*& OutUnit) const {
+    OutUnit = FindUnit(Offset);
+    if (OutUnit == nullptr) {
+        return nullptr;
+    }
+    const std::vector<FDwarfEntry>& Entries = GetUnitEntries(*OutUnit);
+    const auto Iterator = std::lower_bound(Entries.begin(), Entries.end(), Offset, [](const FDwarfEntry& Entry, uint64_t Value) {
+        return Entry.Offset < Value;
+    });
+    if (Iterator == Entries.end() || Iterator->Offset != Offset) {
+        return nullptr;
+    }
+    return &*Iterator;
+}
+
+const FDwarfEntry* FDwarfSymbolSource::GetParentEntry(const FDwarfUnit& Unit, const FDwarfEntry& Entry) const {
+    if (Entry.ParentIndex == InvalidEntryIndex) {
+        return nullptr;
+    }
+    return &(*Unit.Entries)[Entry.ParentIndex];
+}
+
+void FDwarfSymbolSource::GetChildEntries(const FDwarfUnit& Unit, const FDwarfEntry& Entry, std::vector<const FDwarfEntry*>& OutChildren) const {
+    if (!Entry.Abbreviation->bHasChildren) {
+        return;
+    }
+    const std::vector<FDwarfEntry>& Entries = *Unit.Entries;
+    const auto EntryIndex = static_cast<uint32_t>(&Entry - Entries.data());
+
+    ///Entries are stored depth-first, so the first child immediately follows its parent
+    uint32_t ChildIndex = EntryIndex + 1;
+    if (ChildIndex >= Entries.size() || Entries[ChildIndex].ParentIndex != EntryIndex) {
+        return;
+    }
+    while (ChildIndex != InvalidEntryIndex) {
+        OutChildren.push_back(&Entries[ChildIndex]);
+        ChildIndex = Entries[ChildIndex].NextSiblingIndex;
+    }
+}
+
+bool FDwarfSymbolSource::FindAttribute(const FDwarfUnit& Unit, const FDwarfEntry& Entry, EDwarfAttribute Attribute, FDwarfAttributeValue& OutValue) const {
+    FBinaryReader Reader{Unit.Sections->Info.first(static_cast<size_t>(Unit.Header.EndOffset)), static_cast<size_t>(Entry.AttributesOffset)};
+
+    for (const FDwarfAttributeSpec& Spec : Unit.Abbreviations->GetAttributeSpecs(*Entry.Abbreviation)) {
+        if (!ReadDwarfAttributeValue(Reader, Spec, Unit.Header, OutValue)) {
+            return false;
+        }
+        if (Spec.Attribute == Attribute) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FDwarfSymbolSource::GetConstantAttribute(const FDwarfUnit& Unit, const FDwarfEntry& Entry, EDwarfAttribute Attribute, uint64_t& OutValue) const {
+    FDwarfAttributeValue Value{};
+    if (!FindAttribute(Unit, Entry, Attribute, Value) || Value.IsReference() || Value.IsString() || !Value.Block.empty()) {
+        return false;
+    }
+    OutValue = Value.Value;
+    return true;
+}
+
+bool FDwarfSymbolSource::HasFlagAttribute(const FDwarfUnit& Unit, const FDwarfEntry& Entry, EDwarfAttribute Attribute) const {
+    FDwarfAttributeValue Value{};
+    return FindAttribute(Unit, Entry, Attribute, Value) && Value.Value != 0;
+}
+
+uint64_t FDwarfSymbolSource::GetReferenceAttribute(const FDwarfUnit& Unit, const FDwarfEntry& Entry, EDwarfAttribute Attribute) const {
+    FDwarfAttributeValue Value{};
+    if (!FindAttribute(Unit, Entry, Attribute, Value)) {
+        return 0;
+    }
+    if (Value.Form == EDwarfForm::RefSig8) {
+        const auto Iterator = TypeUnitTypes.find(Value.Value);
+        return Iterator != TypeUnitTypes.end() ? Iterator->second : 0;
+    }
+    if (!Value.IsReference()) {
+        return 0;
+    }
+    const uint64_t ReferencedOffset = Unit.Sections->BaseOffset + Value.Value;
+    if (TypeUnitTypes.empty()) {
+        return ReferencedOffset;
+    }
+
+    ///Type units refer to the types of the other type units through a stub carrying only the DW_AT_signature of the type
+    const FDwarfUnit* ReferencedUnit = nullptr;
+    const FDwarfEntry* ReferencedEntry = FindEntry(ReferencedOffset, ReferencedUnit);
+    FDwarfAttributeValue SignatureValue{};
+    if (ReferencedEntry != nullptr && FindAttribute(*ReferencedUnit, *ReferencedEntry, EDwarfAttribute::Signature, SignatureValue) && SignatureValue.Form == EDwarfForm::RefSig8) {
+        const auto Iterator = TypeUnitTypes.find(SignatureValue.Value);
+        return Iterator != TypeUnitTypes.end() ? Iterator->second : ReferencedOffset;
+    }
+    return ReferencedOffset;
+}
+
+std::string_view FDwarfSymbolSource::GetEntryName(const FDwarfUnit& Unit, const FDwarfEntry& Entry, uint32_t RecursionDepth) const {
+    FDwarfAttributeValue Value{};
+    std::string_view EntryName;
+    if (FindAttribute(Unit, Entry, EDwarfAttribute::Name, Value) && ResolveDwarfString(Unit.Sections->Strings, Unit.Header, Unit.StrOffsetsBase, Value, EntryName)) {
+        return EntryName;
+    }
+
+    ///Out of line definitions inherit the name of the declaration they complete
+    const FDwarfUnit* SpecificationUnit = nullptr;
+    const uint64_t SpecificationOffset = GetReferenceAttribute(Unit, Entry, EDwarfAttribute::Specification);
+    const FDwarfEntry* SpecificationEntry = SpecificationOffset != 0 ? FindEntry(SpecificationOffset, SpecificationUnit) : nullptr;
+    if (SpecificationEntry != nullptr && SpecificationEntry != &Entry && RecursionDepth < MaxEntryRecursionDepth) {
+        return GetEntryName(*SpecificationUnit, *SpecificationEntry, RecursionDepth + 1);
+    }
+    return {};
+}
+
+std::string FDwarfSymbolSource::GetQualifiedName(const FDwarfUnit& Unit, const FDwarfEntry& Entry, uint32_t RecursionDepth) const {
+    if (RecursionDepth >= MaxEntryRecursionDepth) {
+        return {};
+    }
+    ///Out of line definitions live in the scope of the declaration, not in the scope they are written in
+    const FDwarfUnit* SpecificationUnit = nullptr;
+    const uint64_t SpecificationOffset = GetReferenceAttribute(Unit, Entry, EDwarfAttribute::Specification);
+    const FDwarfEntry* SpecificationEntry = SpecificationOffset != 0 ? FindEntry(SpecificationOffset, SpecificationUnit) : nullptr;
+    if (SpecificationEntry != nullptr && SpecificationEntry != &Entry) {
+        return GetQualifiedName(*SpecificationUnit, *SpecificationEntry, RecursionDepth + 1);
+    }
+
+    std::string_view EntryName = GetEntryName(Unit, Entry);
+    if (EntryName.empty() && IsScopeTag(Entry.Abbreviation->Tag)) {
+        EntryName = GetUnnamedScopeName(Entry.Abbreviation->Tag);
+    }
+
+    const FDwarfEntry* ParentEntry = GetParentEntry(Unit, Entry);
+    if (ParentEntry == nullptr || !IsScopeTag(ParentEntry->Abbreviation->Tag)) {
+        return std::string{EntryName};
+    }
+    std::string QualifiedName = GetQualifiedName(Unit, *ParentEntry, RecursionDepth + 1);
+    QualifiedName.append("::").append(EntryName);
+    return QualifiedName;
+}
+
+uint64_t FDwarfSymbolSource::StripModifiers(uint64_t TypeOffset, bool& OutIsConst, bool& OutIsVolatile) const {
+    for (uint32_t ChainLength = 0; TypeOffset != 0 && ChainLength < MaxTypeChainLength; ChainLength++) {
+        const FDwarfUnit* Unit = nullptr;
+        const FDwarfEntry* Entry = FindEntry(TypeOffset, Unit);
+        if (Entry == nullptr || !IsModifierTag(Entry->Abbreviation->Tag)) {
+            return TypeOffset;
+        }
+        OutIsConst |= Entry->Abbreviation->Tag == EDwarfTag::ConstType;
+        OutIsVolatile |= Entry->Abbreviation->Tag == EDwarfTag::VolatileType;
+        TypeOffset = GetReferenceAttribute(*Unit, *Entry, EDwarfAttribute::Type);
+    }
+    return TypeOffset;
+}
+
+uint64_t FDwarfSymbolSource::ResolveTypeDefinition(uint64_t TypeOffset) const {
+    const FDwarfUnit* Unit = nullptr;
+    const FDwarfEntry* Entry = FindEntry(TypeOffset, Unit);
+    if (Entry == nullptr || !IsDwarfUserDefinedTypeTag(Entry->Abbreviation->Tag) || !HasFlagAttribute(*Unit, *Entry, EDwarfAttribute::Declaration)) {
+        return TypeOffset;
+    }
+
+    ///Units only carry the declarations of the classes they do not need the layout of, the definition is in some other unit
+    const uint64_t DefinitionOffset = FindTypeDefinition(GetQualifiedName(*Unit, *Entry));
+    return DefinitionOffset != 0 ? DefinitionOffset : TypeOffset;
+}
+
+uint64_t FDwarfSymbolSource::GetTypeSize(FSymbolHandle TypeSymbol) const {
+    FSymbolInfo TypeInfo{};
+    for (uint32_t ChainLength = 0; ChainLength < MaxTypeChainLength && GetSymbolInfo(TypeSymbol, TypeInfo); ChainLength++) {
+        if (TypeInfo.Tag != ESymbolTag::Typedef) {
+            return TypeInfo.Length;
+        }
+        TypeSymbol = TypeInfo.Type;
+    }
+    return 0;
+}
+
+uint64_t FDwarfSymbolSource::GetDataMemberLocation(const FDwarfUnit& Unit, const FDwarfEntry& Entry) const {
+    ///Member location is a constant in the modern DWARF, and a DW_OP_plus_uconst expression in DWARF 2. Union members have no location at all
+    FDwarfAttributeValue LocationValue{};
+    uint64_t MemberOffset = 0;
+    if (FindAttribute(Unit, Entry, EDwarfAttribute::DataMemberLocation, LocationValue)) {
+        if (!LocationValue.Block.empty()) {
+            EvaluateDwarfConstantExpression(LocationValue.Block, MemberOffset);
+        } else {
+            MemberOffset = LocationValue.Value;
+        }
+    }
+    return MemberOffset;
+}
+
+const FDwarfEntry* FDwarfSymbolSource::GetBaseClassEntry(const FDwarfUnit& Unit, const FDwarfEntry& InheritanceEntry, const FDwarfUnit*& OutBaseClassUnit) const {
+    bool bIsConst = false, bIsVolatile = false;
+    const uint64_t BaseClassOffset = ResolveTypeDefinition(StripModifiers(GetReferenceAttribute(Unit, InheritanceEntry, EDwarfAttribute::Type), bIsConst, bIsVolatile));
+    return BaseClassOffset != 0 ? FindEntry(BaseClassOffset, OutBaseClassUnit) : nullptr;
+}
+
+bool FDwarfSymbolSource::GetVirtualTableSlot(const FDwarfUnit& Unit, const FDwarfEntry& FunctionEntry, uint64_t& OutVirtualTableSlot) const {
+    uint64_t Virtuality = 0;
+    if (!GetConstantAttribute(Unit, FunctionEntry, EDwarfAttribute::Virtuality, Virtuality) || static_cast<EDwarfVirtuality>(Virtuality) == EDwarfVirtuality::None) {
+        return false;
+    }
+    ///Slot is a DW_OP_constu expression, but some producers emit a plain constant instead
+    OutVirtualTableSlot = 0;
+    FDwarfAttributeValue SlotValue{};
+    if (FindAttribute(Unit, FunctionEntry, EDwarfAttribute::VTableElemLocation, SlotValue)) {
+        if (!SlotValue.Block.empty()) {
+            EvaluateDwarfConstantExpression(SlotValue.Block, OutVirtualTableSlot);
+        } else {
+            OutVirtualTableSlot = SlotValue.Value;
+        }
+    }
+    return true;
+}
+
+uint32_t FDwarfSymbolSource::GetVirtualTableEntryCount(const FDwarfUnit& Unit, const FDwarfEntry& UDTEntry, uint32_t RecursionDepth) const {
+    if (RecursionDepth >= MaxEntryRecursionDepth) {
+        return 0;
+    }
+    std::vector<const FDwarfEntry*> ChildEntries;
+    GetChildEntries(Unit, UDTEntry, ChildEntries);
+
+    uint32_t EntryCount = 0;
+    bool bIsFirstBaseClass = true;
+
+    for (const FDwarfEntry* ChildEntry : ChildEntries) {
+        const EDwarfTag ChildTag = ChildEntry->Abbreviation->Tag;
+
+        ///Virtual functions of the primary base share the virtual table with the derived class
+        if (ChildTag == EDwarfTag::Inheritance && bIsFirstBaseClass) {
+            bIsFirstBaseClass = false;
+            const FDwarfUnit* BaseClassUnit = nullptr;
+            const FDwarfEntry* BaseClassEntry = GetBaseClassEntry(Unit, *ChildEntry, BaseClassUnit);
+
+            if (BaseClassEntry != nullptr && BaseClassEntry != &UDTEntry && !HasFlagAttribute(Unit, *ChildEntry, EDwarfAttribute::Virtuality) && GetDataMemberLocation(Unit, *ChildEntry) == 0) {
+                EntryCount = std::max(EntryCount, GetVirtualTableEntryCount(*BaseClassUnit, *BaseClassEntry, RecursionDepth + 1));
+            }
+        }
+
+        uint64_t VirtualTableSlot = 0;
+        if (ChildTag == EDwarfTag::Subprogram && GetVirtualTableSlot(Unit, *ChildEntry, VirtualTableSlot)) {
+            auto FunctionEntryCount = static_cast<uint32_t>(VirtualTableSlot + 1);
+
+            ///Itanium ABI virtual destructors take two slots, one for the complete object destructor and one for the deleting destructor
+            if (GetEntryName(Unit, *ChildEntry).starts_with('~')) {
+                FunctionEntryCount++;
+            }
+            EntryCount = std::max(EntryCount, FunctionEntryCount);
+        }
+    }
+    return EntryCount;
+}
+
+bool FDwarfSymbolSource::IsOverridingBaseFunction(const FDwarfUnit& Unit, const FDwarfEntry& UDTEntry, std::string_view FunctionName, uint64_t VirtualTableSlot, bool bIsPrimaryBaseChain, uint32_t RecursionDepth) const {
+    if (RecursionDepth >= MaxEntryRecursionDepth) {
+        return false;
+    }
+    std::vector<const FDwarfEntry*> ChildEntries;
+    GetChildEntries(Unit, UDTEntry, ChildEntries);
+    bool bIsFirstBaseClass = true;
+
+    for (const FDwarfEntry* ChildEntry : ChildEntries) {
+        if (ChildEntry->Abbreviation->Tag != EDwarfTag::Inheritance) {
+            continue;
+        }
+        const FDwarfUnit* BaseClassUnit = nullptr;
+        const FDwarfEntry* BaseClassEntry = GetBaseClassEntry(Unit, *ChildEntry, BaseClassUnit);
+        const bool bIsPrimaryBase = bIsPrimaryBaseChain && bIsFirstBaseClass && !HasFlagAttribute(Unit, *ChildEntry, EDwarfAttribute::Virtuality);
+        bIsFirstBaseClass = false;
+
+        if (BaseClassEntry == nullptr || BaseClassEntry == &UDTEntry) {
+            continue;
+        }
+
+        ///Overrides of the primary base functions reuse their slots, which tells the overloads apart. Other bases have their own tables, so we can only match the names
+        std::vector<const FDwarfEntry*> BaseClassChildEntries;
+        GetChildEntries(*BaseClassUnit, *BaseClassEntry, BaseClassChildEntries);
+
+        for (const FDwarfEntry* BaseClassChildEntry : BaseClassChildEntries) {
+            uint64_t BaseFunctionSlot = 0;
+            if (BaseClassChildEntry->Abbreviation->Tag == EDwarfTag::Subprogram && GetEntryName(*BaseClassUnit, *BaseClassChildEntry) == FunctionName &&
+                GetVirtualTableSlot(*BaseClassUnit, *BaseClassChildEntry, BaseFunctionSlot) && (!bIsPrimaryBase || BaseFunctionSlot == VirtualTableSlot)) {
+                return true;
+            }
+        }
+        if (IsOverridingBaseFunction(*BaseClassUnit, *BaseClassEntry, FunctionName, VirtualTableSlot, bIsPrimaryBase, RecursionDepth + 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+EMemberAccess FDwarfSymbolSource::GetMemberAccess(const FDwarfUnit& Unit, const FDwarfEntry& Entry) const {
+    uint64_t Accessibility = 0;
+    if (GetConstantAttribute(Unit, Entry, EDwarfAttribute::Accessibility, Accessibility)) {
+        switch (static_cast<EDwarfAccessibility>(Accessibility)) {
+            case EDwarfAccessibility::Public: return EMemberAccess::Public;
+            case EDwarfAccessibility::Protected: return EMemberAccess::Protected;
+            case EDwarfAccessibility::Private: return EMemberAccess::Private;
+            default: return EMemberAccess::Unspecified;
+        }
+    }
+    ///Compilers only emit the accessibility when it differs from the default one, which is private for classes and public for everything else
+    ///DWARF 2 did not have the private default yet, everything was public unless said otherwise
+    const FDwarfEntry* ParentEntry = GetParentEntry(Unit, Entry);
+    if (Unit.Header.Version > 2 && ParentEntry != nullptr && ParentEntry->Abbreviation->Tag == EDwarfTag::ClassType) {
+        return EMemberAccess::Private;
+    }
+    return EMemberAccess::Public;
+}
+
+bool FDwarfSymbolSource::GetUserDefinedTypeInfo(const FDwarfUnit& Unit, const FDwarfEntry& Entry, FSymbolInfo& OutInfo) const {
+    OutInfo.Tag = ESymbolTag::UDT;
+    switch (Entry.Abbreviation->Tag) {
+        case EDwarfTag::ClassType: OutInfo.UDTKind = EUDTKind::Class; break;
+        case EDwarfTag::UnionType: OutInfo.UDTKind = EUDTKind::Union; break;
+        case EDwarfTag::InterfaceType: OutInfo.UDTKind = EUDTKind::Interface; break;
+        default: OutInfo.UDTKind = EUDTKind::Struct; break;
+    }
+    GetConstantAttribute(Unit, Entry, EDwarfAttribute::ByteSize, OutInfo.Length);
+
+    ///Same as DIA, the type is considered to have a constructor if it declares either a constructor or a destructor
+    const std::string_view ClassName = GetClassNameWithoutTemplateArguments(GetEntryName(Unit, Entry));
+    std::vector<const FDwarfEntry*> ChildEntries;
+    GetChildEntries(Unit, Entry, ChildEntries);
+
+    for (const FDwarfEntry* ChildEntry : ChildEntries) {
+        if (ChildEntry->Abbreviation->Tag != EDwarfTag::Subprogram) {
+            continue;
+        }
+        std::string_view FunctionName = GetEntryName(Unit, *ChildEntry);
+        if (FunctionName.starts_with('~')) {
+            FunctionName.remove_prefix(1);
+        }
+        if (!ClassName.empty() && GetClassNameWithoutTemplateArguments(FunctionName) == ClassName) {
+            OutInfo.bHasConstructor = true;
+            break;
+        }
+    }
+    OutInfo.Count = GetVirtualTableEntryCount(Unit, Entry);
+    return true;
+}
+
+bool FDwarfSymbolSource::GetArrayDimensionInfo(const FDwarfUnit& Unit, const FDwarfEntry& Entry, uint32_t Dimension, FSymbolInfo& OutInfo) const {
+    std::vector<const FDwarfEntry*> ChildEntries;
+    GetChildEntries(Unit, Entry, ChildEntries);
+
+    std::vector<const FDwarfEntry*> Subranges;
+    for (const FDwarfEntry* ChildEntry : ChildEntries) {
+        if (ChildEntry->Abbreviation->Tag == EDwarfTag::SubrangeType) {
+            Subranges.push_back(ChildEntry);
+        }
+    }
+    if (Dimension != 0 && Dimension >= Subranges.size()) {
+        return false;
+    }
+    OutInfo.Tag = ESymbolTag::ArrayType;
+
+    ///Element count is either given directly, or as the upper bound of the index. Unsized arrays have neither
+    if (Dimension < Subranges.size()) {
+        const FDwarfEntry& Subrange = *Subranges[Dimension];
+        FDwarfAttributeValue BoundValue{};
+        uint64_t LowerBound = 0;
+        if (FindAttribute(Unit, Subrange, EDwarfAttribute::Count, BoundValue) && !BoundValue.IsReference() && BoundValue.Block.empty()) {
+            OutInfo.Count = static_cast<uint32_t>(BoundValue.Value);
+        } else if (FindAttribute(Unit, Subrange, EDwarfAttribute::UpperBound, BoundValue) && !BoundValue.IsReference() && BoundValue.Block.empty()) {
+            GetConstantAttribute(Unit, Subrange, EDwarfAttribute::LowerBound, LowerBound);
+            const bool bIsEmptyRange = BoundValue.IsSigned() ? static_cast<int64_t>(BoundValue.Value) < static_cast<int64_t>(LowerBound) : BoundValue.Value < LowerBound;
+            OutInfo.Count = bIsEmptyRange ? 0 : static_cast<uint32_t>(BoundValue.Value - LowerBound + 1);
+        }
+    }
+
+    if (Dimension + 1 < Subranges.size()) {
+        OutInfo.Type = MakeEntryHandle(Entry.Offset, static_cast<uint32_t>(EDwarfHandleVariant::ArrayDimension) + Dimension + 1);
+    } else {
+        OutInfo.Type = MakeTypeHandle(GetReferenceAttribute(Unit, Entry, EDwarfAttribute::Type));
+    }
+    OutInfo.Length = OutInfo.Count * GetTypeSize(OutInfo.Type);
+    return true;
+}
+
+bool FDwarfSymbolSource::GetMemberInfo(const FDwarfUnit& Unit, const FDwarfEntry& Entry, FSymbolInfo& OutInfo) const {
+    OutInfo.Tag = ESymbolTag::Data;
+    OutInfo.Type = MakeTypeHandle(GetReferenceAttribute(Unit, Entry, EDwarfAttribute::Type));
+    OutInfo.Access = GetMemberAccess(Unit, Entry);
+    OutInfo.bIsCompilerGenerated = HasFlagAttribute(Unit, Entry, EDwarfAttribute::Artificial);
+
+    ///Static data members are declarations, which are DW_TAG_variable starting with DWARF 5 and external DW_TAG_member before that
+    if (Entry.Abbreviation->Tag == EDwarfTag::Variable || HasFlagAttribute(Unit, Entry, EDwarfAttribute::External) || HasFlagAttribute(Unit, Entry, EDwarfAttribute::Declaration)) {
+        OutInfo.Location = EDataLocation::Other;
+        OutInfo.bIsStatic = true;
+        return true;
+    }
+
+    const uint64_t MemberOffset = GetDataMemberLocation(Unit, Entry);
+    const uint64_t TypeSize = GetTypeSize(OutInfo.Type);
+
+    uint64_t BitSize = 0;
+    if (!GetConstantAttribute(Unit, Entry, EDwarfAttribute::BitSize, BitSize)) {
+        OutInfo.Location = EDataLocation::ThisRelative;
+        OutInfo.Offset = static_cast<int32_t>(MemberOffset);
+        OutInfo.Length = TypeSize;
+        return true;
+    }
+
+    ///Bitfields are described relative to the storage unit of their type, the same way MSVC describes them
+    OutInfo.Location = EDataLocation::BitField;
+    OutInfo.Length = BitSize;
+    uint64_t DataBitOffset = 0;
+    uint64_t BitOffset = 0;
+
+    if (GetConstantAttribute(Unit, Entry, EDwarfAttribute::DataBitOffset, DataBitOffset)) {
+        const uint64_t StorageSize = TypeSize != 0 ? TypeSize : 1;
+        const uint64_t StorageOffset = DataBitOffset / (StorageSize * 8) * StorageSize;
+        OutInfo.Offset = static_cast<int32_t>(StorageOffset);
+        OutInfo.BitPosition = static_cast<uint32_t>(DataBitOffset - StorageOffset * 8);
+    } else if (GetConstantAttribute(Unit, Entry, EDwarfAttribute::BitOffset, BitOffset)) {
+        ///DWARF 2 counts the bit offset from the most significant bit of the storage unit
+        uint64_t StorageSize = TypeSize;
+        GetConstantAttribute(Unit, Entry, EDwarfAttribute::ByteSize, StorageSize);
+        OutInfo.Offset = static_cast<int32_t>(MemberOffset);
+        OutInfo.BitPosition = static_cast<uint32_t>(StorageSize * 8 - BitOffset - BitSize);
+    } else {
+        OutInfo.Offset = static_cast<int32_t>(MemberOffset);
+    }
+    return true;
+}
+
+bool FDwarfSymbolSource::GetFunctionInfo(const FDwarfUnit& Unit, const FDwarfEntry& Entry, FSymbolInfo& OutInfo) const {
+    OutInfo.Tag = ESymbolTag::Function;
+    OutInfo.Type = MakeEntryHandle(Entry.Offset, static_cast<uint32_t>(EDwarfHandleVariant::FunctionType));
+    OutInfo.Access = GetMemberAccess(Unit, Entry);
+    OutInfo.bIsCompilerGenerated = HasFlagAttribute(Unit, Entry, EDwarfAttribute::Artificial);
+
+    uint64_t VirtualTableSlot = 0;
+    if (GetVirtualTableSlot(Unit, Entry, VirtualTableSlot)) {
+        uint64_t Virtuality = 0;
+        GetConstantAttribute(Unit, Entry, EDwarfAttribute::Virtuality, Virtuality);
+        OutInfo.bIsVirtual = true;
+        OutInfo.bIsPureVirtual = static_cast<EDwarfVirtuality>(Virtuality) == EDwarfVirtuality::PureVirtual;
+        OutInfo.VirtualBaseOffset = static_cast<int32_t>(VirtualTableSlot * Unit.Header.AddressSize);
+    }
+
+    ///Member functions receive the object pointer as the first, artificial, parameter. Static functions do not have it,
+    ///and the const member functions point it to the const object
+    std::vector<const FDwarfEntry*> ChildEntries;
+    GetChildEntries(Unit, Entry, ChildEntries);
+    const auto FirstParameter = std::find_if(ChildEntries.begin(), ChildEntries.end(), [](const FDwarfEntry* ChildEntry) {
+        return ChildEntry->Abbreviation->Tag == EDwarfTag::FormalParameter;
+    });
+
+    if (FirstParameter != ChildEntries.end() && HasFlagAttribute(Unit, **FirstParameter, EDwarfAttribute::Artificial)) {
+        bool bIsConst = false, bIsVolatile = false;
+        const uint64_t ThisPointerOffset = StripModifiers(GetReferenceAttribute(Unit, **FirstParameter, EDwarfAttribute::Type), bIsConst, bIsVolatile);
+        const FDwarfUnit* ThisPointerUnit = nullptr;
+        const FDwarfEntry* ThisPointerEntry = ThisPointerOffset != 0 ? FindEntry(ThisPointerOffset, ThisPointerUnit) : nullptr;
+
+        if (ThisPointerEntry != nullptr) {
+            bool bIsObjectConst = false, bIsObjectVolatile = false;
+            StripModifiers(GetReferenceAttribute(*ThisPointerUnit, *ThisPointerEntry, EDwarfAttribute::Type), bIsObjectConst, bIsObjectVolatile);
+            OutInfo.bIsConst = bIsObjectConst;
+        }
+    } else {
+        OutInfo.bIsStatic = true;
+    }
+
+    ///Virtual function is an intro virtual unless it overrides the function of one of the base classes
+    const FDwarfEntry* ParentEntry = GetParentEntry(Unit, Entry);
+    if (OutInfo.bIsVirtual && ParentEntry != nullptr && IsDwarfUserDefinedTypeTag(ParentEntry->Abbreviation->Tag)) {
+        OutInfo.bIsIntroVirtual = !IsOverridingBaseFunction(Unit, *ParentEntry, GetEntryName(Unit, Entry), VirtualTableSlot, true);
+    }
+    return true;
+}
+
+FSymbolHandle FDwarfSymbolSource::FindUserDefinedType(const std::string& TypeName) const {
+    const uint64_t DefinitionOffset = FindTypeDefinition(TypeName);
+    if (DefinitionOffset == 0) {
+        return FSymbolHandle{};
+    }
+    return MakeEntryHandle(DefinitionOffset);
+}
+
+bool FDwarfSymbolSource::GetSymbolInfo(FSymbolHandle Symbol, FSymbolInfo& OutInfo) const {
+    OutInfo = FSymbolInfo{};
+    if (!Symbol.IsValid()) {
+        return false;
+    }
+    if ((Symbol.Id & VoidHandleFlag) != 0) {
+        OutInfo.Tag = ESymbolTag::BaseType;
+        OutInfo.BasicType = EBasicType::Void;
+        OutInfo.bIsConst = (Symbol.Id & VoidHandleConstFlag) != 0;
+        OutInfo.bIsVolatile = (Symbol.Id & VoidHandleVolatileFlag) != 0;
+        return true;
+    }
+    const auto Variant = static_cast<uint32_t>(Symbol.Id >> HandleVariantShift);
+    uint64_t EntryOffset = Symbol.Id & HandleOffsetMask;
+
+    ///Modifiers are folded into the type they modify, and the class declarations are replaced with their definitions
+    bool bIsConst = false, bIsVolatile = false;
+    if (Variant == static_cast<uint32_t>(EDwarfHandleVariant::Entry)) {
+        EntryOffset = StripModifiers(EntryOffset, bIsConst, bIsVolatile);
+        if (EntryOffset == 0) {
+            return GetSymbolInfo(MakeVoidHandle(bIsConst, bIsVolatile), OutInfo);
+        }
+        EntryOffset = ResolveTypeDefinition(EntryOffset);
+    }
+
+    const FDwarfUnit* Unit = nullptr;
+    const FDwarfEntry* Entry = FindEntry(EntryOffset, Unit);
+    if (Entry == nullptr) {
+        return false;
+    }
+
+    if (Variant == static_cast<uint32_t>(EDwarfHandleVariant::FunctionType)) {
+        OutInfo.Tag = ESymbolTag::FunctionType;
+        OutInfo.Type = MakeTypeHandle(GetReferenceAttribute(*Unit, *Entry, EDwarfAttribute::Type));
+
+        const FDwarfEntry* ParentEntry = GetParentEntry(*Unit, *Entry);
+        if (ParentEntry != nullptr && IsDwarfUserDefinedTypeTag(ParentEntry->Abbreviation->Tag)) {
+            OutInfo.ClassParent = MakeEntryHandle(ParentEntry->Offset);
+        }
+        return true;
+    }
+    if (Variant == static_cast<uint32_t>(EDwarfHandleVariant::MemberFunctionPointerType)) {
+        bool bIsFunctionConst = false, bIsFunctionVolatile = false;
+        const uint64_t FunctionTypeOffset = StripModifiers(GetReferenceAttribute(*Unit, *Entry, EDwarfAttribute::Type), bIsFunctionConst, bIsFunctionVolatile);
+        const FDwarfUnit* FunctionTypeUnit = nullptr;
+        const FDwarfEntry* FunctionTypeEntry = FindEntry(FunctionTypeOffset, FunctionTypeUnit);
+        if (FunctionTypeEntry == nullptr) {
+            return false;
+        }
+        OutInfo.Tag = ESymbolTag::FunctionType;
+        OutInfo.Type = MakeTypeHandle(GetReferenceAttribute(*FunctionTypeUnit, *FunctionTypeEntry, EDwarfAttribute::Type));
+        OutInfo.ClassParent = MakeTypeHandle(GetReferenceAttribute(*Unit, *Entry, EDwarfAttribute::ContainingType));
+        return true;
+    }
+    if (Variant > static_cast<uint32_t>(EDwarfHandleVariant::ArrayDimension)) {
+        return GetArrayDimensionInfo(*Unit, *Entry, Variant - static_cast<uint32_t>(EDwarfHandleVariant::ArrayDimension), OutInfo);
+    }
+
+    bool bSucceeded = true;
+    switch (Entry->Abbreviation->Tag) {
+        case EDwarfTag::ClassType:
+        case EDwarfTag::StructureType:
+        case EDwarfTag::UnionType:
+        case EDwarfTag::InterfaceType:
+            bSucceeded = GetUserDefinedTypeInfo(*Unit, *Entry, OutInfo);
+            break;
+        case EDwarfTag::EnumerationType: {
+            OutInfo.Tag = ESymbolTag::Enum;
+            GetConstantAttribute(*Unit, *Entry, EDwarfAttribute::ByteSize, OutInfo.Length);
+            const uint64_t UnderlyingTypeOffset = GetReferenceAttribute(*Unit, *Entry, EDwarfAttribute::Type);
+            if (UnderlyingTypeOffset != 0) {
+                OutInfo.Type = MakeEntryHandle(UnderlyingTypeOffset);
+            }
+            break;
+        }
+        case EDwarfTag::BaseType: {
+            uint64_t Encoding = 0;
+            OutInfo.Tag = ESymbolTag::BaseType;
+            GetConstantAttribute(*Unit, *Entry, EDwarfAttribute::ByteSize, OutInfo.Length);
+            GetConstantAttribute(*Unit, *Entry, EDwarfAttribute::Encoding, Encoding);
+            OutInfo.BasicType = ConvertBaseTypeEncoding(static_cast<EDwarfBaseTypeEncoding>(Encoding), GetEntryName(*Unit, *Entry), OutInfo.Length);
+            break;
+        }
+        ///decltype(nullptr) is the only unspecified type C++ compilers emit, and it has no basic type equivalent
+        case EDwarfTag::UnspecifiedType:
+            OutInfo.Tag = ESymbolTag::BaseType;
+            OutInfo.Length = Unit->Header.AddressSize;
+            GetConstantAttribute(*Unit, *Entry, EDwarfAttribute::ByteSize, OutInfo.Length);
+            break;
+        ///Same as DIA, typedefs report the size of the type they alias
+        case EDwarfTag::Typedef:
+            OutInfo.Tag = ESymbolTag::Typedef;
+            OutInfo.Type = MakeTypeHandle(GetReferenceAttribute(*Unit, *Entry, EDwarfAttribute::Type));
+            OutInfo.Length = GetTypeSize(OutInfo.Type);
+            break;
+        case EDwarfTag::PointerType:
+        case EDwarfTag::ReferenceType:
+        case EDwarfTag::RValueReferenceType:
+            OutInfo.Tag = ESymbolTag::PointerType;
+            OutInfo.Type = MakeTypeHandle(GetReferenceAttribute(*Unit, *Entry, EDwarfAttribute::Type));
+            OutInfo.bIsReference = Entry->Abbreviation->Tag != EDwarfTag::PointerType;
+            OutInfo.Length = Unit->Header.AddressSize;
+            GetConstantAttribute(*Unit, *Entry, EDwarfAttribute::ByteSize, OutInfo.Length);
+            break;
+        case EDwarfTag::PtrToMemberType: {
+            bool bIsPointeeConst = false, bIsPointeeVolatile = false;
+            const uint64_t PointeeTypeOffset = GetReferenceAttribute(*Unit, *Entry, EDwarfAttribute::Type);
+            const FDwarfUnit* PointeeUnit = nullptr;
+            const FDwarfEntry* PointeeEntry = FindEntry(StripModifiers(PointeeTypeOffset, bIsPointeeConst, bIsPointeeVolatile), PointeeUnit);
+
+            ///Itanium ABI member function pointers are a pair of the function pointer and the this adjustment, member data pointers are a plain offset
+            OutInfo.Tag = ESymbolTag::PointerType;
+            if (PointeeEntry != nullptr && PointeeEntry->Abbreviation->Tag == EDwarfTag::SubroutineType) {
+                OutInfo.Type = MakeEntryHandle(Entry->Offset, static_cast<uint32_t>(EDwarfHandleVariant::MemberFunctionPointerType));
+                OutInfo.Length = Unit->Header.AddressSize * 2;
+            } else {
+                OutInfo.Type = MakeTypeHandle(PointeeTypeOffset);
+                OutInfo.Length = Unit->Header.AddressSize;
+            }
+            GetConstantAttribute(*Unit, *Entry, EDwarfAttribute::ByteSize, OutInfo.Length);
+            break;
+        }
+        case EDwarfTag::ArrayType:
+            bSucceeded = GetArrayDimensionInfo(*Unit, *Entry, 0, OutInfo);
+            break;
+        case EDwarfTag::SubroutineType:
+            OutInfo.Tag = ESymbolTag::FunctionType;
+            OutInfo.Type = MakeTypeHandle(GetReferenceAttribute(*Unit, *Entry, EDwarfAttribute::Type));
+            break;
+        case EDwarfTag::Member:
+        case EDwarfTag::Variable:
+            bSucceeded = GetMemberInfo(*Unit, *Entry, OutInfo);
+            break;
+        case EDwarfTag::Inheritance: {
+            OutInfo.Tag = ESymbolTag::BaseClass;
+            OutInfo.Type = MakeTypeHandle(GetReferenceAttribute(*Unit, *Entry, EDwarfAttribute::Type));
+            OutInfo.Access = GetMemberAccess(*Unit, *Entry);
+            OutInfo.bIsVirtual = HasFlagAttribute(*Unit, *Entry, EDwarfAttribute::Virtuality);
+
+            ///Offsets of the virtual bases are only known at runtime and are described by an expression reading the virtual table
+            if (!OutInfo.bIsVirtual) {
+                OutInfo.Offset = static_cast<int32_t>(GetDataMemberLocation(*Unit, *Entry));
+            }
+            FSymbolInfo BaseClassInfo{};
+            if (GetSymbolInfo(OutInfo.Type, BaseClassInfo)) {
+                OutInfo.Length = BaseClassInfo.Length;
+                OutInfo.bHasConstructor = BaseClassInfo.bHasConstructor;
+            }
+            break;
+        }
+        case EDwarfTag::Subprogram:
+            bSucceeded = GetFunctionInfo(*Unit, *Entry, OutInfo);
+            break;
+        case EDwarfTag::FormalParameter:
+            OutInfo.Tag = ESymbolTag::FunctionArgType;
+            OutInfo.Type = MakeTypeHandle(GetReferenceAttribute(*Unit, *Entry, EDwarfAttribute::Type));
+            break;
+        default:
+            return false;
+    }
+    OutInfo.bIsConst |= bIsConst;
+    OutInfo.bIsVolatile |= bIsVolatile;
+    return bSucceeded;
+}
+
+std::string FDwarfSymbolSource::GetSymbolName(FSymbolHandle Symbol) const {
+    if ((Symbol.Id & VoidHandleFlag) != 0) {
+        return "void";
+    }
+    if (!Symbol.IsValid() || (Symbol.Id >> HandleVariantShift) != static_cast<uint64_t>(EDwarfHandleVariant::Entry)) {
+        return std::string{};
+    }
+    bool bIsConst = false, bIsVolatile = false;
+    const uint64_t EntryOffset = StripModifiers(Symbol.Id & HandleOffsetMask, bIsConst, bIsVolatile);
+    if (EntryOffset == 0) {
+        return "void";
+    }
+    const FDwarfUnit* Unit = nullptr;
+    const FDwarfEntry* Entry = FindEntry(EntryOffset, Unit);
+    if (Entry == nullptr) {
+        return std::string{};
+    }
+
+    switch (Entry->Abbreviation->Tag) {
+        ///Types are referenced by their fully qualified names
+        case EDwarfTag::ClassType:
+        case EDwarfTag::StructureType:
+        case EDwarfTag::UnionType:
+        case EDwarfTag::InterfaceType:
+        case EDwarfTag::EnumerationType:
+        case EDwarfTag::Typedef:
+            return GetQualifiedName(*Unit, *Entry);
+        ///Base classes are named after the class they refer to
+        case EDwarfTag::Inheritance: {
+            const uint64_t BaseClassOffset = StripModifiers(GetReferenceAttribute(*Unit, *Entry, EDwarfAttribute::Type), bIsConst, bIsVolatile);
+            const FDwarfUnit* BaseClassUnit = nullptr;
+            const FDwarfEntry* BaseClassEntry = BaseClassOffset != 0 ? FindEntry(BaseClassOffset, BaseClassUnit) : nullptr;
+            return BaseClassEntry != nullptr ? GetQualifiedName(*BaseClassUnit, *BaseClassEntry) : std::string{};
+        }
+        default:
+            return std::string{GetEntryName(*Unit, *Entry)};
+    }
+}
+
+void FDwarfSymbolSource::GetChildren(FSymbolHandle Symbol, ESymbolTag ChildTag, std::vector<FSymbolHandle>& OutChildren) const {
+    if (!Symbol.IsValid() || (Symbol.Id & VoidHandleFlag) != 0) {
+        return;
+    }
+    const auto Variant = static_cast<uint32_t>(Symbol.Id >> HandleVariantShift);
+    uint64_t EntryOffset = Symbol.Id & HandleOffsetMask;
+
+    if (Variant == static_cast<uint32_t>(EDwarfHandleVariant::Entry)) {
+        bool bIsConst = false, bIsVolatile = false;
+        EntryOffset = ResolveTypeDefinition(StripModifiers(EntryOffset, bIsConst, bIsVolatile));
+    } else if (Variant == static_cast<uint32_t>(EDwarfHandleVariant::MemberFunctionPointerType)) {
+        ///Arguments of the member function pointer types are the arguments of the function type it points to
+        const FDwarfUnit* PointerUnit = nullptr;
+        const FDwarfEntry* PointerEntry = FindEntry(EntryOffset, PointerUnit);
+        bool bIsConst = false, bIsVolatile = false;
+        EntryOffset = PointerEntry != nullptr ? StripModifiers(GetReferenceAttribute(*PointerUnit, *PointerEntry, EDwarfAttribute::Type), bIsConst, bIsVolatile) : 0;
+    } else if (Variant != static_cast<uint32_t>(EDwarfHandleVariant::FunctionType)) {
+        return;
+    }
+
+    const FDwarfUnit* Unit = nullptr;
+    const FDwarfEntry* Entry = EntryOffset != 0 ? FindEntry(EntryOffset, Unit) : nullptr;
+    if (Entry == nullptr) {
+        return;
+    }
+    const EDwarfTag EntryTag = Entry->Abbreviation->Tag;
+
+    std::vector<const FDwarfEntry*> ChildEntries;
+    GetChildEntries(*Unit, *Entry, ChildEntries);
+
+    for (const FDwarfEntry* ChildEntry : ChildEntries) {
+        const EDwarfTag ChildEntryTag = ChildEntry->Abbreviation->Tag;
+        bool bIsMatchingChild = false;
+
+        if (IsDwarfUserDefinedTypeTag(EntryTag)) {
+            bIsMatchingChild = (ChildTag == ESymbolTag::BaseClass && ChildEntryTag == EDwarfTag::Inheritance) ||
+                (ChildTag == ESymbolTag::Data && (ChildEntryTag == EDwarfTag::Member || ChildEntryTag == EDwarfTag::Variable)) ||
+                (ChildTag == ESymbolTag::Function && ChildEntryTag == EDwarfTag::Subprogram);
+        } else if (EntryTag == EDwarfTag::Subprogram || EntryTag == EDwarfTag::SubroutineType) {
+            ///The object pointer is not a part of the signature
+            bIsMatchingChild = ChildTag == ESymbolTag::FunctionArgType && ChildEntryTag == EDwarfTag::FormalParameter &&
+                !HasFlagAttribute(*Unit, *ChildEntry, EDwarfAttribute::Artificial);
+        }
+        if (bIsMatchingChild) {
+            OutChildren.push_back(MakeEntryHandle(ChildEntry->Offset));
+        }
+    }
+}
+
+bool FDwarfSymbolSource::GetSourceLine(FSymbolHandle Symbol, std::string& OutSourceFilePath, int32_t& OutLineNumber) const {
+    if (!Symbol.IsValid() || (Symbol.Id & VoidHandleFlag) != 0 || (Symbol.Id >> HandleVariantShift) != static_cast<uint64_t>(EDwarfHandleVariant::Entry)) {
+        return false;
+    }
+    bool bIsConst = false, bIsVolatile = false;
+    const uint64_t EntryOffset = ResolveTypeDefinition(StripModifiers(Symbol.Id & HandleOffsetMask, bIsConst, bIsVolatile));
+    const FDwarfUnit* Unit = nullptr;
+    const FDwarfEntry* Entry = EntryOffset != 0 ? FindEntry(EntryOffset, Unit) : nullptr;
+    if (Entry == nullptr) {
+        return false;
+    }
+
+    uint64_t FileIndex = 0;
+    uint64_t LineNumber = 0;
+    if (!GetConstantAttribute(*Unit, *Entry, EDwarfAttribute::DeclFile, FileIndex) || !GetConstantAttribute(*Unit, *Entry, EDwarfAttribute::DeclLine, LineNumber)) {
+        return false;
+    }
+    if (!GetSourceFileName(*Unit, FileIndex, OutSourceFilePath)) {
+        return false;
+    }
+    OutLineNumber = static_cast<int32_t>(LineNumber);
+    return true;
+}
+
+const FDwarfLineTableFiles* FDwarfSymbolSource::GetLineTableFiles(const FDwarfUnit& Unit) const {
+    ///Every type of the unit looks its file up in the same header, so the header is only decoded once per unit
+    std::call_once(UnitLineTableFlags[&Unit - Units.data()], [this, &Unit]() {
+        Unit.LineTableFiles = ReadLineTableFiles(Unit);
+    });
+    return Unit.LineTableFiles.get();
+}
+
+std::unique_ptr<FDwarfLineTableFiles> FDwarfSymbolSource::ReadLineTableFiles(const FDwarfUnit& Unit) const {
+    if (!Unit.bHasStmtList) {
+        return nullptr;
+    }
+    FBinaryReader Reader{GetLineSection()};
+    if (!Reader.Seek(static_cast<size_t>(Unit.StmtList))) {
+        return nullptr;
+    }
+
+    ///The line table header has its own format, so the forms of its entries are read in the context of a made up unit
+    FDwarfUnitHeader LineTableUnit{};
+    uint32_t UnitLength32 = 0;
+    uint64_t HeaderLength = 0;
+    if (!Reader.Read(UnitLength32)) {
+        return nullptr;
+    }
+    if (UnitLength32 == 0xFFFFFFFF) {
+        uint64_t UnitLength = 0;
+        LineTableUnit.bIs64Bit = true;
+        if (!Reader.Read(UnitLength)) {
+            return nullptr;
+        }
+    }
+    if (!Reader.Read(LineTableUnit.Version) || LineTableUnit.Version < 2 || LineTableUnit.Version > 5) {
+        return nullptr;
+    }
+    LineTableUnit.AddressSize = Unit.Header.AddressSize;
+    if (LineTableUnit.Version >= 5) {
+        uint8_t SegmentSelectorSize = 0;
+        if (!Reader.Read(LineTableUnit.AddressSize) || !Reader.Read(SegmentSelectorSize)) {
+            return nullptr;
+        }
+    }
+    if (LineTableUnit.bIs64Bit ? !Reader.Read(HeaderLength) : !Reader.Read(UnitLength32)) {
+        return nullptr;
+    }
+
+    ///Skip over the parameters of the line number program, down to the lengths of the standard opcodes
+    uint8_t MinimumInstructionLength = 0, MaximumOperationsPerInstruction = 0, DefaultIsStatement = 0, LineRange = 0, OpcodeBase = 0;
+    int8_t LineBase = 0;
+    if (!Reader.Read(MinimumInstructionLength) || (LineTableUnit.Version >= 4 && !Reader.Read(MaximumOperationsPerInstruction)) ||
+        !Reader.Read(DefaultIsStatement) || !Reader.Read(LineBase) || !Reader.Read(LineRange) || !Reader.Read(OpcodeBase) ||
+        OpcodeBase == 0 || !Reader.Skip(OpcodeBase - 1)) {
+        return nullptr;
+    }
+
+    ///Files listed before a malformed entry are kept, so the types declared in them still get their source lines
+    auto LineTableFiles = std::make_unique<FDwarfLineTableFiles>();
+    if (LineTableUnit.Version >= 5) {
+        ///DWARF 5 describes the directory and the file entries with the lists of the content types and forms. Both lists are 0-based
+        const auto ReadEntries = [&](bool bIsFileList) -> bool {
+            uint8_t NumFormats = 0;
+            if (!Reader.Read(NumFormats)) {
+                return false;
+            }
+            std::vector<std::pair<uint64_t, uint64_t>> EntryFormats(NumFormats);
+            for (auto& [ContentType, Form] : EntryFormats) {
+                if (!Reader.ReadULEB128(ContentType) || !Reader.ReadULEB128(Form)) {
+                    return false;
+                }
+            }
+            uint64_t NumEntries = 0;
+            if (!Reader.ReadULEB128(NumEntries)) {
+                return false;
+            }
+            for (uint64_t EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++) {
+                std::string_view EntryPath;
+                uint64_t EntryDirectoryIndex = 0;
+                for (const auto& [ContentType, Form] : EntryFormats) {
+                    FDwarfAttributeValue Value{};
+                    if (!ReadDwarfFormValue(Reader, static_cast<EDwarfForm>(Form), LineTableUnit, Value)) {
+                        return false;
+                    }
+                    if (ContentType == DwarfLineContentPath) {
+                        ResolveDwarfString(FileSections.Strings, LineTableUnit, Unit.StrOffsetsBase, Value, EntryPath);
+                    } else if (ContentType == DwarfLineContentDirectoryIndex) {
+                        EntryDirectoryIndex = Value.Value;
+                    }
+                }
+                if (!bIsFileList) {
+                    LineTableFiles->Directories.push_back(EntryPath);
+                } else {
+                    LineTableFiles->Files.emplace_back(EntryPath, EntryDirectoryIndex);
+                }
+            }
+            return true;
+        };
+        if (ReadEntries(false)) {
+            ReadEntries(true);
+        }
+    } else {
+        ///Older versions list the include directories and then the files as null terminated lists. Both are 1-based, 0 being the compilation directory
+        LineTableFiles->FirstFileIndex = 1;
+        LineTableFiles->Directories.push_back(Unit.CompilationDirectory);
+        std::string_view DirectoryName;
+        while (Reader.ReadCString(DirectoryName) && !DirectoryName.empty()) {
+            LineTableFiles->Directories.push_back(DirectoryName);
+        }
+        std::string_view EntryPath;
+        while (Reader.ReadCString(EntryPath) && !EntryPath.empty()) {
+            uint64_t EntryDirectoryIndex = 0, ModificationTime = 0, FileSize = 0;
+            if (!Reader.ReadULEB128(EntryDirectoryIndex) || !Reader.ReadULEB128(ModificationTime) || !Reader.ReadULEB128(FileSize)) {
+                break;
+            }
+            LineTableFiles->Files.emplace_back(EntryPath, EntryDirectoryIndex);
+        }
+    }
+    return LineTableFiles;
+}
+
+bool FDwarfSymbolSource::GetSourceFileName(const FDwarfUnit& Unit, uint64_t FileIndex, std::string& OutFilePath) const {
+    const FDwarfLineTableFiles* LineTableFiles = GetLineTableFiles(Unit);
+    if (LineTableFiles == nullptr || FileIndex < LineTableFiles->FirstFileIndex || FileIndex - LineTableFiles->FirstFileIndex >= LineTableFiles->Files.size()) {
+        return false;
+    }
+    const auto& [FileName, DirectoryIndex] = LineTableFiles->Files[FileIndex - LineTableFiles->FirstFileIndex];
+    if (FileName.empty()) {
+        return false;
+    }
+    const std::vector<std::string_view>& Directories = LineTableFiles->Directories;
+
+    ///Relative file names are relative to their directory, and relative directories are relative to the compilation directory
+    OutFilePath.clear();
+    if (!FileName.starts_with('/')) {
+        const std::string_view DirectoryName = DirectoryIndex < Directories.size() ? Directories[DirectoryIndex] : std::string_view{};
+        if (!DirectoryName.empty() && !DirectoryName.starts_with('/') && !Unit.CompilationDirectory.empty() && DirectoryName != Unit.CompilationDirectory) {
+            OutFilePath.append(Unit.CompilationDirectory).append("/");
+        }
+        if (!DirectoryName.empty()) {
+            OutFilePath.append(DirectoryName).append("/");
+        }
+    }
+    OutFilePath.append(FileName);
+    return true;
+}
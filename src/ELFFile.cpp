@@ -0,0 +1,264 @@
+#include "ELFFile.h"
+#include "StringConversion.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifdef UVTD_WITH_ZLIB
+#include <zlib.h>
+#endif
+#ifdef UVTD_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+static constexpr uint8_t ELFMagic[4] = {0x7F, 'E', 'L', 'F'};
+static constexpr uint8_t ELFClass64 = 2;
+static constexpr uint8_t ELFDataLittleEndian = 1;
+
+///.zdebug_* sections start with this magic followed by the big endian size of the decompressed data
+static constexpr uint8_t ZDebugSectionMagic[4] = {'Z', 'L', 'I', 'B'};
+static constexpr size_t ZDebugSectionHeaderSize = sizeof(ZDebugSectionMagic) + sizeof(uint64_t);
+
+///Most the algorithms can expand their input. Deflate tops out at 1032:1, zstd at a 128KB block per 4 byte RLE block
+static constexpr uint64_t MaxZlibCompressionRatio = 1032;
+static constexpr uint64_t MaxZstdCompressionRatio = 32768;
+
+///Index of the section name table stored in the Link field of the first section header when it does not fit into 16 bits
+static constexpr uint16_t ELFExtendedSectionIndex = 0xFFFF;
+
+bool FELFFile::IsELFFile(const std::filesystem::path& FilePath) {
+    std::ifstream FileStream{FilePath, std::ios::binary};
+    uint8_t Magic[sizeof(ELFMagic)]{};
+    if (!FileStream.read(reinterpret_cast<char*>(Magic), sizeof(Magic))) {
+        return false;
+    }
+    return memcmp(Magic, ELFMagic, sizeof(ELFMagic)) == 0;
+}
+
+bool FELFFile::Open(const std::filesystem::path& FilePath, const FDumpLog& Log) {
+    if (!MappedFile.Open(FilePath)) {
+        Log.Error(L"Failed to map ELF file " + FilePath.wstring() + L" into memory");
+        return false;
+    }
+    const std::span<const uint8_t> FileData = MappedFile.GetData();
+
+    FELFFileHeader Header{};
+    if (FileData.size() < sizeof(FELFFileHeader)) {
+        Log.Error(L"ELF file " + FilePath.wstring() + L" is too small to contain the file header");
+        return false;
+    }
+    memcpy(&Header, FileData.data(), sizeof(FELFFileHeader));
+
+    if (memcmp(Header.Ident, ELFMagic, sizeof(ELFMagic)) != 0) {
+        Log.Error(L"File " + FilePath.wstring() + L" is not an ELF file");
+        return false;
+    }
+    if (Header.Ident[4] != ELFClass64 || Header.Ident[5] != ELFDataLittleEndian) {
+        Log.Error(L"ELF file " + FilePath.wstring() + L" is not a little endian 64-bit file");
+        return false;
+    }
+
+    if (!ReadSectionHeaders(FilePath, Log)) {
+        Log.Error(L"Failed to read the section headers of ELF file " + FilePath.wstring());
+        return false;
+    }
+
+    ///Without applying the relocations every string and type reference of the DWARF in an object file would point at the wrong place
+    ///The .dwo and .dwp files of split DWARF are relocatable files too, but their .dwo sections are written not to need any relocations
+    if (Header.Type == ELFFileTypeRelocatable && FindSection(".debug_info.dwo") == nullptr) {
+        Log.Error(L"ELF file " + FilePath.wstring() + L" is a relocatable object file, only linked executables, shared libraries and their separate debug files are supported");
+        return false;
+    }
+    return true;
+}
+
+///Checks that the range lies within the file without computing its end, which the offsets and sizes read from a damaged file can overflow
+static bool IsRangeInFile(uint64_t Offset, uint64_t Size, uint64_t FileSize) {
+    return Offset <= FileSize && Size <= FileSize - Offset;
+}
+
+bool FELFFile::ReadSectionHeaders(const std::filesystem::path& FilePath, const FDumpLog& Log) {
+    const std::span<const uint8_t> FileData = MappedFile.GetData();
+    FELFFileHeader Header{};
+    memcpy(&Header, FileData.data(), sizeof(FELFFileHeader));
+
+    if (Header.SectionHeaderOffset == 0) {
+        return true;
+    }
+    if (Header.SectionHeaderEntrySize < sizeof(FELFSectionHeader) || !IsRangeInFile(Header.SectionHeaderOffset, sizeof(FELFSectionHeader), FileData.size())) {
+        return false;
+    }
+
+    ///Files with too many sections store the real section count and the name table index in the first section header
+    FELFSectionHeader FirstSectionHeader{};
+    memcpy(&FirstSectionHeader, FileData.data() + Header.SectionHeaderOffset, sizeof(FELFSectionHeader));
+    const uint64_t NumSections = Header.NumSectionHeaders != 0 ? Header.NumSectionHeaders : FirstSectionHeader.Size;
+    const uint32_t NameTableIndex = Header.SectionNameTableIndex != ELFExtendedSectionIndex ? Header.SectionNameTableIndex : FirstSectionHeader.Link;
+
+    if (NumSections > FileData.size() / Header.SectionHeaderEntrySize ||
+        !IsRangeInFile(Header.SectionHeaderOffset, NumSections * Header.SectionHeaderEntrySize, FileData.size()) || NameTableIndex >= NumSections) {
+        return false;
+    }
+    std::vector<FELFSectionHeader> SectionHeaders(NumSections);
+    for (uint64_t i = 0; i < NumSections; i++) {
+        memcpy(&SectionHeaders[i], FileData.data() + Header.SectionHeaderOffset + i * Header.SectionHeaderEntrySize, sizeof(FELFSectionHeader));
+    }
+
+    const FELFSectionHeader& NameTableHeader = SectionHeaders[NameTableIndex];
+    if (!IsRangeInFile(NameTableHeader.Offset, NameTableHeader.Size, FileData.size())) {
+        return false;
+    }
+    const std::string_view NameTable{reinterpret_cast<const char*>(FileData.data() + NameTableHeader.Offset), static_cast<size_t>(NameTableHeader.Size)};
+
+    Sections.reserve(NumSections);
+    for (const FELFSectionHeader& SectionHeader : SectionHeaders) {
+        FELFSection Section{};
+        if (SectionHeader.Name < NameTable.size()) {
+            const std::string_view SectionName = NameTable.substr(SectionHeader.Name);
+            Section.Name = SectionName.substr(0, SectionName.find('\0'));
+        }
+        Section.Type = SectionHeader.Type;
+        Section.Flags = SectionHeader.Flags;
+
+        ///NOBITS sections occupy no space in the file. The .debug files split from the binary turn all the code and data sections into them
+        if (SectionHeader.Type != ELFSectionTypeNoBits) {
+            if (!IsRangeInFile(SectionHeader.Offset, SectionHeader.Size, FileData.size())) {
+                Log.Error(L"Section " + ConvertUTF8ToWide(Section.Name) + L" of ELF file " + FilePath.wstring() + L" is truncated");
+                return false;
+            }
+            Section.Region = FMappedRegion::CreateView(FileData.data() + SectionHeader.Offset, SectionHeader.Size);
+        }
+        Sections.push_back(std::move(Section));
+    }
+    return true;
+}
+
+const FELFSection* FELFFile::FindSection(std::string_view SectionName) const {
+    for (const FELFSection& Section : Sections) {
+        if (Section.Name == SectionName && Section.Type != ELFSectionTypeNoBits) {
+            return &Section;
+        }
+    }
+    return nullptr;
+}
+
+const FELFSection* FELFFile::FindDebugSection(std::string_view SectionName) const {
+    if (const FELFSection* Section = FindSection(SectionName)) {
+        return Section;
+    }
+    if (!SectionName.starts_with(".debug")) {
+        return nullptr;
+    }
+    std::string CompressedSectionName{".zdebug"};
+    CompressedSectionName.append(SectionName.substr(std::string_view{".debug"}.size()));
+    return FindSection(CompressedSectionName);
+}
+
+#ifdef UVTD_WITH_ZLIB
+static bool DecompressZlib(std::span<const uint8_t> CompressedData, std::span<uint8_t> OutData) {
+    z_stream Stream{};
+    if (inflateInit(&Stream) != Z_OK) {
+        return false;
+    }
+    ///zlib counts the buffer sizes in 32 bits, so the large sections are streamed through it in chunks
+    size_t RemainingInput = CompressedData.size();
+    size_t RemainingOutput = OutData.size();
+    Stream.next_in = const_cast<Bytef*>(CompressedData.data());
+    Stream.next_out = OutData.data();
+
+    int Result = Z_OK;
+    while (Result == Z_OK) {
+        if (Stream.avail_in == 0) {
+            Stream.avail_in = static_cast<uInt>(std::min<size_t>(RemainingInput, UINT32_MAX));
+            RemainingInput -= Stream.avail_in;
+        }
+        if (Stream.avail_out == 0) {
+            Stream.avail_out = static_cast<uInt>(std::min<size_t>(RemainingOutput, UINT32_MAX));
+            RemainingOutput -= Stream.avail_out;
+        }
+        Result = inflate(&Stream, Z_NO_FLUSH);
+    }
+    const bool bIsComplete = Result == Z_STREAM_END && Stream.next_out == OutData.data() + OutData.size();
+    inflateEnd(&Stream);
+    return bIsComplete;
+}
+#endif
+
+#ifdef UVTD_WITH_ZSTD
+static bool DecompressZstd(std::span<const uint8_t> CompressedData, std::span<uint8_t> OutData) {
+    const size_t Result = ZSTD_decompress(OutData.data(), OutData.size(), CompressedData.data(), CompressedData.size());
+    return !ZSTD_isError(Result) && Result == OutData.size();
+}
+#endif
+
+bool FELFFile::DecompressSection(const FELFSection& Section, FMappedRegion& OutRegion, const FDumpLog& Log) {
+    const std::span<const uint8_t> SectionData = Section.GetData();
+    const std::wstring SectionName = ConvertUTF8ToWide(Section.Name);
+    EELFCompressionType CompressionType = EELFCompressionType::Zlib;
+    uint64_t DecompressedSize = 0;
+    std::span<const uint8_t> CompressedData;
+
+    if ((Section.Flags & ELFSectionFlagCompressed) != 0) {
+        FELFCompressionHeader CompressionHeader{};
+        if (SectionData.size() < sizeof(FELFCompressionHeader)) {
+            Log.Error(L"Compressed section " + SectionName + L" is too small to contain the compression header");
+            return false;
+        }
+        memcpy(&CompressionHeader, SectionData.data(), sizeof(FELFCompressionHeader));
+        CompressionType = static_cast<EELFCompressionType>(CompressionHeader.Type);
+        DecompressedSize = CompressionHeader.Size;
+        CompressedData = SectionData.subspan(sizeof(FELFCompressionHeader));
+    } else {
+        if (SectionData.size() < ZDebugSectionHeaderSize || memcmp(SectionData.data(), ZDebugSectionMagic, sizeof(ZDebugSectionMagic)) != 0) {
+            Log.Error(L"Compressed section " + SectionName + L" does not start with the ZLIB header");
+            return false;
+        }
+        for (size_t i = 0; i < sizeof(uint64_t); i++) {
+            DecompressedSize = (DecompressedSize << 8) | SectionData[sizeof(ZDebugSectionMagic) + i];
+        }
+        CompressedData = SectionData.subspan(ZDebugSectionHeaderSize);
+    }
+
+    ///Decompressed size comes straight from the file, so it is checked against the most either algorithm can expand the data before allocating it
+    const uint64_t MaxDecompressedSize = CompressionType == EELFCompressionType::Zstd ? MaxZstdCompressionRatio * CompressedData.size() : MaxZlibCompressionRatio * CompressedData.size();
+    if (DecompressedSize > MaxDecompressedSize) {
+        Log.Error(L"Compressed section " + SectionName + L" claims a decompressed size of " + std::to_wstring(DecompressedSize) + L" bytes, more than its " +
+            std::to_wstring(CompressedData.size()) + L" bytes of compressed data can hold");
+        return false;
+    }
+    std::vector<uint8_t> DecompressedData;
+    try {
+        DecompressedData.resize(DecompressedSize);
+    } catch (const std::exception&) {
+        Log.Error(L"Failed to allocate " + std::to_wstring(DecompressedSize) + L" bytes for the decompressed section " + SectionName);
+        return false;
+    }
+    bool bDecompressed = false;
+    switch (CompressionType) {
+        case EELFCompressionType::Zlib:
+#ifdef UVTD_WITH_ZLIB
+            bDecompressed = DecompressZlib(CompressedData, DecompressedData);
+            break;
+#else
+            Log.Error(L"Section " + SectionName + L" is compressed with zlib, which this build does not support");
+            return false;
+#endif
+        case EELFCompressionType::Zstd:
+#ifdef UVTD_WITH_ZSTD
+            bDecompressed = DecompressZstd(CompressedData, DecompressedData);
+            break;
+#else
+            Log.Error(L"Section " + SectionName + L" is compressed with zstd, which this build does not support");
+            return false;
+#endif
+        default:
+            Log.Error(L"Section " + SectionName + L" uses unknown compression type " + std::to_wstring(static_cast<uint32_t>(CompressionType)));
+            return false;
+    }
+    if (!bDecompressed) {
+        Log.Error(L"Failed to decompress section " + SectionName);
+        return false;
+    }
+    OutRegion = FMappedRegion::CreateMaterialized(std::move(DecompressedData));
+    return true;
+}
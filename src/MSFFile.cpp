@@ -0,0 +1,122 @@
+#include "MSFFile.h"
+#include <cstddef>
+#include <cstring>
+
+static constexpr char MSFFileMagic[32] = "Microsoft C/C++ MSF 7.00\r\n\x1a" "DS\0\0";
+
+static constexpr uint32_t MinBlockSize = 512;
+static constexpr uint32_t MaxBlockSize = 65536;
+
+static uint64_t GetNumBlocksForSize(uint64_t Size, uint32_t BlockSize) {
+    return (Size + BlockSize - 1) / BlockSize;
+}
+
+bool FMSFFile::Open(const std::filesystem::path& FilePath, const FDumpLog& Log) {
+    if (!MappedFile.Open(FilePath)) {
+        Log.Error(L"Failed to map PDB file " + FilePath.wstring() + L" into memory");
+        return false;
+    }
+    const std::span<const uint8_t> FileData = MappedFile.GetData();
+
+    if (FileData.size() < sizeof(FMSFSuperBlock)) {
+        Log.Error(L"PDB file " + FilePath.wstring() + L" is too small to contain the MSF super block");
+        return false;
+    }
+    memcpy(&SuperBlock, FileData.data(), sizeof(FMSFSuperBlock));
+
+    if (memcmp(SuperBlock.FileMagic, MSFFileMagic, sizeof(MSFFileMagic)) != 0) {
+        Log.Error(L"File " + FilePath.wstring() + L" is not a MSF 7.00 PDB file");
+        return false;
+    }
+
+    ///Block size must be a power of two, and the file must contain every block the super block claims to have
+    ///Large PDBs written with /PDBPAGESIZE use blocks of up to 64KB, which lets the 32-bit block indices address files over 4GB
+    if (SuperBlock.BlockSize < MinBlockSize || SuperBlock.BlockSize > MaxBlockSize || (SuperBlock.BlockSize & (SuperBlock.BlockSize - 1)) != 0) {
+        Log.Error(L"PDB file " + FilePath.wstring() + L" has unsupported MSF block size " + std::to_wstring(SuperBlock.BlockSize));
+        return false;
+    }
+    if (static_cast<uint64_t>(SuperBlock.NumBlocks) * SuperBlock.BlockSize > FileData.size()) {
+        Log.Error(L"PDB file " + FilePath.wstring() + L" is truncated");
+        return false;
+    }
+
+    if (!ReadStreamDirectory()) {
+        Log.Error(L"Failed to read the MSF stream directory of PDB file " + FilePath.wstring());
+        return false;
+    }
+    return true;
+}
+
+bool FMSFFile::ReadStreamDirectory() {
+    const uint32_t BlockSize = SuperBlock.BlockSize;
+    const uint64_t NumDirectoryBlocks = GetNumBlocksForSize(SuperBlock.NumDirectoryBytes, BlockSize);
+
+    ///The list of the directory blocks is itself stored in the blocks listed right after the super block, starting with BlockMapAddr
+    ///Small directories fit into a single block map block, but large PDBs need several of them, so the list is stitched together first
+    const uint64_t BlockMapSize = NumDirectoryBlocks * sizeof(uint32_t);
+    const uint64_t NumBlockMapBlocks = GetNumBlocksForSize(BlockMapSize, BlockSize);
+    if (NumBlockMapBlocks == 0 || offsetof(FMSFSuperBlock, BlockMapAddr) + NumBlockMapBlocks * sizeof(uint32_t) > BlockSize) {
+        return false;
+    }
+    const auto* BlockMapAddrData = reinterpret_cast<const uint32_t*>(MappedFile.GetData().data() + offsetof(FMSFSuperBlock, BlockMapAddr));
+    const std::span<const uint32_t> BlockMapBlocks{BlockMapAddrData, static_cast<size_t>(NumBlockMapBlocks)};
+
+    for (uint32_t BlockMapBlock : BlockMapBlocks) {
+        if (BlockMapBlock >= SuperBlock.NumBlocks) {
+            return false;
+        }
+    }
+    BlockMapRegion = MappedFile.MapBlocks(BlockMapBlocks, BlockSize, BlockMapSize);
+    const std::span<const uint32_t> DirectoryBlocks{reinterpret_cast<const uint32_t*>(BlockMapRegion.GetData().data()), static_cast<size_t>(NumDirectoryBlocks)};
+
+    for (uint32_t DirectoryBlock : DirectoryBlocks) {
+        if (DirectoryBlock >= SuperBlock.NumBlocks) {
+            return false;
+        }
+    }
+    DirectoryRegion = MappedFile.MapBlocks(DirectoryBlocks, BlockSize, SuperBlock.NumDirectoryBytes);
+
+    ///Directory layout: NumStreams, StreamSizes[NumStreams], then the block lists of all streams back to back
+    const std::span<const uint8_t> DirectoryData = DirectoryRegion.GetData();
+    if (DirectoryData.size() < sizeof(uint32_t)) {
+        return false;
+    }
+    const auto* DirectoryWords = reinterpret_cast<const uint32_t*>(DirectoryData.data());
+    const uint64_t NumDirectoryWords = DirectoryData.size() / sizeof(uint32_t);
+    const uint32_t NumStreams = DirectoryWords[0];
+
+    if (1 + static_cast<uint64_t>(NumStreams) > NumDirectoryWords) {
+        return false;
+    }
+    StreamSizes.assign(DirectoryWords + 1, DirectoryWords + 1 + NumStreams);
+    StreamBlocks.resize(NumStreams);
+
+    uint64_t CurrentWord = 1 + static_cast<uint64_t>(NumStreams);
+    for (uint32_t StreamIndex = 0; StreamIndex < NumStreams; StreamIndex++) {
+        const uint32_t StreamSize = StreamSizes[StreamIndex];
+        if (StreamSize == NilStreamSize) {
+            continue;
+        }
+        const uint64_t NumStreamBlocks = GetNumBlocksForSize(StreamSize, BlockSize);
+        if (CurrentWord + NumStreamBlocks > NumDirectoryWords) {
+            return false;
+        }
+        StreamBlocks[StreamIndex] = std::span<const uint32_t>{DirectoryWords + CurrentWord, static_cast<size_t>(NumStreamBlocks)};
+        CurrentWord += NumStreamBlocks;
+
+        for (uint32_t StreamBlock : StreamBlocks[StreamIndex]) {
+            if (StreamBlock >= SuperBlock.NumBlocks) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool FMSFFile::OpenStream(uint32_t StreamIndex, FMSFStream& OutStream) const {
+    if (!IsStreamPresent(StreamIndex)) {
+        return false;
+    }
+    OutStream = FMSFStream{StreamIndex, MappedFile.MapBlocks(StreamBlocks[StreamIndex], SuperBlock.BlockSize, StreamSizes[StreamIndex])};
+    return true;
+}
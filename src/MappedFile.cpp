@@ -0,0 +1,267 @@
+#include "MappedFile.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+FMappedRegion::FMappedRegion() : Data(nullptr), Size(0), ReservedAddress(nullptr), ReservedSize(0) {
+}
+
+FMappedRegion::~FMappedRegion() {
+    Reset();
+}
+
+FMappedRegion::FMappedRegion(FMappedRegion&& Other) noexcept : FMappedRegion() {
+    *this = std::move(Other);
+}
+
+FMappedRegion& FMappedRegion::operator=(FMappedRegion&& Other) noexcept {
+    if (this != &Other) {
+        Reset();
+        Data = std::exchange(Other.Data, nullptr);
+        Size = std::exchange(Other.Size, 0);
+        ReservedAddress = std::exchange(Other.ReservedAddress, nullptr);
+        ReservedSize = std::exchange(Other.ReservedSize, 0);
+        MaterializedData = std::move(Other.MaterializedData);
+        ///Moving the vector keeps the heap buffer, so the data pointer stays valid after the move
+    }
+    return *this;
+}
+
+void FMappedRegion::Reset() {
+#ifndef _WIN32
+    if (ReservedAddress != nullptr) {
+        munmap(ReservedAddress, ReservedSize);
+    }
+#endif
+    Data = nullptr;
+    Size = 0;
+    ReservedAddress = nullptr;
+    ReservedSize = 0;
+    MaterializedData.clear();
+}
+
+///Returns the page aligned range covering the region, as required by the memory management calls
+static void GetPageAlignedRange(const uint8_t* Data, uint64_t Size, uint8_t*& OutRangeStart, uint64_t& OutRangeSize) {
+#ifdef _WIN32
+    SYSTEM_INFO SystemInfo{};
+    GetSystemInfo(&SystemInfo);
+    const auto PageSize = static_cast<uintptr_t>(SystemInfo.dwPageSize);
+#else
+    const auto PageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+#endif
+    const uintptr_t RangeStart = reinterpret_cast<uintptr_t>(Data) & ~(PageSize - 1);
+    OutRangeStart = reinterpret_cast<uint8_t*>(RangeStart);
+    OutRangeSize = reinterpret_cast<uintptr_t>(Data) + Size - RangeStart;
+}
+
+void FMappedRegion::AdviseSequentialAccess() const {
+    if (!IsZeroCopy() || Size == 0) {
+        return;
+    }
+    uint8_t* RangeStart{};
+    uint64_t RangeSize{};
+    GetPageAlignedRange(Data, Size, RangeStart, RangeSize);
+#ifdef _WIN32
+    ///Windows has no access pattern hints for the mapped views, prefetching the range is the closest equivalent of the read ahead
+    WIN32_MEMORY_RANGE_ENTRY MemoryRange{RangeStart, static_cast<SIZE_T>(RangeSize)};
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &MemoryRange, 0);
+#else
+    madvise(RangeStart, RangeSize, MADV_SEQUENTIAL);
+#endif
+}
+
+void FMappedRegion::ReleaseResidentPages() const {
+    if (!IsZeroCopy() || Size == 0) {
+        return;
+    }
+    uint8_t* RangeStart{};
+    uint64_t RangeSize{};
+    GetPageAlignedRange(Data, Size, RangeStart, RangeSize);
+#ifdef _WIN32
+    ///Unlocking the pages which are not locked removes them from the working set of the process
+    VirtualUnlock(RangeStart, static_cast<SIZE_T>(RangeSize));
+#else
+    madvise(RangeStart, RangeSize, MADV_DONTNEED);
+#endif
+}
+
+FMappedRegion FMappedRegion::CreateView(const uint8_t* InData, uint64_t InSize) {
+    FMappedRegion Region;
+    Region.Data = InData;
+    Region.Size = InSize;
+    return Region;
+}
+
+FMappedRegion FMappedRegion::CreateRemapped(void* InReservedAddress, uint64_t InReservedSize, uint64_t InSize) {
+    FMappedRegion Region;
+    Region.Data = static_cast<const uint8_t*>(InReservedAddress);
+    Region.Size = InSize;
+    Region.ReservedAddress = InReservedAddress;
+    Region.ReservedSize = InReservedSize;
+    return Region;
+}
+
+FMappedRegion FMappedRegion::CreateMaterialized(std::vector<uint8_t>&& InData) {
+    FMappedRegion Region;
+    Region.MaterializedData = std::move(InData);
+    Region.Data = Region.MaterializedData.data();
+    Region.Size = Region.MaterializedData.size();
+    return Region;
+}
+
+#ifdef _WIN32
+FMappedFile::FMappedFile() : Data(nullptr), Size(0), FileHandle(INVALID_HANDLE_VALUE), MappingHandle(nullptr) {
+}
+#else
+FMappedFile::FMappedFile() : Data(nullptr), Size(0), FileDescriptor(-1) {
+}
+#endif
+
+FMappedFile::~FMappedFile() {
+    Close();
+}
+
+bool FMappedFile::Open(const std::filesystem::path& FilePath) {
+    Close();
+#ifdef _WIN32
+    FileHandle = CreateFileW(FilePath.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (FileHandle == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER FileSize{};
+    if (!GetFileSizeEx(FileHandle, &FileSize) || FileSize.QuadPart == 0) {
+        Close();
+        return false;
+    }
+    MappingHandle = CreateFileMappingW(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (MappingHandle == nullptr) {
+        Close();
+        return false;
+    }
+    Data = static_cast<const uint8_t*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (Data == nullptr) {
+        Close();
+        return false;
+    }
+    Size = static_cast<uint64_t>(FileSize.QuadPart);
+#else
+    FileDescriptor = open(FilePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (FileDescriptor == -1) {
+        return false;
+    }
+    struct stat FileStat{};
+    if (fstat(FileDescriptor, &FileStat) != 0 || FileStat.st_size == 0) {
+        Close();
+        return false;
+    }
+    void* MappedAddress = mmap(nullptr, FileStat.st_size, PROT_READ, MAP_SHARED, FileDescriptor, 0);
+    if (MappedAddress == MAP_FAILED) {
+        Close();
+        return false;
+    }
+    Data = static_cast<const uint8_t*>(MappedAddress);
+    Size = static_cast<uint64_t>(FileStat.st_size);
+#endif
+    return true;
+}
+
+void FMappedFile::Close() {
+#ifdef _WIN32
+    if (Data != nullptr) {
+        UnmapViewOfFile(Data);
+    }
+    if (MappingHandle != nullptr) {
+        CloseHandle(MappingHandle);
+    }
+    if (FileHandle != INVALID_HANDLE_VALUE) {
+        CloseHandle(FileHandle);
+    }
+    MappingHandle = nullptr;
+    FileHandle = INVALID_HANDLE_VALUE;
+#else
+    if (Data != nullptr) {
+        munmap(const_cast<uint8_t*>(Data), Size);
+    }
+    if (FileDescriptor != -1) {
+        close(FileDescriptor);
+    }
+    FileDescriptor = -1;
+#endif
+    Data = nullptr;
+    Size = 0;
+}
+
+FMappedRegion FMappedFile::MapBlocks(std::span<const uint32_t> Blocks, uint32_t BlockSize, uint64_t RegionSize) const {
+    if (Blocks.empty() || RegionSize == 0) {
+        return FMappedRegion::CreateView(Data, 0);
+    }
+
+    ///Fast path: all blocks are laid out consecutively in the file, so we can just hand out the view directly
+    bool bBlocksAreConsecutive = true;
+    for (size_t i = 1; i < Blocks.size(); i++) {
+        if (Blocks[i] != Blocks[i - 1] + 1) {
+            bBlocksAreConsecutive = false;
+            break;
+        }
+    }
+    if (bBlocksAreConsecutive) {
+        return FMappedRegion::CreateView(Data + static_cast<uint64_t>(Blocks[0]) * BlockSize, RegionSize);
+    }
+
+#ifndef _WIN32
+    ///Scattered blocks: reserve the address range and map each run of consecutive blocks into it with MAP_FIXED
+    ///This only works if the blocks are page aligned in the file, which is the case for all block sizes >= page size
+    const uint64_t PageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    if (BlockSize % PageSize == 0) {
+        const uint64_t ReservedSize = static_cast<uint64_t>(Blocks.size()) * BlockSize;
+        void* ReservedAddress = mmap(nullptr, ReservedSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (ReservedAddress != MAP_FAILED) {
+            bool bRemapSucceeded = true;
+            size_t RunStart = 0;
+            while (RunStart < Blocks.size()) {
+                size_t RunEnd = RunStart + 1;
+                while (RunEnd < Blocks.size() && Blocks[RunEnd] == Blocks[RunEnd - 1] + 1) {
+                    RunEnd++;
+                }
+                auto* RunAddress = static_cast<uint8_t*>(ReservedAddress) + RunStart * BlockSize;
+                const uint64_t RunSize = (RunEnd - RunStart) * static_cast<uint64_t>(BlockSize);
+                const auto RunFileOffset = static_cast<off_t>(static_cast<uint64_t>(Blocks[RunStart]) * BlockSize);
+
+                if (mmap(RunAddress, RunSize, PROT_READ, MAP_SHARED | MAP_FIXED, FileDescriptor, RunFileOffset) == MAP_FAILED) {
+                    bRemapSucceeded = false;
+                    break;
+                }
+                RunStart = RunEnd;
+            }
+            if (bRemapSucceeded) {
+                return FMappedRegion::CreateRemapped(ReservedAddress, ReservedSize, RegionSize);
+            }
+            munmap(ReservedAddress, ReservedSize);
+        }
+    }
+#endif
+
+    ///Fallback: copy the blocks into an owned buffer
+    ///Windows would need placeholder mappings (MapViewOfFile3) to stitch the views, which we do not rely on
+    std::vector<uint8_t> MaterializedData(RegionSize);
+    uint64_t BytesCopied = 0;
+    for (uint32_t BlockIndex : Blocks) {
+        const uint64_t BytesToCopy = std::min<uint64_t>(BlockSize, RegionSize - BytesCopied);
+        memcpy(MaterializedData.data() + BytesCopied, Data + static_cast<uint64_t>(BlockIndex) * BlockSize, BytesToCopy);
+        BytesCopied += BytesToCopy;
+        if (BytesCopied == RegionSize) {
+            break;
+        }
+    }
+    return FMappedRegion::CreateMaterialized(std::move(MaterializedData));
+}
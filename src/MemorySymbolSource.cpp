@@ -0,0 +1,190 @@
+#include "MemorySymbolSource.h"
+
+const FMemorySymbol* FMemorySymbolSource::GetSymbol(FSymbolHandle Symbol) const {
+    if (!Symbol.IsValid() || Symbol.Id > Symbols.size()) {
+        return nullptr;
+    }
+    return &Symbols[Symbol.Id - 1];
+}
+
+FSymbolHandle FMemorySymbolSource::AddSymbol(const std::string& Name, const FSymbolInfo& Info) {
+    Symbols.push_back(FMemorySymbol{Name, Info});
+    const FSymbolHandle Symbol{Symbols.size()};
+
+    if (Info.Tag == ESymbolTag::UDT && !Name.empty()) {
+        UserDefinedTypes.insert({Name, Symbol});
+    }
+    return Symbol;
+}
+
+FSymbolHandle FMemorySymbolSource::AddChildSymbol(FSymbolHandle Parent, const std::string& Name, const FSymbolInfo& Info) {
+    const FSymbolHandle Symbol = AddSymbol(Name, Info);
+    if (Parent.IsValid() && Parent.Id <= Symbols.size()) {
+        Symbols[Parent.Id - 1].Children.push_back(Symbol);
+    }
+    return Symbol;
+}
+
+FSymbolHandle FMemorySymbolSource::AddBasicType(EBasicType BasicType, uint64_t Size, bool bIsConst) {
+    FSymbolInfo Info{};
+    Info.Tag = ESymbolTag::BaseType;
+    Info.BasicType = BasicType;
+    Info.Length = Size;
+    Info.bIsConst = bIsConst;
+    return AddSymbol(std::string{}, Info);
+}
+
+FSymbolHandle FMemorySymbolSource::AddPointerType(FSymbolHandle PointeeType, uint64_t PointerSize, bool bIsReference) {
+    FSymbolInfo Info{};
+    Info.Tag = ESymbolTag::PointerType;
+    Info.Type = PointeeType;
+    Info.Length = PointerSize;
+    Info.bIsReference = bIsReference;
+    return AddSymbol(std::string{}, Info);
+}
+
+FSymbolHandle FMemorySymbolSource::AddArrayType(FSymbolHandle ElementType, uint32_t ElementCount) {
+    FSymbolInfo Info{};
+    Info.Tag = ESymbolTag::ArrayType;
+    Info.Type = ElementType;
+    Info.Count = ElementCount;
+    if (const FMemorySymbol* ElementSymbol = GetSymbol(ElementType)) {
+        Info.Length = ElementSymbol->Info.Length * ElementCount;
+    }
+    return AddSymbol(std::string{}, Info);
+}
+
+FSymbolHandle FMemorySymbolSource::AddUserDefinedType(const std::string& Name, EUDTKind UDTKind, uint64_t Size, bool bHasConstructor) {
+    FSymbolInfo Info{};
+    Info.Tag = ESymbolTag::UDT;
+    Info.UDTKind = UDTKind;
+    Info.Length = Size;
+    Info.bHasConstructor = bHasConstructor;
+    return AddSymbol(Name, Info);
+}
+
+FSymbolHandle FMemorySymbolSource::AddFunctionType(FSymbolHandle ReturnType, const std::vector<FSymbolHandle>& ArgumentTypes, FSymbolHandle ClassParent) {
+    FSymbolInfo Info{};
+    Info.Tag = ESymbolTag::FunctionType;
+    Info.Type = ReturnType;
+    Info.ClassParent = ClassParent;
+    const FSymbolHandle FunctionType = AddSymbol(std::string{}, Info);
+
+    for (FSymbolHandle ArgumentType : ArgumentTypes) {
+        FSymbolInfo ArgumentInfo{};
+        ArgumentInfo.Tag = ESymbolTag::FunctionArgType;
+        ArgumentInfo.Type = ArgumentType;
+        AddChildSymbol(FunctionType, std::string{}, ArgumentInfo);
+    }
+    return FunctionType;
+}
+
+FSymbolHandle FMemorySymbolSource::AddBaseClass(FSymbolHandle UDT, FSymbolHandle BaseClassType, int32_t Offset, EMemberAccess Access) {
+    const FMemorySymbol* BaseClassSymbol = GetSymbol(BaseClassType);
+    if (BaseClassSymbol == nullptr) {
+        return FSymbolHandle{};
+    }
+    ///Base classes carry the name, the size and the constructor flag of the base class type, the same way DIA reports them
+    FSymbolInfo Info = BaseClassSymbol->Info;
+    Info.Tag = ESymbolTag::BaseClass;
+    Info.Count = 0;
+    Info.Type = BaseClassType;
+    Info.Offset = Offset;
+    Info.Access = Access;
+    ///Primary base class shares its virtual table with the derived type, so the derived type starts with all of its entries
+    if (Offset == 0 && UDT.IsValid() && UDT.Id <= Symbols.size()) {
+        Symbols[UDT.Id - 1].Info.Count += BaseClassSymbol->Info.Count;
+    }
+    ///Name is copied before adding the child, as adding the symbols may reallocate the symbol array
+    const std::string BaseClassName = BaseClassSymbol->Name;
+    return AddChildSymbol(UDT, BaseClassName, Info);
+}
+
+FSymbolHandle FMemorySymbolSource::AddMemberVariable(FSymbolHandle UDT, const std::string& Name, FSymbolHandle VariableType, int32_t Offset, EMemberAccess Access) {
+    FSymbolInfo Info{};
+    Info.Tag = ESymbolTag::Data;
+    Info.Location = EDataLocation::ThisRelative;
+    Info.Type = VariableType;
+    Info.Offset = Offset;
+    Info.Access = Access;
+    if (const FMemorySymbol* TypeSymbol = GetSymbol(VariableType)) {
+        Info.Length = TypeSymbol->Info.Length;
+    }
+    return AddChildSymbol(UDT, Name, Info);
+}
+
+FSymbolHandle FMemorySymbolSource::AddBitfield(FSymbolHandle UDT, const std::string& Name, FSymbolHandle VariableType, int32_t Offset, uint32_t BitPosition, uint32_t BitSize, EMemberAccess Access) {
+    FSymbolInfo Info{};
+    Info.Tag = ESymbolTag::Data;
+    Info.Location = EDataLocation::BitField;
+    Info.Type = VariableType;
+    Info.Offset = Offset;
+    Info.BitPosition = BitPosition;
+    Info.Length = BitSize;
+    Info.Access = Access;
+    return AddChildSymbol(UDT, Name, Info);
+}
+
+FSymbolHandle FMemorySymbolSource::AddVirtualFunction(FSymbolHandle UDT, const std::string& Name, FSymbolHandle FunctionType, int32_t VirtualTableOffset, bool bIsIntroVirtual, EMemberAccess Access) {
+    FSymbolInfo Info{};
+    Info.Tag = ESymbolTag::Function;
+    Info.Type = FunctionType;
+    Info.VirtualBaseOffset = VirtualTableOffset;
+    Info.bIsVirtual = true;
+    Info.bIsIntroVirtual = bIsIntroVirtual;
+    Info.Access = Access;
+
+    ///Intro virtual functions add a new entry to the virtual table of the type
+    if (bIsIntroVirtual && UDT.IsValid() && UDT.Id <= Symbols.size()) {
+        Symbols[UDT.Id - 1].Info.Count++;
+    }
+    return AddChildSymbol(UDT, Name, Info);
+}
+
+void FMemorySymbolSource::SetSourceLine(FSymbolHandle Symbol, const std::string& SourceFilePath, int32_t LineNumber) {
+    if (Symbol.IsValid() && Symbol.Id <= Symbols.size()) {
+        Symbols[Symbol.Id - 1].SourceFilePath = SourceFilePath;
+        Symbols[Symbol.Id - 1].SourceLineNumber = LineNumber;
+    }
+}
+
+FSymbolHandle FMemorySymbolSource::FindUserDefinedType(const std::string& TypeName) const {
+    const auto Iterator = UserDefinedTypes.find(TypeName);
+    return Iterator != UserDefinedTypes.end() ? Iterator->second : FSymbolHandle{};
+}
+
+bool FMemorySymbolSource::GetSymbolInfo(FSymbolHandle Symbol, FSymbolInfo& OutInfo) const {
+    const FMemorySymbol* MemorySymbol = GetSymbol(Symbol);
+    if (MemorySymbol == nullptr) {
+        return false;
+    }
+    OutInfo = MemorySymbol->Info;
+    return true;
+}
+
+std::string FMemorySymbolSource::GetSymbolName(FSymbolHandle Symbol) const {
+    const FMemorySymbol* MemorySymbol = GetSymbol(Symbol);
+    return MemorySymbol != nullptr ? MemorySymbol->Name : std::string{};
+}
+
+void FMemorySymbolSource::GetChildren(FSymbolHandle Symbol, ESymbolTag ChildTag, std::vector<FSymbolHandle>& OutChildren) const {
+    const FMemorySymbol* MemorySymbol = GetSymbol(Symbol);
+    if (MemorySymbol == nullptr) {
+        return;
+    }
+    for (FSymbolHandle Child : MemorySymbol->Children) {
+        if (Symbols[Child.Id - 1].Info.Tag == ChildTag) {
+            OutChildren.push_back(Child);
+        }
+    }
+}
+
+bool FMemorySymbolSource::GetSourceLine(FSymbolHandle Symbol, std::string& OutSourceFilePath, int32_t& OutLineNumber) const {
+    const FMemorySymbol* MemorySymbol = GetSymbol(Symbol);
+    if (MemorySymbol == nullptr || MemorySymbol->SourceFilePath.empty()) {
+        return false;
+    }
+    OutSourceFilePath = MemorySymbol->SourceFilePath;
+    OutLineNumber = MemorySymbol->SourceLineNumber;
+    return true;
+}
@@ -0,0 +1,231 @@
+#include "OutputFile.h"
+#include "AsyncFileWriter.h"
+#include "Format.h"
+#include "StringConversion.h"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+bool WriteFileContents(const std::filesystem::path& FilePath, std::string_view Contents) {
+#ifdef _WIN32
+    const HANDLE FileHandle = CreateFileW(FilePath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (FileHandle == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    bool bSucceeded = true;
+    size_t BytesWritten = 0;
+    while (bSucceeded && BytesWritten < Contents.size()) {
+        ///WriteFile takes a 32-bit length, so larger buffers are written in chunks
+        const DWORD ChunkSize = static_cast<DWORD>(std::min<size_t>(Contents.size() - BytesWritten, 0x80000000u));
+        DWORD ChunkBytesWritten = 0;
+        bSucceeded = ::WriteFile(FileHandle, Contents.data() + BytesWritten, ChunkSize, &ChunkBytesWritten, nullptr) && ChunkBytesWritten != 0;
+        BytesWritten += ChunkBytesWritten;
+    }
+    CloseHandle(FileHandle);
+    return bSucceeded;
+#else
+    const int FileDescriptor = open(FilePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (FileDescriptor == -1) {
+        return false;
+    }
+    bool bSucceeded = true;
+    size_t BytesWritten = 0;
+    while (BytesWritten < Contents.size()) {
+        const ssize_t ChunkBytesWritten = write(FileDescriptor, Contents.data() + BytesWritten, Contents.size() - BytesWritten);
+        if (ChunkBytesWritten < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ChunkBytesWritten <= 0) {
+            bSucceeded = false;
+            break;
+        }
+        BytesWritten += static_cast<size_t>(ChunkBytesWritten);
+    }
+    ///Close can report the errors of the delayed writes, e.g. on the network file systems
+    bSucceeded &= close(FileDescriptor) == 0;
+    return bSucceeded;
+#endif
+}
+
+///Coarsest last write time kept by the file systems in use, the two seconds of FAT. Files written within it of the manifest are hashed to tell whether they have changed
+static constexpr std::chrono::seconds WriteTimeGranularity{2};
+
+///True if the file on the disk hashes to the given hash. Reads the whole file, so it is only done for the files whose last write time cannot be trusted
+static bool FileContentsMatch(const std::filesystem::path& FilePath, const FContentHash& ContentHash) {
+    std::ifstream FileStream{FilePath, std::ios_base::in | std::ios_base::binary};
+    if (!FileStream.good()) {
+        return false;
+    }
+    const std::string FileContents{std::istreambuf_iterator<char>{FileStream}, std::istreambuf_iterator<char>{}};
+    return !FileStream.bad() && HashContents(FileContents) == ContentHash;
+}
+
+///First line of the manifest. Manifests with any other header, e.g. written by a different version, are ignored
+static constexpr std::string_view ManifestHeader = "UVTDManifest 2";
+
+///Parses the number at the start of the line and skips the space after it. Returns false if there is no number followed by a space
+template<typename T>
+static bool ParseManifestField(std::string_view& Line, T& OutValue, int32_t Base) {
+    const size_t FieldLength = Line.find(' ');
+    if (FieldLength == std::string_view::npos) {
+        return false;
+    }
+    const std::from_chars_result Result = std::from_chars(Line.data(), Line.data() + FieldLength, OutValue, Base);
+    if (Result.ec != std::errc{} || Result.ptr != Line.data() + FieldLength) {
+        return false;
+    }
+    Line.remove_prefix(FieldLength + 1);
+    return true;
+}
+
+FOutputDirectory::FOutputDirectory(const std::filesystem::path& InDirectoryPath) : DirectoryPath(InDirectoryPath) {
+}
+
+bool FOutputDirectory::Open() {
+    std::error_code ErrorCode;
+    std::filesystem::create_directories(DirectoryPath, ErrorCode);
+    if (ErrorCode) {
+        return false;
+    }
+    const std::filesystem::path ManifestPath = DirectoryPath / ManifestFileName;
+    std::ifstream ManifestStream{ManifestPath, std::ios_base::in | std::ios_base::binary};
+    if (!ManifestStream.good()) {
+        return true;
+    }
+    const std::string Manifest{std::istreambuf_iterator<char>{ManifestStream}, std::istreambuf_iterator<char>{}};
+    ManifestStream.close();
+    ///Manifest that cannot be stat'ed keeps the zero write time, which makes every file of it hashed before it is skipped
+    const std::filesystem::file_time_type ManifestTime = std::filesystem::last_write_time(ManifestPath, ErrorCode);
+    if (!ErrorCode) {
+        ManifestWriteTime = ManifestTime.time_since_epoch().count();
+    }
+    std::filesystem::remove(ManifestPath, ErrorCode);
+
+    ///Each line is the high and the low half of the 128-bit hash in hexadecimal, the size of the file, its last write time and its name, separated by single spaces
+    std::string_view RemainingManifest{Manifest};
+    bool bIsHeaderLine = true;
+    while (!RemainingManifest.empty()) {
+        const size_t LineEnd = RemainingManifest.find('\n');
+        std::string_view Line = RemainingManifest.substr(0, LineEnd);
+        RemainingManifest.remove_prefix(LineEnd != std::string_view::npos ? LineEnd + 1 : RemainingManifest.size());
+
+        if (bIsHeaderLine) {
+            if (Line != ManifestHeader) {
+                return true;
+            }
+            bIsHeaderLine = false;
+            continue;
+        }
+        FOutputFileRecord FileRecord{};
+        if (ParseManifestField(Line, FileRecord.ContentHash.High, 16) && ParseManifestField(Line, FileRecord.ContentHash.Low, 16) &&
+            ParseManifestField(Line, FileRecord.Size, 10) && ParseManifestField(Line, FileRecord.LastWriteTime, 10) && !Line.empty()) {
+            FileRecords.insert_or_assign(std::string{Line}, FileRecord);
+        }
+    }
+    return true;
+}
+
+FOutputDirectory::~FOutputDirectory() {
+    WaitForPendingWrites();
+}
+
+void FOutputDirectory::WriteFile(const std::string& FileName, std::string Contents) {
+    FOutputFileRecord NewFileRecord{HashContents(Contents), Contents.size()};
+    std::filesystem::path FilePath = DirectoryPath / ConvertUTF8ToPath(FileName);
+
+    bool bRecordMatches = false;
+    int64_t RecordWriteTime = 0;
+    {
+        std::scoped_lock Lock{FileRecordsLock};
+        const auto RecordIterator = FileRecords.find(FileName);
+        bRecordMatches = RecordIterator != FileRecords.end() && RecordIterator->second.ContentHash == NewFileRecord.ContentHash && RecordIterator->second.Size == NewFileRecord.Size;
+        if (bRecordMatches) {
+            RecordWriteTime = RecordIterator->second.LastWriteTime;
+        }
+    }
+    ///Size and the last write time catch the files that have been deleted or edited by hand since they have been written, without reading them back
+    if (bRecordMatches) {
+        std::error_code ErrorCode;
+        const uintmax_t ExistingFileSize = std::filesystem::file_size(FilePath, ErrorCode);
+        const std::filesystem::file_time_type ExistingWriteTime = std::filesystem::last_write_time(FilePath, ErrorCode);
+        const int64_t WriteTimeGranularityTicks = std::chrono::duration_cast<std::filesystem::file_time_type::duration>(WriteTimeGranularity).count();
+        const bool bWriteTimeTrusted = RecordWriteTime <= ManifestWriteTime - WriteTimeGranularityTicks;
+        if (!ErrorCode && ExistingFileSize == NewFileRecord.Size && ExistingWriteTime.time_since_epoch().count() == RecordWriteTime &&
+            (bWriteTimeTrusted || FileContentsMatch(FilePath, NewFileRecord.ContentHash))) {
+            std::scoped_lock Lock{FileRecordsLock};
+            NumUnchangedFiles++;
+            return;
+        }
+    }
+    {
+        std::scoped_lock Lock{FileRecordsLock};
+        NumPendingWrites++;
+    }
+    FAsyncFileWriter::Get().WriteFile(FilePath, std::move(Contents), [this, FileName, FilePath, NewFileRecord](bool bSucceeded) mutable {
+        ///File that cannot be stat'ed keeps the zero write time, which never matches, so it is written again the next time
+        std::error_code ErrorCode;
+        const std::filesystem::file_time_type WriteTime = std::filesystem::last_write_time(FilePath, ErrorCode);
+        if (bSucceeded && !ErrorCode) {
+            NewFileRecord.LastWriteTime = WriteTime.time_since_epoch().count();
+        }
+        std::scoped_lock Lock{FileRecordsLock};
+        if (bSucceeded) {
+            FileRecords.insert_or_assign(FileName, NewFileRecord);
+            NumWrittenFiles++;
+        } else {
+            FileRecords.erase(FileName);
+            FailedFileNames.push_back(FileName);
+        }
+        ///Notified under the lock, the directory can be destroyed as soon as the waiting thread sees the last write done
+        if (--NumPendingWrites == 0) {
+            PendingWritesCondition.notify_all();
+        }
+    });
+}
+
+bool FOutputDirectory::WaitForPendingWrites() {
+    std::unique_lock Lock{FileRecordsLock};
+    PendingWritesCondition.wait(Lock, [&]() {
+        return NumPendingWrites == 0;
+    });
+    return FailedFileNames.empty();
+}
+
+bool FOutputDirectory::SaveManifest() {
+    WaitForPendingWrites();
+
+    std::vector<std::pair<std::string, FOutputFileRecord>> SortedFileRecords;
+    {
+        std::scoped_lock Lock{FileRecordsLock};
+        SortedFileRecords.assign(FileRecords.begin(), FileRecords.end());
+    }
+    std::sort(SortedFileRecords.begin(), SortedFileRecords.end(), [](const auto& A, const auto& B) { return A.first < B.first; });
+
+    std::string Manifest{ManifestHeader};
+    Manifest.push_back('\n');
+    for (const auto& [FileName, FileRecord] : SortedFileRecords) {
+        FormatTo(Manifest, "{:016x} {:016x} {} {} {}\n", FileRecord.ContentHash.High, FileRecord.ContentHash.Low, FileRecord.Size, FileRecord.LastWriteTime, FileName);
+    }
+
+    ///Written next to the manifest first and then moved over it, so the manifest is never left half written
+    const std::filesystem::path ManifestPath = DirectoryPath / ManifestFileName;
+    std::filesystem::path TemporaryManifestPath = ManifestPath;
+    TemporaryManifestPath += ".tmp";
+    if (!WriteFileContents(TemporaryManifestPath, Manifest)) {
+        return false;
+    }
+    std::error_code ErrorCode;
+    std::filesystem::rename(TemporaryManifestPath, ManifestPath, ErrorCode);
+    return !ErrorCode;
+}
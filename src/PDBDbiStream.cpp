@@ -0,0 +1,72 @@
+#include "PDBDbiStream.h"
+#include "BinaryReader.h"
+
+///Signature of the "new" DBI stream header, the old format has not been produced since Visual C++ 6.0
+static constexpr int32_t DbiStreamVersionSignature = -1;
+
+bool FPDBDbiStream::Open(const FMSFFile& MSFFile, const FDumpLog& Log) {
+    if (!MSFFile.OpenStream(EPDBFixedStream::DBI, Stream)) {
+        Log.Error(L"PDB file does not contain a DBI stream");
+        return false;
+    }
+
+    FBinaryReader Reader{Stream.GetData()};
+    if (!Reader.Read(Header) || Header.VersionSignature != DbiStreamVersionSignature) {
+        Log.Error(L"Unsupported DBI stream header");
+        return false;
+    }
+
+    ///Substreams follow the header back to back, in the order of their sizes in the header. Only the modules and the debug header are needed for the RVAs
+    std::span<const uint8_t> ModuleInfoData;
+    std::span<const uint8_t> DebugHeaderData;
+    if (Header.ModuleInfoSize < 0 || Header.SectionContributionSize < 0 || Header.SectionMapSize < 0 ||
+        Header.SourceInfoSize < 0 || Header.TypeServerMapSize < 0 || Header.ECSubstreamSize < 0 || Header.OptionalDebugHeaderSize < 0 ||
+        !Reader.ReadBytes(Header.ModuleInfoSize, ModuleInfoData) ||
+        !Reader.Skip(static_cast<size_t>(Header.SectionContributionSize) + Header.SectionMapSize + Header.SourceInfoSize + Header.TypeServerMapSize + Header.ECSubstreamSize) ||
+        !Reader.ReadBytes(Header.OptionalDebugHeaderSize, DebugHeaderData)) {
+        Log.Error(L"DBI stream is truncated");
+        return false;
+    }
+
+    if (!ReadModuleInfo(ModuleInfoData)) {
+        Log.Error(L"DBI stream substreams are malformed");
+        return false;
+    }
+    ReadSectionHeaders(MSFFile, DebugHeaderData, Log);
+    return true;
+}
+
+bool FPDBDbiStream::ReadModuleInfo(std::span<const uint8_t> ModuleInfoData) {
+    FBinaryReader Reader{ModuleInfoData};
+
+    while (!Reader.IsAtEnd()) {
+        FDbiModuleInfoHeader ModuleHeader{};
+        FDbiModuleInfo& Module = Modules.emplace_back();
+
+        if (!Reader.Read(ModuleHeader) || !Reader.ReadCString(Module.ModuleName) || !Reader.ReadCString(Module.ObjectFileName)) {
+            return false;
+        }
+        Module.ModuleSymbolStreamIndex = ModuleHeader.ModuleSymbolStreamIndex;
+        Module.SymbolByteSize = ModuleHeader.SymbolByteSize;
+
+        ///Module info records are 4 byte aligned relative to the start of the substream
+        Reader.AlignTo(4);
+    }
+    return true;
+}
+
+void FPDBDbiStream::ReadSectionHeaders(const FMSFFile& MSFFile, std::span<const uint8_t> DebugHeaderData, const FDumpLog& Log) {
+    FBinaryReader Reader{DebugHeaderData};
+    uint16_t SectionHeaderStreamIndex = InvalidStreamIndex;
+
+    ///Without the section headers we can still read the symbols, but cannot convert their addresses into RVAs
+    if (!Reader.Seek(static_cast<size_t>(EDbiDebugStream::SectionHeader) * sizeof(uint16_t)) || !Reader.Read(SectionHeaderStreamIndex) ||
+        SectionHeaderStreamIndex == InvalidStreamIndex || !MSFFile.OpenStream(SectionHeaderStreamIndex, SectionHeaderStream)) {
+        Log.Error(L"PDB file does not contain section headers, symbol RVAs will not be available");
+        return;
+    }
+
+    const std::span<const uint8_t> SectionHeaderData = SectionHeaderStream.GetData();
+    SectionHeaders.resize(SectionHeaderData.size() / sizeof(FImageSectionHeader));
+    memcpy(SectionHeaders.data(), SectionHeaderData.data(), SectionHeaders.size() * sizeof(FImageSectionHeader));
+}
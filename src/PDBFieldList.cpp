@@ -0,0 +1,139 @@
+#include "PDBFieldList.h"
+
+///Padding bytes LF_PAD0 to LF_PAD15 inserted between the field list entries to align them to 4 bytes
+static constexpr uint8_t FirstPaddingLeaf = 0xF0;
+
+FFieldListIterator::FFieldListIterator(const FPDBTypeStream& InTypeStream, uint32_t FieldListTypeIndex) : TypeStream(&InTypeStream), RecordTypeIndex(0), bMalformed(false) {
+    if (!StartFieldListRecord(FieldListTypeIndex)) {
+        Reader = FBinaryReader{};
+    }
+}
+
+bool FFieldListIterator::StartFieldListRecord(uint32_t FieldListTypeIndex) {
+    const FTypeRecord Record = TypeStream->GetRecord(FieldListTypeIndex);
+    if (Record.Kind != ELeafKind::FieldList) {
+        return false;
+    }
+    Reader = FBinaryReader{Record.Data};
+    RecordTypeIndex = FieldListTypeIndex;
+    return true;
+}
+
+bool FFieldListIterator::ReadNumeric(uint64_t& OutValue) {
+    size_t Position = Reader.GetPosition();
+    return ReadNumericLeaf(Reader.GetData(), Position, OutValue) && Reader.Seek(Position);
+}
+
+void FFieldListIterator::SkipPadding() {
+    const std::span<const uint8_t> Data = Reader.GetData();
+    const size_t Position = Reader.GetPosition();
+
+    if (Position < Data.size() && Data[Position] >= FirstPaddingLeaf) {
+        ///Padding leaf encodes the number of bytes to skip, including the padding leaf itself
+        const size_t PaddingSize = Data[Position] & 0x0F;
+        if (!Reader.Skip(PaddingSize != 0 ? PaddingSize : 1)) {
+            Reader.Seek(Data.size());
+        }
+    }
+}
+
+bool FFieldListIterator::Next(FFieldRecord& OutRecord) {
+    while (!bMalformed && !Reader.IsAtEnd()) {
+        uint16_t LeafKind = 0;
+        if (!Reader.Read(LeafKind)) {
+            bMalformed = true;
+            return false;
+        }
+        OutRecord = FFieldRecord{};
+        OutRecord.Kind = static_cast<ELeafKind>(LeafKind);
+        bool bDecoded = false;
+        uint16_t Padding = 0;
+        uint32_t UnusedTypeIndex = 0;
+        uint64_t UnusedNumericValue = 0;
+
+        switch (OutRecord.Kind) {
+            case ELeafKind::BaseClass:
+                bDecoded = Reader.Read(OutRecord.Attributes.Value) && Reader.Read(OutRecord.Type) && ReadNumeric(OutRecord.Offset);
+                break;
+            case ELeafKind::VirtualBaseClass:
+            case ELeafKind::IndirectVirtualBaseClass:
+                ///Virtual base pointer type, virtual base pointer offset and the index of the base in the virtual base table
+                bDecoded = Reader.Read(OutRecord.Attributes.Value) && Reader.Read(OutRecord.Type) && Reader.Read(UnusedTypeIndex) &&
+                           ReadNumeric(OutRecord.Offset) && ReadNumeric(UnusedNumericValue);
+                break;
+            case ELeafKind::Member:
+                bDecoded = Reader.Read(OutRecord.Attributes.Value) && Reader.Read(OutRecord.Type) && ReadNumeric(OutRecord.Offset) &&
+                           Reader.ReadCString(OutRecord.Name);
+                break;
+            case ELeafKind::StaticMember:
+                bDecoded = Reader.Read(OutRecord.Attributes.Value) && Reader.Read(OutRecord.Type) && Reader.ReadCString(OutRecord.Name);
+                break;
+            case ELeafKind::Method:
+                bDecoded = Reader.Read(OutRecord.MethodCount) && Reader.Read(OutRecord.Type) && Reader.ReadCString(OutRecord.Name);
+                break;
+            case ELeafKind::OneMethod:
+                bDecoded = Reader.Read(OutRecord.Attributes.Value) && Reader.Read(OutRecord.Type);
+                ///Only introducing virtual functions carry their offset in the virtual table
+                if (bDecoded && OutRecord.Attributes.IsIntroducingVirtual()) {
+                    bDecoded = Reader.Read(OutRecord.VirtualTableOffset);
+                }
+                bDecoded = bDecoded && Reader.ReadCString(OutRecord.Name);
+                break;
+            case ELeafKind::NestedType:
+                bDecoded = Reader.Read(Padding) && Reader.Read(OutRecord.Type) && Reader.ReadCString(OutRecord.Name);
+                break;
+            case ELeafKind::VirtualFunctionTable:
+                bDecoded = Reader.Read(Padding) && Reader.Read(OutRecord.Type);
+                break;
+            case ELeafKind::Enumerate:
+                bDecoded = Reader.Read(OutRecord.Attributes.Value) && ReadNumeric(OutRecord.Offset) && Reader.ReadCString(OutRecord.Name);
+                break;
+            case ELeafKind::Index: {
+                ///Field list is too long to fit into one record and continues in another one, always an earlier one
+                uint32_t ContinuationTypeIndex = 0;
+                if (!Reader.Read(Padding) || !Reader.Read(ContinuationTypeIndex) || ContinuationTypeIndex >= RecordTypeIndex ||
+                    !StartFieldListRecord(ContinuationTypeIndex)) {
+                    bMalformed = true;
+                    return false;
+                }
+                continue;
+            }
+            default:
+                ///Unknown entries have no length prefix, so there is no way to skip over them
+                bMalformed = true;
+                return false;
+        }
+
+        if (!bDecoded) {
+            bMalformed = true;
+            return false;
+        }
+        SkipPadding();
+        return true;
+    }
+    return false;
+}
+
+FMethodListIterator::FMethodListIterator(const FPDBTypeStream& TypeStream, uint32_t MethodListTypeIndex) {
+    const FTypeRecord Record = TypeStream.GetRecord(MethodListTypeIndex);
+    if (Record.Kind == ELeafKind::MethodList) {
+        Reader = FBinaryReader{Record.Data};
+    }
+}
+
+bool FMethodListIterator::Next(FMethodListEntry& OutEntry) {
+    if (Reader.IsAtEnd()) {
+        return false;
+    }
+    OutEntry = FMethodListEntry{};
+    uint16_t Padding = 0;
+    if (!Reader.Read(OutEntry.Attributes.Value) || !Reader.Read(Padding) || !Reader.Read(OutEntry.Type)) {
+        Reader.Seek(Reader.GetData().size());
+        return false;
+    }
+    if (OutEntry.Attributes.IsIntroducingVirtual() && !Reader.Read(OutEntry.VirtualTableOffset)) {
+        Reader.Seek(Reader.GetData().size());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,127 @@
+#include "PDBForwardReferenceTable.h"
+#include "ParallelFor.h"
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
+
+struct FTagRecordKey {
+    std::string_view Name;
+    std::string_view UniqueName;
+    uint32_t TypeIndex;
+};
+
+///First definitions of the name, the one without the unique name kept apart for the forward declarations that have one
+struct FNamedDefinitions {
+    uint32_t FirstTypeIndex{0};
+    uint32_t FirstTypeIndexWithoutUniqueName{0};
+};
+
+///Forward declarations and definitions discovered in a single chunk of the type stream
+struct FChunkTagRecords {
+    std::vector<FTagRecordKey> ForwardReferences;
+    std::vector<FTagRecordKey> Definitions;
+    std::vector<FForwardReferenceEntry> ResolvedEntries;
+};
+
+/**
+ * Unique names are decorated, so they tell apart types with the same name from different anonymous namespaces
+ * They are only compared when both the forward declaration and the definition have one, otherwise the plain names are matched instead
+ * A definition with a different unique name is another type, so the forward declaration with one only falls back to the definitions without it
+ */
+static uint32_t FindDefinition(const FTagRecordKey& ForwardReference, const std::unordered_map<std::string_view, uint32_t>& DefinitionsByUniqueName,
+                               const std::unordered_map<std::string_view, FNamedDefinitions>& DefinitionsByName) {
+    if (!ForwardReference.UniqueName.empty()) {
+        auto Iterator = DefinitionsByUniqueName.find(ForwardReference.UniqueName);
+        if (Iterator != DefinitionsByUniqueName.end()) {
+            return Iterator->second;
+        }
+    }
+    auto Iterator = DefinitionsByName.find(ForwardReference.Name);
+    if (Iterator == DefinitionsByName.end()) {
+        return 0;
+    }
+    return ForwardReference.UniqueName.empty() ? Iterator->second.FirstTypeIndex : Iterator->second.FirstTypeIndexWithoutUniqueName;
+}
+
+void FPDBForwardReferenceTable::Build(const FPDBTypeStream& TypeStream) {
+    Entries.clear();
+    std::vector<FChunkTagRecords> ChunkRecords(TypeStream.GetNumChunks());
+
+    ///First pass: collect the names of the forward declarations and definitions, every chunk into its own arrays
+    ParallelFor(ChunkRecords.size(), [&](size_t ChunkIndex) {
+        uint32_t TypeIndexBegin = 0;
+        uint32_t TypeIndexEnd = 0;
+        TypeStream.GetChunkTypeIndexRange(ChunkIndex, TypeIndexBegin, TypeIndexEnd);
+        FChunkTagRecords& Records = ChunkRecords[ChunkIndex];
+
+        for (uint32_t TypeIndex = TypeIndexBegin; TypeIndex < TypeIndexEnd; TypeIndex++) {
+            const FTypeRecord Record = TypeStream.GetRecord(TypeIndex);
+            FTagRecord TagRecord{};
+            if (!IsTagRecordKind(Record.Kind) || !DecodeTagRecord(Record, TagRecord)) {
+                continue;
+            }
+            if (TagRecord.IsForwardReference()) {
+                Records.ForwardReferences.push_back({TagRecord.Name, TagRecord.UniqueName, TypeIndex});
+            } else {
+                Records.Definitions.push_back({TagRecord.Name, TagRecord.UniqueName, TypeIndex});
+            }
+        }
+    });
+
+    ///Merge the definitions in the type index order, so the first definition of the type wins
+    size_t TotalDefinitions = 0;
+    for (const FChunkTagRecords& Records : ChunkRecords) {
+        TotalDefinitions += Records.Definitions.size();
+    }
+    std::unordered_map<std::string_view, uint32_t> DefinitionsByUniqueName;
+    std::unordered_map<std::string_view, FNamedDefinitions> DefinitionsByName;
+    DefinitionsByUniqueName.reserve(TotalDefinitions);
+    DefinitionsByName.reserve(TotalDefinitions);
+
+    for (FChunkTagRecords& Records : ChunkRecords) {
+        for (const FTagRecordKey& Definition : Records.Definitions) {
+            if (!Definition.UniqueName.empty()) {
+                DefinitionsByUniqueName.try_emplace(Definition.UniqueName, Definition.TypeIndex);
+            }
+            FNamedDefinitions& NamedDefinitions = DefinitionsByName[Definition.Name];
+            if (NamedDefinitions.FirstTypeIndex == 0) {
+                NamedDefinitions.FirstTypeIndex = Definition.TypeIndex;
+            }
+            if (NamedDefinitions.FirstTypeIndexWithoutUniqueName == 0 && Definition.UniqueName.empty()) {
+                NamedDefinitions.FirstTypeIndexWithoutUniqueName = Definition.TypeIndex;
+            }
+        }
+        Records.Definitions = {};
+    }
+
+    ///Second pass: resolve the forward declarations against the now read-only definition maps. Type index 0 is a simple type, never a definition
+    ParallelFor(ChunkRecords.size(), [&](size_t ChunkIndex) {
+        FChunkTagRecords& Records = ChunkRecords[ChunkIndex];
+        for (const FTagRecordKey& ForwardReference : Records.ForwardReferences) {
+            const uint32_t DefinitionTypeIndex = FindDefinition(ForwardReference, DefinitionsByUniqueName, DefinitionsByName);
+            if (DefinitionTypeIndex != 0) {
+                Records.ResolvedEntries.push_back({ForwardReference.TypeIndex, DefinitionTypeIndex});
+            }
+        }
+    });
+
+    ///Chunks are ordered by the type index, so concatenating them keeps the table sorted
+    size_t TotalEntries = 0;
+    for (const FChunkTagRecords& Records : ChunkRecords) {
+        TotalEntries += Records.ResolvedEntries.size();
+    }
+    Entries.reserve(TotalEntries);
+    for (const FChunkTagRecords& Records : ChunkRecords) {
+        Entries.insert(Entries.end(), Records.ResolvedEntries.begin(), Records.ResolvedEntries.end());
+    }
+}
+
+uint32_t FPDBForwardReferenceTable::ResolveForwardReference(uint32_t TypeIndex) const {
+    auto Iterator = std::lower_bound(Entries.begin(), Entries.end(), TypeIndex, [](const FForwardReferenceEntry& Entry, uint32_t Value) {
+        return Entry.ForwardTypeIndex < Value;
+    });
+    if (Iterator != Entries.end() && Iterator->ForwardTypeIndex == TypeIndex) {
+        return Iterator->DefinitionTypeIndex;
+    }
+    return TypeIndex;
+}
@@ -0,0 +1,72 @@
+#include "PDBInfoStream.h"
+#include "BinaryReader.h"
+#include <bit>
+
+bool FPDBInfoStream::Open(const FMSFFile& MSFFile, const FDumpLog& Log) {
+    if (!MSFFile.OpenStream(EPDBFixedStream::PDBInfo, Stream)) {
+        Log.Error(L"PDB file does not contain a PDB info stream");
+        return false;
+    }
+
+    FBinaryReader Reader{Stream.GetData()};
+    if (!Reader.Read(Header) || !ReadNamedStreamMap(Reader)) {
+        Log.Error(L"PDB info stream is malformed");
+        return false;
+    }
+    return true;
+}
+
+bool FPDBInfoStream::ReadNamedStreamMap(FBinaryReader& Reader) {
+    ///Names are stored back to back in a single buffer, and the hash table maps the offsets of the names to the stream indices
+    uint32_t StringBufferSize = 0;
+    std::span<const uint8_t> StringBuffer;
+    if (!Reader.Read(StringBufferSize) || !Reader.ReadBytes(StringBufferSize, StringBuffer)) {
+        return false;
+    }
+
+    uint32_t NumEntries = 0;
+    uint32_t Capacity = 0;
+    uint32_t NumPresentWords = 0;
+    if (!Reader.Read(NumEntries) || !Reader.Read(Capacity) || !Reader.Read(NumPresentWords)) {
+        return false;
+    }
+
+    ///Only the number of the present buckets matters, the entries of the present buckets follow both of the bit vectors in order
+    uint32_t NumPresentBuckets = 0;
+    for (uint32_t i = 0; i < NumPresentWords; i++) {
+        uint32_t PresentWord = 0;
+        if (!Reader.Read(PresentWord)) {
+            return false;
+        }
+        NumPresentBuckets += std::popcount(PresentWord);
+    }
+    uint32_t NumDeletedWords = 0;
+    if (!Reader.Read(NumDeletedWords) || !Reader.Skip(static_cast<size_t>(NumDeletedWords) * sizeof(uint32_t))) {
+        return false;
+    }
+
+    const std::string_view Names{reinterpret_cast<const char*>(StringBuffer.data()), StringBuffer.size()};
+    NamedStreams.reserve(NumPresentBuckets);
+
+    for (uint32_t i = 0; i < NumPresentBuckets; i++) {
+        uint32_t NameOffset = 0;
+        uint32_t StreamIndex = 0;
+        if (!Reader.Read(NameOffset) || !Reader.Read(StreamIndex)) {
+            return false;
+        }
+        if (NameOffset < Names.size()) {
+            const std::string_view Name = Names.substr(NameOffset);
+            NamedStreams.push_back(FNamedStreamEntry{Name.substr(0, Name.find('\0')), StreamIndex});
+        }
+    }
+    return true;
+}
+
+uint32_t FPDBInfoStream::GetNamedStreamIndex(std::string_view StreamName) const {
+    for (const FNamedStreamEntry& Entry : NamedStreams) {
+        if (Entry.Name == StreamName) {
+            return Entry.StreamIndex;
+        }
+    }
+    return InvalidStreamIndex;
+}
@@ -0,0 +1,32 @@
+#include "PDBSession.h"
+
+bool FPDBSession::Open(const std::filesystem::path& PDBFilePath, const FDumpLog& Log) {
+    if (!MSFFile.Open(PDBFilePath, Log)) {
+        return false;
+    }
+    if (!TypeStream.Open(MSFFile, EPDBFixedStream::TPI, Log)) {
+        Log.Error(L"Failed to open the TPI stream of PDB file " + PDBFilePath.wstring());
+        return false;
+    }
+    TypeNameIndex.Build(TypeStream);
+    ForwardReferenceTable.Build(TypeStream);
+
+    ///Symbols are optional, PDBs without them still produce the type layouts, just without the RVAs
+    if (MSFFile.IsStreamPresent(static_cast<uint32_t>(EPDBFixedStream::DBI)) && DbiStream.Open(MSFFile, Log)) {
+        SymbolTable.Build(MSFFile, DbiStream, Log);
+        bHasSymbols = true;
+    }
+
+    ///Source lines of the types live in the IPI stream, with the file names stored in the /names stream
+    if (MSFFile.IsStreamPresent(static_cast<uint32_t>(EPDBFixedStream::IPI)) && InfoStream.Open(MSFFile, Log) &&
+        IdStream.Open(MSFFile, EPDBFixedStream::IPI, Log)) {
+        ///Without the /names stream only the LF_UDT_SRC_LINE records can be resolved, as they name the file through LF_STRING_ID
+        const uint32_t StringTableStreamIndex = InfoStream.GetNamedStreamIndex("/names");
+        if (StringTableStreamIndex != InvalidStreamIndex) {
+            StringTable.Open(MSFFile, StringTableStreamIndex, Log);
+        }
+        SourceLineIndex.Build(IdStream, StringTable);
+        IdStream.ReleaseResidentPages();
+    }
+    return true;
+}
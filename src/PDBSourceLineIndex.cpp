@@ -0,0 +1,28 @@
+#include "PDBSourceLineIndex.h"
+
+void FPDBSourceLineIndex::Build(const FPDBTypeStream& IdStream, const FPDBStringTable& StringTable) {
+    if (!IdStream.BuildFullIndex()) {
+        return;
+    }
+    for (uint32_t IdIndex = IdStream.GetTypeIndexBegin(); IdIndex < IdStream.GetTypeIndexEnd(); IdIndex++) {
+        const FTypeRecord Record = IdStream.GetRecord(IdIndex);
+        FUDTSourceLineRecord SourceLineRecord{};
+        if (!DecodeUDTSourceLineRecord(Record, SourceLineRecord)) {
+            continue;
+        }
+
+        ///LF_UDT_MOD_SRC_LINE written by the linker refers to the /names stream directly, the compiler emitted LF_UDT_SRC_LINE goes through LF_STRING_ID
+        std::string_view SourceFile;
+        if (Record.Kind == ELeafKind::UDTModuleSourceLine) {
+            SourceFile = StringTable.GetString(SourceLineRecord.SourceFile);
+        } else {
+            FStringIdRecord StringIdRecord{};
+            if (DecodeStringIdRecord(IdStream.GetRecord(SourceLineRecord.SourceFile), StringIdRecord)) {
+                SourceFile = StringIdRecord.String;
+            }
+        }
+        if (!SourceFile.empty()) {
+            SourceLines.insert_or_assign(SourceLineRecord.UDT, FUDTSourceLine{SourceFile, SourceLineRecord.LineNumber});
+        }
+    }
+}
@@ -0,0 +1,28 @@
+#include "PDBStringTable.h"
+#include "BinaryReader.h"
+
+static constexpr uint32_t StringTableSignature = 0xEFFEEFFE;
+
+bool FPDBStringTable::Open(const FMSFFile& MSFFile, uint32_t StreamIndex, const FDumpLog& Log) {
+    if (!MSFFile.OpenStream(StreamIndex, Stream)) {
+        return false;
+    }
+
+    FBinaryReader Reader{Stream.GetData()};
+    FStringTableHeader Header{};
+    std::span<const uint8_t> StringData;
+    if (!Reader.Read(Header) || Header.Signature != StringTableSignature || !Reader.ReadBytes(Header.ByteSize, StringData)) {
+        Log.Error(L"PDB string table is malformed");
+        return false;
+    }
+    StringBuffer = std::string_view{reinterpret_cast<const char*>(StringData.data()), StringData.size()};
+    return true;
+}
+
+std::string_view FPDBStringTable::GetString(uint32_t Offset) const {
+    if (Offset >= StringBuffer.size()) {
+        return {};
+    }
+    const std::string_view String = StringBuffer.substr(Offset);
+    return String.substr(0, String.find('\0'));
+}
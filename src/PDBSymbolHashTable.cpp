@@ -0,0 +1,111 @@
+#include "PDBSymbolHashTable.h"
+#include "BinaryReader.h"
+#include "PDBHash.h"
+#include <algorithm>
+
+///Supported version of the GSI hash table, written by every MSVC since Visual C++ 7.0
+static constexpr uint32_t GSIHashVersionSignature = 0xFFFFFFFF;
+static constexpr uint32_t GSIHashVersionV70 = 0xeffe0000 + 19990810;
+
+///Number of the hash buckets. The bitmap has one extra bit which is never set, rounded up to the whole 32-bit words
+static constexpr uint32_t NumHashBuckets = 4096;
+static constexpr uint32_t NumBitmapWords = (NumHashBuckets + 32) / 32;
+
+///Bucket offsets are stored as the offsets into the in-memory array of the 32-bit hash records MSVC uses, which are 12 bytes each
+static constexpr uint32_t InMemoryHashRecordSize = 12;
+
+///Hash record as stored in the file. Offset is the offset of the symbol in the symbol record stream plus one
+struct FGSIHashRecord {
+    int32_t Offset;
+    int32_t ReferenceCount;
+};
+
+bool FPDBSymbolHashTable::Read(std::span<const uint8_t> HashData, std::span<const uint8_t> InSymbolRecordData, const FDumpLog& Log) {
+    SymbolRecordData = InSymbolRecordData;
+
+    FBinaryReader Reader{HashData};
+    FGSIHashHeader Header{};
+    if (!Reader.Read(Header) || Header.VersionSignature != GSIHashVersionSignature || Header.VersionHeader != GSIHashVersionV70) {
+        Log.Error(L"Unsupported GSI hash table header");
+        return false;
+    }
+
+    std::span<const uint8_t> HashRecordData;
+    std::span<const uint8_t> BucketData;
+    if (!Reader.ReadBytes(Header.HashRecordsSize, HashRecordData) || !Reader.ReadBytes(Header.BucketsSize, BucketData) ||
+        BucketData.size() < NumBitmapWords * sizeof(uint32_t)) {
+        Log.Error(L"GSI hash table is truncated");
+        return false;
+    }
+
+    const size_t NumRecords = HashRecordData.size() / sizeof(FGSIHashRecord);
+    RecordOffsets.resize(NumRecords);
+    for (size_t i = 0; i < NumRecords; i++) {
+        const auto HashRecord = ReadUnaligned<FGSIHashRecord>(HashRecordData.data() + i * sizeof(FGSIHashRecord));
+        RecordOffsets[i] = static_cast<uint32_t>(HashRecord.Offset - 1);
+    }
+
+    ///Only the non-empty buckets have their start stored, in the order of the set bits of the bitmap
+    ///Walking the buckets backwards lets the empty ones take the start of the next non-empty bucket, so every bucket is a [Start, Next Start) range
+    const uint8_t* BitmapData = BucketData.data();
+    const uint8_t* BucketOffsetData = BitmapData + NumBitmapWords * sizeof(uint32_t);
+    size_t NumBucketOffsets = (BucketData.size() - NumBitmapWords * sizeof(uint32_t)) / sizeof(uint32_t);
+
+    BucketStarts.resize(NumHashBuckets + 2);
+    BucketStarts[NumHashBuckets + 1] = static_cast<uint32_t>(NumRecords);
+
+    for (uint32_t BucketIndex = NumHashBuckets + 1; BucketIndex-- > 0;) {
+        const auto BitmapWord = ReadUnaligned<uint32_t>(BitmapData + (BucketIndex / 32) * sizeof(uint32_t));
+        const uint32_t NextBucketStart = BucketStarts[BucketIndex + 1];
+
+        if ((BitmapWord & (1u << (BucketIndex % 32))) != 0 && NumBucketOffsets != 0) {
+            NumBucketOffsets--;
+            const uint32_t BucketStart = ReadUnaligned<uint32_t>(BucketOffsetData + NumBucketOffsets * sizeof(uint32_t)) / InMemoryHashRecordSize;
+            BucketStarts[BucketIndex] = std::min(BucketStart, NextBucketStart);
+        } else {
+            BucketStarts[BucketIndex] = NextBucketStart;
+        }
+    }
+    return true;
+}
+
+bool FPDBSymbolHashTable::FindSymbol(std::string_view Name, FSymbolRecord& OutRecord) const {
+    if (BucketStarts.empty()) {
+        return false;
+    }
+    const uint32_t BucketIndex = HashStringV1(Name) % NumHashBuckets;
+
+    for (uint32_t i = BucketStarts[BucketIndex]; i < BucketStarts[BucketIndex + 1]; i++) {
+        size_t Position = RecordOffsets[i];
+        FSymbolRecord Record{};
+        std::string_view SymbolName;
+
+        if (ReadSymbolRecord(SymbolRecordData, Position, Record) && GetSymbolName(Record, SymbolName) && SymbolName == Name) {
+            OutRecord = Record;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FPDBPublicSymbolTable::Open(const FMSFFile& MSFFile, const FPDBDbiStream& DbiStream, std::span<const uint8_t> SymbolRecordData, const FDumpLog& Log) {
+    const uint16_t PublicSymbolStreamIndex = DbiStream.GetHeader().PublicSymbolStreamIndex;
+    if (PublicSymbolStreamIndex == InvalidStreamIndex || !MSFFile.OpenStream(PublicSymbolStreamIndex, PublicSymbolStream)) {
+        return false;
+    }
+
+    ///Hash table is followed by the address map and the thunk map, neither of which the lookups by name need
+    FBinaryReader Reader{PublicSymbolStream.GetData()};
+    FPSIHeader Header{};
+    std::span<const uint8_t> HashData;
+    if (!Reader.Read(Header) || !Reader.ReadBytes(Header.SymbolHashSize, HashData)) {
+        Log.Error(L"Public symbol stream is truncated");
+        return false;
+    }
+    return HashTable.Read(HashData, SymbolRecordData, Log);
+}
+
+bool FPDBPublicSymbolTable::FindSymbolByName(std::string_view DecoratedName, FPublicSymbol& OutSymbol) const {
+    FSymbolRecord Record{};
+    return HashTable.FindSymbol(DecoratedName, Record) && DecodePublicSymbol(Record, OutSymbol);
+}
@@ -0,0 +1,678 @@
+#include "PDBSymbolSource.h"
+#include <algorithm>
+
+///A type with the LF_MODIFIER records stripped and the forward declarations resolved to their definitions
+struct FResolvedType {
+    uint32_t TypeIndex{0};
+    FTypeRecord Record{};
+    bool bIsConst{false};
+    bool bIsVolatile{false};
+
+    inline bool IsSimpleType() const {
+        return IsSimpleTypeIndex(TypeIndex);
+    }
+};
+
+///Kinds of the built-in types, stored in the low byte of the simple type indices
+enum ESimpleTypeKind : uint8_t {
+    STK_None = 0x00,
+    STK_Void = 0x03,
+    STK_HResult = 0x08,
+    STK_SignedCharacter = 0x10,
+    STK_Int16Short = 0x11,
+    STK_Int32Long = 0x12,
+    STK_Int64Quad = 0x13,
+    STK_UnsignedCharacter = 0x20,
+    STK_UInt16Short = 0x21,
+    STK_UInt32Long = 0x22,
+    STK_UInt64Quad = 0x23,
+    STK_Boolean8 = 0x30,
+    STK_Boolean16 = 0x31,
+    STK_Boolean32 = 0x32,
+    STK_Boolean64 = 0x33,
+    STK_Float32 = 0x40,
+    STK_Float64 = 0x41,
+    STK_SByte = 0x68,
+    STK_Byte = 0x69,
+    STK_NarrowCharacter = 0x70,
+    STK_WideCharacter = 0x71,
+    STK_Int16 = 0x72,
+    STK_UInt16 = 0x73,
+    STK_Int32 = 0x74,
+    STK_UInt32 = 0x75,
+    STK_Int64 = 0x76,
+    STK_UInt64 = 0x77,
+    STK_Character16 = 0x7a,
+    STK_Character32 = 0x7b,
+    STK_Character8 = 0x7c,
+};
+
+///Kinds of the symbols the handles refer to, stored in the high byte of the handle
+enum class EPDBHandleKind : uint8_t {
+    Type = 0x01,
+    BaseClass = 0x02,
+    DataMember = 0x03,
+    Function = 0x04,
+    ///Arguments of the function types, which only exist as the entries of the LF_ARGLIST record
+    FunctionArgument = 0x05,
+};
+
+static constexpr uint32_t HandleKindShift = 56;
+///Members and arguments store their position in the bits between the type index and the kind
+static constexpr uint32_t HandleMemberIndexShift = 32;
+static constexpr uint64_t HandleMemberIndexMask = (1ull << (HandleKindShift - HandleMemberIndexShift)) - 1;
+
+static FSymbolHandle MakeTypeHandle(uint32_t TypeIndex) {
+    return FSymbolHandle{(static_cast<uint64_t>(EPDBHandleKind::Type) << HandleKindShift) | TypeIndex};
+}
+
+static FSymbolHandle MakeMemberHandle(EPDBHandleKind Kind, uint32_t TypeIndex, size_t MemberIndex) {
+    return FSymbolHandle{(static_cast<uint64_t>(Kind) << HandleKindShift) | ((MemberIndex & HandleMemberIndexMask) << HandleMemberIndexShift) | TypeIndex};
+}
+
+static EPDBHandleKind GetHandleKind(FSymbolHandle Symbol) {
+    return static_cast<EPDBHandleKind>(Symbol.Id >> HandleKindShift);
+}
+
+static uint32_t GetHandleTypeIndex(FSymbolHandle Symbol) {
+    return static_cast<uint32_t>(Symbol.Id);
+}
+
+static size_t GetHandleMemberIndex(FSymbolHandle Symbol) {
+    return static_cast<size_t>((Symbol.Id >> HandleMemberIndexShift) & HandleMemberIndexMask);
+}
+
+static FResolvedType ResolveType(const FPDBSession& Session, uint32_t TypeIndex) {
+    FResolvedType ResolvedType{};
+
+    ///Modifiers can be nested, e.g. a volatile of a const type, so keep stripping them until we hit the actual type
+    while (!IsSimpleTypeIndex(TypeIndex)) {
+        const FTypeRecord Record = Session.GetTypeStream().GetRecord(TypeIndex);
+        FModifierRecord ModifierRecord{};
+
+        if (DecodeModifierRecord(Record, ModifierRecord)) {
+            ResolvedType.bIsConst |= (ModifierRecord.Modifiers & MO_Const) != 0;
+            ResolvedType.bIsVolatile |= (ModifierRecord.Modifiers & MO_Volatile) != 0;
+            TypeIndex = ModifierRecord.ModifiedType;
+            continue;
+        }
+        if (IsTagRecordKind(Record.Kind)) {
+            const uint32_t DefinitionTypeIndex = Session.GetForwardReferenceTable().ResolveForwardReference(TypeIndex);
+            ResolvedType.TypeIndex = DefinitionTypeIndex;
+            ResolvedType.Record = DefinitionTypeIndex != TypeIndex ? Session.GetTypeStream().GetRecord(DefinitionTypeIndex) : Record;
+            return ResolvedType;
+        }
+        ResolvedType.TypeIndex = TypeIndex;
+        ResolvedType.Record = Record;
+        return ResolvedType;
+    }
+    ResolvedType.TypeIndex = TypeIndex;
+    return ResolvedType;
+}
+
+static bool IsUserDefinedTypeKind(ELeafKind Kind) {
+    return Kind == ELeafKind::Class || Kind == ELeafKind::Structure || Kind == ELeafKind::Union || Kind == ELeafKind::Interface;
+}
+
+static bool IsFunctionTypeKind(ELeafKind Kind) {
+    return Kind == ELeafKind::Procedure || Kind == ELeafKind::MemberFunction;
+}
+
+static uint64_t GetSimpleTypeSize(uint32_t TypeIndex) {
+    ///Mode 4 is a 32-bit near pointer, any other non-zero mode is a 64-bit pointer on the platforms we care about
+    const uint32_t PointerMode = (TypeIndex >> 8) & 0xF;
+    if (PointerMode != 0) {
+        return PointerMode == 4 ? 4 : 8;
+    }
+    switch (TypeIndex & 0xFF) {
+        case STK_SignedCharacter:
+        case STK_UnsignedCharacter:
+        case STK_Boolean8:
+        case STK_SByte:
+        case STK_Byte:
+        case STK_NarrowCharacter:
+        case STK_Character8:
+            return 1;
+        case STK_Int16Short:
+        case STK_UInt16Short:
+        case STK_Boolean16:
+        case STK_WideCharacter:
+        case STK_Int16:
+        case STK_UInt16:
+        case STK_Character16:
+            return 2;
+        case STK_HResult:
+        case STK_Int32Long:
+        case STK_UInt32Long:
+        case STK_Boolean32:
+        case STK_Float32:
+        case STK_Int32:
+        case STK_UInt32:
+        case STK_Character32:
+            return 4;
+        case STK_Int64Quad:
+        case STK_UInt64Quad:
+        case STK_Boolean64:
+        case STK_Float64:
+        case STK_Int64:
+        case STK_UInt64:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+static uint64_t GetTypeSize(const FPDBSession& Session, uint32_t TypeIndex) {
+    const FResolvedType Type = ResolveType(Session, TypeIndex);
+    if (Type.IsSimpleType()) {
+        return GetSimpleTypeSize(Type.TypeIndex);
+    }
+    switch (Type.Record.Kind) {
+        case ELeafKind::Pointer: {
+            FPointerRecord PointerRecord{};
+            return DecodePointerRecord(Type.Record, PointerRecord) && PointerRecord.GetSize() != 0 ? PointerRecord.GetSize() : 8;
+        }
+        case ELeafKind::Array: {
+            FArrayRecord ArrayRecord{};
+            return DecodeArrayRecord(Type.Record, ArrayRecord) ? ArrayRecord.Size : 0;
+        }
+        case ELeafKind::BitField: {
+            FBitFieldRecord BitFieldRecord{};
+            return DecodeBitFieldRecord(Type.Record, BitFieldRecord) ? GetTypeSize(Session, BitFieldRecord.Type) : 0;
+        }
+        case ELeafKind::Enum: {
+            FTagRecord TagRecord{};
+            return DecodeTagRecord(Type.Record, TagRecord) ? GetTypeSize(Session, TagRecord.UnderlyingType) : 0;
+        }
+        default: {
+            FTagRecord TagRecord{};
+            return IsUserDefinedTypeKind(Type.Record.Kind) && DecodeTagRecord(Type.Record, TagRecord) ? TagRecord.Size : 0;
+        }
+    }
+}
+
+
+///Maps the built-in types to the basic types the DIA symbols report for them. Kinds DIA has no basic type for are left without one
+static EBasicType ConvertSimpleTypeKind(uint32_t TypeIndex) {
+    switch (TypeIndex & 0xFF) {
+        case STK_Void: return EBasicType::Void;
+        case STK_SignedCharacter:
+        case STK_NarrowCharacter: return EBasicType::Char;
+        case STK_WideCharacter: return EBasicType::WChar;
+        case STK_Boolean8: return EBasicType::Bool;
+        case STK_SByte:
+        case STK_Int16Short:
+        case STK_Int16:
+        case STK_Int32Long:
+        case STK_Int32:
+        case STK_Int64Quad:
+        case STK_Int64: return EBasicType::Int;
+        case STK_UnsignedCharacter:
+        case STK_Byte:
+        case STK_UInt16Short:
+        case STK_UInt16:
+        case STK_UInt32Long:
+        case STK_UInt32:
+        case STK_UInt64Quad:
+        case STK_UInt64: return EBasicType::UInt;
+        case STK_Float32:
+        case STK_Float64: return EBasicType::Float;
+        case STK_Character8: return EBasicType::Char8;
+        case STK_Character16: return EBasicType::Char16;
+        case STK_Character32: return EBasicType::Char32;
+        default: return EBasicType::NoType;
+    }
+}
+
+static EMemberAccess ConvertFieldAccess(FFieldAttributes Attributes) {
+    switch (Attributes.GetAccess()) {
+        case EFieldAccess::Private: return EMemberAccess::Private;
+        case EFieldAccess::Protected: return EMemberAccess::Protected;
+        case EFieldAccess::Public: return EMemberAccess::Public;
+        default: return EMemberAccess::Unspecified;
+    }
+}
+
+static EUDTKind ConvertUserDefinedTypeKind(ELeafKind Kind) {
+    switch (Kind) {
+        case ELeafKind::Class: return EUDTKind::Class;
+        case ELeafKind::Union: return EUDTKind::Union;
+        case ELeafKind::Interface: return EUDTKind::Interface;
+        default: return EUDTKind::Struct;
+    }
+}
+
+bool FPDBSymbolSource::Open(const std::filesystem::path& PDBFilePath, const FDumpLog& Log) {
+    return Session.Open(PDBFilePath, Log);
+}
+
+FSymbolHandle FPDBSymbolSource::FindUserDefinedType(const std::string& TypeName) const {
+    ///Type name index answers every lookup from the TPI hash buckets, and builds its fallback name table at most once for all of them
+    const uint32_t TypeIndex = Session.GetTypeNameIndex().FindUserDefinedType(TypeName);
+    return TypeIndex != 0 ? MakeTypeHandle(TypeIndex) : FSymbolHandle{};
+}
+
+const FPDBTypeMembers& FPDBSymbolSource::GetTypeMembers(uint32_t TypeIndex) const {
+    {
+        std::lock_guard Lock{TypeMembersLock};
+        const auto Iterator = TypeMembers.find(TypeIndex);
+        if (Iterator != TypeMembers.end()) {
+            return *Iterator->second;
+        }
+    }
+    ///Field list is decoded outside of the lock, so that the lookups of the other types do not wait for it
+    auto Members = std::make_unique<FPDBTypeMembers>();
+    FTagRecord TagRecord{};
+    if (DecodeTagRecord(Session.GetTypeStream().GetRecord(TypeIndex), TagRecord) && IsUserDefinedTypeKind(TagRecord.Kind)) {
+        FFieldListIterator FieldIterator{Session.GetTypeStream(), TagRecord.FieldList};
+        FFieldRecord Field{};
+
+        while (FieldIterator.Next(Field)) {
+            const FPDBMember Member{Field.Kind, Field.Attributes, Field.Type, Field.Offset, Field.VirtualTableOffset, Field.Name};
+            switch (Field.Kind) {
+                case ELeafKind::BaseClass:
+                case ELeafKind::VirtualBaseClass:
+                    Members->BaseClasses.push_back(Member);
+                    break;
+                case ELeafKind::Member:
+                case ELeafKind::StaticMember:
+                    Members->DataMembers.push_back(Member);
+                    break;
+                case ELeafKind::OneMethod:
+                    Members->Functions.push_back(Member);
+                    break;
+                ///Overloaded function, with all of the overloads stored in the separate method list record
+                case ELeafKind::Method: {
+                    FMethodListIterator MethodIterator{Session.GetTypeStream(), Field.Type};
+                    FMethodListEntry Method{};
+                    while (MethodIterator.Next(Method)) {
+                        Members->Functions.push_back(FPDBMember{ELeafKind::OneMethod, Method.Attributes, Method.Type, 0, Method.VirtualTableOffset, Field.Name});
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+    }
+    std::lock_guard Lock{TypeMembersLock};
+    return *TypeMembers.try_emplace(TypeIndex, std::move(Members)).first->second;
+}
+
+const FPDBMember* FPDBSymbolSource::FindMember(FSymbolHandle Symbol) const {
+    const FPDBTypeMembers& Members = GetTypeMembers(GetHandleTypeIndex(Symbol));
+    const std::vector<FPDBMember>* MemberList = nullptr;
+    switch (GetHandleKind(Symbol)) {
+        case EPDBHandleKind::BaseClass: MemberList = &Members.BaseClasses; break;
+        case EPDBHandleKind::DataMember: MemberList = &Members.DataMembers; break;
+        case EPDBHandleKind::Function: MemberList = &Members.Functions; break;
+        default: return nullptr;
+    }
+    const size_t MemberIndex = GetHandleMemberIndex(Symbol);
+    return MemberIndex < MemberList->size() ? &(*MemberList)[MemberIndex] : nullptr;
+}
+
+///Returns true if the function is a member function with a const this pointer
+bool FPDBSymbolSource::IsConstMemberFunction(uint32_t FunctionTypeIndex) const {
+    FProcedureRecord ProcedureRecord{};
+    if (!DecodeProcedureRecord(ResolveType(Session, FunctionTypeIndex).Record, ProcedureRecord) || ProcedureRecord.ThisType == 0) {
+        return false;
+    }
+    const FResolvedType ThisType = ResolveType(Session, ProcedureRecord.ThisType);
+    FPointerRecord ThisPointerRecord{};
+    if (ThisType.IsSimpleType() || !DecodePointerRecord(ThisType.Record, ThisPointerRecord)) {
+        return false;
+    }
+    return ResolveType(Session, ThisPointerRecord.ReferentType).bIsConst;
+}
+
+bool FPDBSymbolSource::GetTypeInfo(uint32_t TypeIndex, FSymbolInfo& OutInfo) const {
+    const FResolvedType Type = ResolveType(Session, TypeIndex);
+    OutInfo.bIsConst = Type.bIsConst;
+    OutInfo.bIsVolatile = Type.bIsVolatile;
+    OutInfo.Length = GetTypeSize(Session, TypeIndex);
+
+    ///Built-in types, like ints, longs, characters and pointers to them
+    if (Type.IsSimpleType()) {
+        if (((Type.TypeIndex >> 8) & 0xF) != 0) {
+            OutInfo.Tag = ESymbolTag::PointerType;
+            OutInfo.Type = MakeTypeHandle(Type.TypeIndex & 0xFF);
+        } else {
+            OutInfo.Tag = ESymbolTag::BaseType;
+            OutInfo.BasicType = ConvertSimpleTypeKind(Type.TypeIndex);
+        }
+        return true;
+    }
+
+    switch (Type.Record.Kind) {
+        ///Pointer types, and also the reference types. Pointers carry their own const and volatile attributes on top of the modifiers
+        case ELeafKind::Pointer: {
+            FPointerRecord PointerRecord{};
+            if (!DecodePointerRecord(Type.Record, PointerRecord)) {
+                return false;
+            }
+            const EPointerMode PointerMode = PointerRecord.GetMode();
+            OutInfo.Tag = ESymbolTag::PointerType;
+            OutInfo.Type = MakeTypeHandle(PointerRecord.ReferentType);
+            OutInfo.bIsReference = PointerMode == EPointerMode::LValueReference || PointerMode == EPointerMode::RValueReference;
+            OutInfo.bIsConst |= PointerRecord.IsConst();
+            OutInfo.bIsVolatile |= PointerRecord.IsVolatile();
+            return true;
+        }
+        ///Arrays only record their size in bytes, so the element count is derived from the size of the element
+        case ELeafKind::Array: {
+            FArrayRecord ArrayRecord{};
+            if (!DecodeArrayRecord(Type.Record, ArrayRecord)) {
+                return false;
+            }
+            const uint64_t ElementSize = GetTypeSize(Session, ArrayRecord.ElementType);
+            OutInfo.Tag = ESymbolTag::ArrayType;
+            OutInfo.Type = MakeTypeHandle(ArrayRecord.ElementType);
+            OutInfo.Count = ElementSize != 0 ? static_cast<uint32_t>(ArrayRecord.Size / ElementSize) : 0;
+            return true;
+        }
+        case ELeafKind::Enum:
+            OutInfo.Tag = ESymbolTag::Enum;
+            return true;
+        case ELeafKind::Class:
+        case ELeafKind::Structure:
+        case ELeafKind::Union:
+        case ELeafKind::Interface: {
+            FTagRecord TagRecord{};
+            if (!DecodeTagRecord(Type.Record, TagRecord)) {
+                return false;
+            }
+            uint16_t VirtualTableEntriesCount = 0;
+            if (TagRecord.VTableShape != 0 && DecodeVTableShapeRecord(Session.GetTypeStream().GetRecord(TagRecord.VTableShape), VirtualTableEntriesCount)) {
+                OutInfo.Count = VirtualTableEntriesCount;
+            }
+            OutInfo.Tag = ESymbolTag::UDT;
+            OutInfo.UDTKind = ConvertUserDefinedTypeKind(TagRecord.Kind);
+            OutInfo.bHasConstructor = (TagRecord.Options & CO_HasConstructorOrDestructor) != 0;
+            return true;
+        }
+        ///Function signature types. The class of the member functions is the type the this pointer points to, so its constness is the constness of the function
+        case ELeafKind::Procedure:
+        case ELeafKind::MemberFunction: {
+            FProcedureRecord ProcedureRecord{};
+            if (!DecodeProcedureRecord(Type.Record, ProcedureRecord)) {
+                return false;
+            }
+            OutInfo.Tag = ESymbolTag::FunctionType;
+            OutInfo.Type = ProcedureRecord.ReturnType != STK_None ? MakeTypeHandle(ProcedureRecord.ReturnType) : FSymbolHandle{};
+
+            if (Type.Record.Kind == ELeafKind::MemberFunction) {
+                const FResolvedType ThisType = ResolveType(Session, ProcedureRecord.ThisType);
+                FPointerRecord ThisPointerRecord{};
+                const bool bHasThisPointer = ProcedureRecord.ThisType != 0 && !ThisType.IsSimpleType() && DecodePointerRecord(ThisType.Record, ThisPointerRecord);
+                OutInfo.ClassParent = MakeTypeHandle(bHasThisPointer ? ThisPointerRecord.ReferentType : ProcedureRecord.ClassType);
+            }
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+bool FPDBSymbolSource::GetSymbolInfo(FSymbolHandle Symbol, FSymbolInfo& OutInfo) const {
+    OutInfo = FSymbolInfo{};
+    const EPDBHandleKind HandleKind = GetHandleKind(Symbol);
+
+    if (HandleKind == EPDBHandleKind::Type) {
+        return GetTypeInfo(GetHandleTypeIndex(Symbol), OutInfo);
+    }
+    ///Arguments of the function type. Variadic functions have the argument of no type as the last argument, which is left without a type
+    if (HandleKind == EPDBHandleKind::FunctionArgument) {
+        FProcedureRecord ProcedureRecord{};
+        FArgumentListRecord ArgumentList{};
+        const uint32_t ArgumentIndex = static_cast<uint32_t>(GetHandleMemberIndex(Symbol));
+        if (!DecodeProcedureRecord(Session.GetTypeStream().GetRecord(GetHandleTypeIndex(Symbol)), ProcedureRecord) ||
+            !DecodeArgumentListRecord(Session.GetTypeStream().GetRecord(ProcedureRecord.ArgumentList), ArgumentList) || ArgumentIndex >= ArgumentList.ArgumentCount) {
+            return false;
+        }
+        const uint32_t ArgumentType = ArgumentList.GetArgumentType(ArgumentIndex);
+        OutInfo.Tag = ESymbolTag::FunctionArgType;
+        OutInfo.Type = ArgumentType != STK_None ? MakeTypeHandle(ArgumentType) : FSymbolHandle{};
+        return true;
+    }
+
+    const FPDBMember* Member = FindMember(Symbol);
+    if (Member == nullptr) {
+        return false;
+    }
+    OutInfo.Access = ConvertFieldAccess(Member->Attributes);
+    OutInfo.bIsCompilerGenerated = Member->Attributes.IsCompilerGenerated();
+    OutInfo.Type = MakeTypeHandle(Member->Type);
+
+    switch (HandleKind) {
+        ///Base classes of the user defined type. Virtual bases have no fixed offset in the object
+        case EPDBHandleKind::BaseClass: {
+            FTagRecord BaseClassRecord{};
+            if (!DecodeTagRecord(ResolveType(Session, Member->Type).Record, BaseClassRecord)) {
+                return false;
+            }
+            OutInfo.Tag = ESymbolTag::BaseClass;
+            OutInfo.Offset = Member->Kind == ELeafKind::BaseClass ? static_cast<int32_t>(Member->Offset) : 0;
+            OutInfo.Length = BaseClassRecord.Size;
+            OutInfo.bIsVirtual = Member->Kind == ELeafKind::VirtualBaseClass;
+            OutInfo.bHasConstructor = (BaseClassRecord.Options & CO_HasConstructorOrDestructor) != 0;
+            return true;
+        }
+        ///Member variables. Bitfields have bit position and length in bits, and the type of the storage unit
+        case EPDBHandleKind::DataMember: {
+            OutInfo.Tag = ESymbolTag::Data;
+            if (Member->Kind == ELeafKind::StaticMember) {
+                OutInfo.bIsStatic = true;
+                return true;
+            }
+            OutInfo.Offset = static_cast<int32_t>(Member->Offset);
+
+            const FResolvedType VariableType = ResolveType(Session, Member->Type);
+            FBitFieldRecord BitFieldRecord{};
+            if (!VariableType.IsSimpleType() && DecodeBitFieldRecord(VariableType.Record, BitFieldRecord)) {
+                OutInfo.Location = EDataLocation::BitField;
+                OutInfo.Type = MakeTypeHandle(BitFieldRecord.Type);
+                OutInfo.Length = BitFieldRecord.BitLength;
+                OutInfo.BitPosition = BitFieldRecord.BitPosition;
+            } else {
+                OutInfo.Location = EDataLocation::ThisRelative;
+                OutInfo.Length = GetTypeSize(Session, Member->Type);
+            }
+            return true;
+        }
+        case EPDBHandleKind::Function:
+            OutInfo.Tag = ESymbolTag::Function;
+            OutInfo.VirtualBaseOffset = static_cast<int32_t>(Member->VirtualTableOffset);
+            OutInfo.bIsVirtual = Member->Attributes.IsVirtual();
+            OutInfo.bIsIntroVirtual = Member->Attributes.IsIntroducingVirtual();
+            OutInfo.bIsPureVirtual = Member->Attributes.IsPureVirtual();
+            OutInfo.bIsStatic = Member->Attributes.IsStatic();
+            OutInfo.bIsConst = IsConstMemberFunction(Member->Type);
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::string FPDBSymbolSource::GetSymbolName(FSymbolHandle Symbol) const {
+    switch (GetHandleKind(Symbol)) {
+        ///Only the tag types are named, the rest of the types are spelled out by the generator
+        case EPDBHandleKind::Type: {
+            const FResolvedType Type = ResolveType(Session, GetHandleTypeIndex(Symbol));
+            FTagRecord TagRecord{};
+            return !Type.IsSimpleType() && DecodeTagRecord(Type.Record, TagRecord) ? std::string{TagRecord.Name} : std::string{};
+        }
+        case EPDBHandleKind::BaseClass: {
+            const FPDBMember* Member = FindMember(Symbol);
+            return Member != nullptr ? GetSymbolName(MakeTypeHandle(Member->Type)) : std::string{};
+        }
+        case EPDBHandleKind::DataMember:
+        case EPDBHandleKind::Function: {
+            const FPDBMember* Member = FindMember(Symbol);
+            return Member != nullptr ? std::string{Member->Name} : std::string{};
+        }
+        default:
+            return std::string{};
+    }
+}
+
+void FPDBSymbolSource::GetChildren(FSymbolHandle Symbol, ESymbolTag ChildTag, std::vector<FSymbolHandle>& OutChildren) const {
+    if (GetHandleKind(Symbol) != EPDBHandleKind::Type) {
+        return;
+    }
+    const FResolvedType Type = ResolveType(Session, GetHandleTypeIndex(Symbol));
+    if (Type.IsSimpleType()) {
+        return;
+    }
+
+    if (IsFunctionTypeKind(Type.Record.Kind) && ChildTag == ESymbolTag::FunctionArgType) {
+        FProcedureRecord ProcedureRecord{};
+        FArgumentListRecord ArgumentList{};
+        if (DecodeProcedureRecord(Type.Record, ProcedureRecord) && DecodeArgumentListRecord(Session.GetTypeStream().GetRecord(ProcedureRecord.ArgumentList), ArgumentList)) {
+            for (uint32_t i = 0; i < ArgumentList.ArgumentCount; i++) {
+                OutChildren.push_back(MakeMemberHandle(EPDBHandleKind::FunctionArgument, Type.TypeIndex, i));
+            }
+        }
+        return;
+    }
+    if (!IsUserDefinedTypeKind(Type.Record.Kind)) {
+        return;
+    }
+
+    const FPDBTypeMembers& Members = GetTypeMembers(Type.TypeIndex);
+    const auto AddMemberHandles = [&](EPDBHandleKind Kind, const std::vector<FPDBMember>& MemberList) {
+        for (size_t i = 0; i < MemberList.size(); i++) {
+            OutChildren.push_back(MakeMemberHandle(Kind, Type.TypeIndex, i));
+        }
+    };
+    if (ChildTag == ESymbolTag::BaseClass) {
+        AddMemberHandles(EPDBHandleKind::BaseClass, Members.BaseClasses);
+    } else if (ChildTag == ESymbolTag::Data) {
+        AddMemberHandles(EPDBHandleKind::DataMember, Members.DataMembers);
+    } else if (ChildTag == ESymbolTag::Function) {
+        AddMemberHandles(EPDBHandleKind::Function, Members.Functions);
+    }
+}
+
+bool FPDBSymbolSource::GetSourceLine(FSymbolHandle Symbol, std::string& OutSourceFilePath, int32_t& OutLineNumber) const {
+    if (GetHandleKind(Symbol) != EPDBHandleKind::Type) {
+        return false;
+    }
+    ///Source lines are recorded against the type index of the definition, which is what the forward reference has been resolved to
+    const FUDTSourceLine* SourceLine = Session.GetSourceLineIndex().Find(ResolveType(Session, GetHandleTypeIndex(Symbol)).TypeIndex);
+    if (SourceLine == nullptr) {
+        return false;
+    }
+    OutSourceFilePath = SourceLine->SourceFile;
+    OutLineNumber = static_cast<int32_t>(SourceLine->LineNumber);
+    return true;
+}
+
+///Finds the virtual table offset of the introducing virtual function the function with the given name and arguments overrides
+///Only the bases at offset 0 are searched, as only their functions share the primary virtual table with the derived class
+bool FPDBSymbolSource::FindOverriddenVirtualTableOffset(uint32_t ClassTypeIndex, std::string_view FunctionName, uint32_t ArgumentList, uint32_t& OutVirtualTableOffset) const {
+    const FResolvedType ClassType = ResolveType(Session, ClassTypeIndex);
+    if (ClassType.IsSimpleType() || !IsUserDefinedTypeKind(ClassType.Record.Kind)) {
+        return false;
+    }
+    const FPDBTypeMembers& Members = GetTypeMembers(ClassType.TypeIndex);
+
+    for (const FPDBMember& BaseClass : Members.BaseClasses) {
+        if (BaseClass.Kind == ELeafKind::BaseClass && BaseClass.Offset == 0 &&
+            FindOverriddenVirtualTableOffset(BaseClass.Type, FunctionName, ArgumentList, OutVirtualTableOffset)) {
+            return true;
+        }
+    }
+    for (const FPDBMember& Function : Members.Functions) {
+        FProcedureRecord ProcedureRecord{};
+        if (Function.Name == FunctionName && Function.Attributes.IsIntroducingVirtual() &&
+            DecodeProcedureRecord(Session.GetTypeStream().GetRecord(Function.Type), ProcedureRecord) && ProcedureRecord.ArgumentList == ArgumentList) {
+            OutVirtualTableOffset = Function.VirtualTableOffset;
+            return true;
+        }
+    }
+    return false;
+}
+
+///Returns the RVA of the function with the given qualified name. Overloads are told apart by the function type
+uint32_t FPDBSymbolSource::FindFunctionRVA(const std::string& QualifiedName, uint32_t FunctionType) const {
+    const std::span<const FProcedureEntry> Procedures = Session.GetSymbolTable().FindProcedures(QualifiedName);
+    for (const FProcedureEntry& Procedure : Procedures) {
+        if (Procedure.FunctionType == FunctionType) {
+            return Procedure.RelativeVirtualAddress;
+        }
+    }
+    return Procedures.size() == 1 ? Procedures[0].RelativeVirtualAddress : 0;
+}
+
+void FPDBSymbolSource::AddVirtualFunctionRVA(uint32_t ClassTypeIndex, std::string_view ClassName, const FPDBMember& Function, FVirtualTableRVALayout& OutLayout) const {
+    FProcedureRecord ProcedureRecord{};
+    if (!Function.Attributes.IsVirtual() || !DecodeProcedureRecord(Session.GetTypeStream().GetRecord(Function.Type), ProcedureRecord)) {
+        return;
+    }
+
+    ///Only the introducing virtual functions have the slot recorded, overrides inherit it from the function they override
+    uint32_t VirtualTableOffset = Function.VirtualTableOffset;
+    if (!Function.Attributes.IsIntroducingVirtual()) {
+        bool bFoundOverriddenFunction = false;
+        for (const FPDBMember& BaseClass : GetTypeMembers(ClassTypeIndex).BaseClasses) {
+            if (!bFoundOverriddenFunction && BaseClass.Kind == ELeafKind::BaseClass && BaseClass.Offset == 0) {
+                bFoundOverriddenFunction = FindOverriddenVirtualTableOffset(BaseClass.Type, Function.Name, ProcedureRecord.ArgumentList, VirtualTableOffset);
+            }
+        }
+        if (!bFoundOverriddenFunction) {
+            return;
+        }
+    }
+
+    ///Slots are pointer sized, and the size of the this pointer tells us the pointer size of the target
+    const uint64_t PointerSize = ProcedureRecord.ThisType != 0 ? GetTypeSize(Session, ProcedureRecord.ThisType) : 8;
+
+    std::string QualifiedName{ClassName};
+    QualifiedName.append("::");
+    QualifiedName.append(Function.Name);
+
+    FVirtualFunctionRVA FunctionRVA{};
+    FunctionRVA.VirtualTableSlot = static_cast<int32_t>(VirtualTableOffset / (PointerSize != 0 ? PointerSize : 8));
+    FunctionRVA.FunctionName = Function.Name;
+    FunctionRVA.FunctionRVA = Function.Attributes.IsPureVirtual() ? 0 : FindFunctionRVA(QualifiedName, Function.Type);
+    OutLayout.VirtualFunctions.push_back(FunctionRVA);
+}
+
+bool FPDBSymbolSource::GenerateVirtualTableRVALayout(FSymbolHandle UDTSymbol, FVirtualTableRVALayout& OutLayout) const {
+    ///Without the section headers every RVA would come out as zero, so no RVA layout is better than a layout full of zeroes
+    if (!Session.HasSymbolRVAs() || GetHandleKind(UDTSymbol) != EPDBHandleKind::Type) {
+        return false;
+    }
+    const FResolvedType UDTType = ResolveType(Session, GetHandleTypeIndex(UDTSymbol));
+    FTagRecord UDTRecord{};
+    if (UDTType.IsSimpleType() || !DecodeTagRecord(UDTType.Record, UDTRecord)) {
+        return false;
+    }
+    ///Classes without a virtual table, or whose vftable symbol has been stripped, do not get the RVA layout either
+    const uint32_t VirtualTableRVA = Session.GetSymbolTable().FindVirtualTableRVA(UDTRecord.Name);
+    if (VirtualTableRVA == 0) {
+        return false;
+    }
+    OutLayout.ClassName = UDTRecord.Name;
+    OutLayout.VirtualTableRVA = VirtualTableRVA;
+
+    for (const FPDBMember& Function : GetTypeMembers(UDTType.TypeIndex).Functions) {
+        AddVirtualFunctionRVA(UDTType.TypeIndex, UDTRecord.Name, Function, OutLayout);
+    }
+
+    std::stable_sort(OutLayout.VirtualFunctions.begin(), OutLayout.VirtualFunctions.end(), [](const FVirtualFunctionRVA& A, const FVirtualFunctionRVA& B) {
+        return A.VirtualTableSlot < B.VirtualTableSlot;
+    });
+
+    ///Constructors are named after the innermost name of the class, e.g. Outer::Inner::Inner
+    const size_t InnermostNameStart = UDTRecord.Name.rfind("::");
+    std::string ConstructorName{UDTRecord.Name};
+    ConstructorName.append("::");
+    ConstructorName.append(InnermostNameStart == std::string_view::npos ? UDTRecord.Name : UDTRecord.Name.substr(InnermostNameStart + 2));
+
+    for (const FProcedureEntry& Constructor : Session.GetSymbolTable().FindProcedures(ConstructorName)) {
+        OutLayout.ConstructorRVAs.push_back(Constructor.RelativeVirtualAddress);
+    }
+    return true;
+}
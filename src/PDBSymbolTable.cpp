@@ -0,0 +1,123 @@
+#include "PDBSymbolTable.h"
+#include "CodeView.h"
+#include "ParallelFor.h"
+#include <algorithm>
+
+///Module symbol streams start with the CV_SIGNATURE_C13 signature, followed by the symbol records
+static constexpr size_t ModuleSymbolSignatureSize = sizeof(uint32_t);
+
+///Prefix of the decorated names of the virtual tables
+static constexpr std::string_view VirtualTableSymbolPrefix = "??_7";
+
+///Compares the entries sorted by name against the plain names, for the binary searches over the sorted tables
+struct FSymbolNameLess {
+    template<typename T>
+    inline bool operator()(const T& Entry, std::string_view Name) const {
+        return Entry.Name < Name;
+    }
+    template<typename T>
+    inline bool operator()(std::string_view Name, const T& Entry) const {
+        return Name < Entry.Name;
+    }
+};
+
+std::string MakeVirtualTableSymbolName(std::string_view ClassName) {
+    std::vector<std::string_view> NameFragments;
+    for (size_t FragmentStart = 0;;) {
+        const size_t Separator = ClassName.find("::", FragmentStart);
+        NameFragments.push_back(ClassName.substr(FragmentStart, Separator - FragmentStart));
+        if (Separator == std::string_view::npos) {
+            break;
+        }
+        FragmentStart = Separator + 2;
+    }
+
+    ///Name fragments are emitted starting from the innermost one, each terminated with @
+    std::string SymbolName{VirtualTableSymbolPrefix};
+    for (auto Iterator = NameFragments.rbegin(); Iterator != NameFragments.rend(); ++Iterator) {
+        SymbolName.append(*Iterator);
+        SymbolName.push_back('@');
+    }
+    ///Terminator of the qualified name, followed by the "const vftable, no base class path" storage class
+    SymbolName.append("@6B@");
+    return SymbolName;
+}
+
+void FPDBSymbolTable::Build(const FMSFFile& MSFFile, const FPDBDbiStream& InDbiStream, const FDumpLog& Log) {
+    DbiStream = &InDbiStream;
+    const std::vector<FDbiModuleInfo>& Modules = DbiStream->GetModules();
+    ModuleStreams.resize(Modules.size());
+
+    ///Every module writes only into its own slot, so the parallel pass needs no synchronization
+    std::vector<std::vector<FProcedureEntry>> ModuleProcedures(Modules.size());
+    ParallelFor(Modules.size(), [&](size_t ModuleIndex) {
+        CollectModuleProcedures(MSFFile, ModuleIndex, ModuleProcedures[ModuleIndex]);
+    });
+
+    size_t NumProcedures = 0;
+    for (const std::vector<FProcedureEntry>& Entries : ModuleProcedures) {
+        NumProcedures += Entries.size();
+    }
+    Procedures.reserve(NumProcedures);
+    for (const std::vector<FProcedureEntry>& Entries : ModuleProcedures) {
+        Procedures.insert(Procedures.end(), Entries.begin(), Entries.end());
+    }
+    std::sort(Procedures.begin(), Procedures.end(), [](const FProcedureEntry& A, const FProcedureEntry& B) {
+        return A.Name < B.Name || (A.Name == B.Name && A.RelativeVirtualAddress < B.RelativeVirtualAddress);
+    });
+
+    OpenPublicSymbols(MSFFile, Log);
+}
+
+void FPDBSymbolTable::CollectModuleProcedures(const FMSFFile& MSFFile, size_t ModuleIndex, std::vector<FProcedureEntry>& OutProcedures) {
+    const FDbiModuleInfo& Module = DbiStream->GetModules()[ModuleIndex];
+    FMSFStream& ModuleStream = ModuleStreams[ModuleIndex];
+
+    ///Modules without symbols, like the linker generated ones, do not have a stream
+    if (Module.ModuleSymbolStreamIndex == InvalidStreamIndex || Module.SymbolByteSize <= ModuleSymbolSignatureSize ||
+        !MSFFile.OpenStream(Module.ModuleSymbolStreamIndex, ModuleStream) || ModuleStream.GetSize() < Module.SymbolByteSize) {
+        return;
+    }
+
+    ///Module streams make up most of the large PDBs, so their pages are dropped once the procedures have been collected
+    ModuleStream.AdviseSequentialAccess();
+    const std::span<const uint8_t> SymbolData = ModuleStream.GetData().first(Module.SymbolByteSize);
+    size_t Position = ModuleSymbolSignatureSize;
+    FSymbolRecord Record{};
+
+    while (ReadSymbolRecord(SymbolData, Position, Record)) {
+        FProcedureSymbol ProcedureSymbol{};
+        if (DecodeProcedureSymbol(Record, ProcedureSymbol)) {
+            const uint32_t RelativeVirtualAddress = DbiStream->ConvertSectionOffsetToRVA(ProcedureSymbol.Section, ProcedureSymbol.Offset);
+            OutProcedures.push_back(FProcedureEntry{ProcedureSymbol.Name, ProcedureSymbol.FunctionType, RelativeVirtualAddress});
+        }
+    }
+    ModuleStream.ReleaseResidentPages();
+}
+
+void FPDBSymbolTable::OpenPublicSymbols(const FMSFFile& MSFFile, const FDumpLog& Log) {
+    const FDbiStreamHeader& Header = DbiStream->GetHeader();
+    if (Header.SymbolRecordStreamIndex == InvalidStreamIndex || !MSFFile.OpenStream(Header.SymbolRecordStreamIndex, SymbolRecordStream)) {
+        return;
+    }
+
+    ///Public symbols are optional, lookups simply fail if the PDB does not have them
+    PublicSymbols.Open(MSFFile, *DbiStream, SymbolRecordStream.GetData(), Log);
+}
+
+std::span<const FProcedureEntry> FPDBSymbolTable::FindProcedures(std::string_view QualifiedName) const {
+    const auto [RangeBegin, RangeEnd] = std::equal_range(Procedures.begin(), Procedures.end(), QualifiedName, FSymbolNameLess{});
+    return std::span<const FProcedureEntry>{RangeBegin, RangeEnd};
+}
+
+uint32_t FPDBSymbolTable::FindVirtualTableRVA(std::string_view ClassName) const {
+    return FindPublicSymbolRVA(MakeVirtualTableSymbolName(ClassName));
+}
+
+uint32_t FPDBSymbolTable::FindPublicSymbolRVA(std::string_view DecoratedName) const {
+    FPublicSymbol PublicSymbol{};
+    if (!PublicSymbols.FindSymbolByName(DecoratedName, PublicSymbol)) {
+        return 0;
+    }
+    return DbiStream->ConvertSectionOffsetToRVA(PublicSymbol.Section, PublicSymbol.Offset);
+}
@@ -0,0 +1,104 @@
+#include "PDBTypeNameIndex.h"
+#include "BinaryReader.h"
+#include "PDBHash.h"
+
+void FPDBTypeNameIndex::Build(const FPDBTypeStream& InTypeStream) {
+    TypeStream = &InTypeStream;
+    NumHashBuckets = 0;
+    BucketStarts.clear();
+    BucketTypeIndices.clear();
+
+    const FTypeStreamHeader& Header = InTypeStream.GetHeader();
+    const std::span<const uint8_t> HashData = InTypeStream.GetHashStream().GetData();
+    const uint32_t NumTypeRecords = InTypeStream.GetNumTypeRecords();
+    const uint64_t HashValuesEnd = static_cast<uint64_t>(Header.HashValueBufferOffset) + Header.HashValueBufferLength;
+
+    ///We can only use the hash values if there is exactly one 32-bit hash per record
+    if (Header.HashKeySize != sizeof(uint32_t) || Header.NumHashBuckets == 0 || Header.HashValueBufferOffset < 0 ||
+        HashValuesEnd > HashData.size() || Header.HashValueBufferLength != static_cast<uint64_t>(NumTypeRecords) * sizeof(uint32_t)) {
+        return;
+    }
+    const uint8_t* HashValues = HashData.data() + Header.HashValueBufferOffset;
+
+    ///Counting sort of the type indices by their bucket. Type indices inside of the bucket stay in ascending order
+    std::vector<uint32_t> BucketCounts(static_cast<size_t>(Header.NumHashBuckets) + 1, 0);
+    for (uint32_t i = 0; i < NumTypeRecords; i++) {
+        const uint32_t BucketIndex = ReadUnaligned<uint32_t>(HashValues + i * sizeof(uint32_t));
+        if (BucketIndex >= Header.NumHashBuckets) {
+            return;
+        }
+        BucketCounts[BucketIndex + 1]++;
+    }
+    for (uint32_t i = 0; i < Header.NumHashBuckets; i++) {
+        BucketCounts[i + 1] += BucketCounts[i];
+    }
+    BucketStarts = BucketCounts;
+    BucketTypeIndices.resize(NumTypeRecords);
+
+    for (uint32_t i = 0; i < NumTypeRecords; i++) {
+        const uint32_t BucketIndex = ReadUnaligned<uint32_t>(HashValues + i * sizeof(uint32_t));
+        BucketTypeIndices[BucketCounts[BucketIndex]++] = Header.TypeIndexBegin + i;
+    }
+    NumHashBuckets = Header.NumHashBuckets;
+}
+
+uint32_t FPDBTypeNameIndex::FindUserDefinedType(std::string_view TypeName) const {
+    if (TypeStream == nullptr) {
+        return 0;
+    }
+    ///Hash stream has been validated, so the type missing from its bucket has no definition. Types absent from the PDB are common, and are not worth a pass over the whole stream
+    if (NumHashBuckets != 0) {
+        return FindInHashBucket(TypeName);
+    }
+    std::call_once(FallbackIndexFlag, [this]() { BuildFallbackIndex(); });
+
+    auto Iterator = FallbackIndex.find(TypeName);
+    return Iterator != FallbackIndex.end() ? Iterator->second : 0;
+}
+
+bool FPDBTypeNameIndex::IsUserDefinedTypeRecord(const FTypeRecord& Record, FTagRecord& OutTagRecord) {
+    if (Record.Kind != ELeafKind::Class && Record.Kind != ELeafKind::Structure &&
+        Record.Kind != ELeafKind::Union && Record.Kind != ELeafKind::Interface) {
+        return false;
+    }
+    return DecodeTagRecord(Record, OutTagRecord);
+}
+
+uint32_t FPDBTypeNameIndex::FindInHashBucket(std::string_view TypeName) const {
+    if (NumHashBuckets == 0) {
+        return 0;
+    }
+    const uint32_t BucketIndex = HashStringV1(TypeName) % NumHashBuckets;
+
+    ///Forward declarations are hashed by their record contents, so any match we find here is a definition
+    for (uint32_t i = BucketStarts[BucketIndex]; i < BucketStarts[BucketIndex + 1]; i++) {
+        const uint32_t TypeIndex = BucketTypeIndices[i];
+        FTagRecord TagRecord{};
+
+        if (IsUserDefinedTypeRecord(TypeStream->GetRecord(TypeIndex), TagRecord) &&
+            !TagRecord.IsForwardReference() && TagRecord.Name == TypeName) {
+            return TypeIndex;
+        }
+    }
+    return 0;
+}
+
+void FPDBTypeNameIndex::BuildFallbackIndex() const {
+    TypeStream->BuildFullIndex();
+
+    for (uint32_t TypeIndex = TypeStream->GetTypeIndexBegin(); TypeIndex < TypeStream->GetTypeIndexEnd(); TypeIndex++) {
+        FTagRecord TagRecord{};
+        if (!IsUserDefinedTypeRecord(TypeStream->GetRecord(TypeIndex), TagRecord)) {
+            continue;
+        }
+        auto [Iterator, bInserted] = FallbackIndex.try_emplace(TagRecord.Name, TypeIndex);
+
+        ///Replace the forward declaration seen earlier with the definition
+        if (!bInserted && !TagRecord.IsForwardReference()) {
+            FTagRecord ExistingTagRecord{};
+            if (IsUserDefinedTypeRecord(TypeStream->GetRecord(Iterator->second), ExistingTagRecord) && ExistingTagRecord.IsForwardReference()) {
+                Iterator->second = TypeIndex;
+            }
+        }
+    }
+}
@@ -0,0 +1,163 @@
+#include "PDBTypeStream.h"
+#include "BinaryReader.h"
+#include "ParallelFor.h"
+#include "ThreadPool.h"
+#include <algorithm>
+
+///Marker for the record offsets that have not been decoded yet
+static constexpr uint32_t UndecodedRecordOffset = 0xFFFFFFFF;
+///Marker for the records that could not be decoded because the stream is malformed
+static constexpr uint32_t MalformedRecordOffset = 0xFFFFFFFE;
+
+///Supported version of the TPI stream, V80 is used by every MSVC since Visual Studio 2005
+static constexpr uint32_t TypeStreamVersionV80 = 20040203;
+
+bool FPDBTypeStream::Open(const FMSFFile& MSFFile, EPDBFixedStream StreamType, const FDumpLog& Log) {
+    if (!MSFFile.OpenStream(StreamType, Stream)) {
+        Log.Error(L"PDB file does not contain a type stream " + std::to_wstring(static_cast<uint32_t>(StreamType)));
+        return false;
+    }
+
+    const std::span<const uint8_t> StreamData = Stream.GetData();
+    FBinaryReader Reader{StreamData};
+    if (!Reader.Read(Header) || Header.Version != TypeStreamVersionV80 || Header.HeaderSize < sizeof(FTypeStreamHeader)) {
+        Log.Error(L"Unsupported type stream header in stream " + std::to_wstring(static_cast<uint32_t>(StreamType)));
+        return false;
+    }
+    if (Header.TypeIndexEnd < Header.TypeIndexBegin || static_cast<uint64_t>(Header.HeaderSize) + Header.TypeRecordBytes > StreamData.size()) {
+        Log.Error(L"Type stream " + std::to_wstring(static_cast<uint32_t>(StreamType)) + L" is truncated");
+        return false;
+    }
+    RecordData = StreamData.subspan(Header.HeaderSize, Header.TypeRecordBytes);
+
+    ///The hash stream is optional. Without it the whole stream is a single chunk decoded in one go
+    if (Header.HashStreamIndex != InvalidStreamIndex && MSFFile.OpenStream(Header.HashStreamIndex, HashStream)) {
+        const std::span<const uint8_t> HashData = HashStream.GetData();
+        const uint64_t BufferEnd = static_cast<uint64_t>(Header.IndexOffsetBufferOffset) + Header.IndexOffsetBufferLength;
+
+        if (Header.IndexOffsetBufferOffset >= 0 && BufferEnd <= HashData.size()) {
+            const size_t NumEntries = Header.IndexOffsetBufferLength / sizeof(FTypeIndexOffset);
+            Chunks.resize(NumEntries);
+            memcpy(Chunks.data(), HashData.data() + Header.IndexOffsetBufferOffset, NumEntries * sizeof(FTypeIndexOffset));
+        }
+    }
+
+    ///Drop the entries that do not make sense, so that the chunk lookup can rely on both arrays being sorted
+    std::erase_if(Chunks, [&](const FTypeIndexOffset& Entry) {
+        return !IsValidTypeIndex(Entry.TypeIndex) || Entry.Offset >= RecordData.size();
+    });
+    const bool bChunksAreSorted = std::is_sorted(Chunks.begin(), Chunks.end(), [](const FTypeIndexOffset& A, const FTypeIndexOffset& B) {
+        return A.TypeIndex < B.TypeIndex || (A.TypeIndex == B.TypeIndex && A.Offset < B.Offset);
+    });
+    if (!bChunksAreSorted) {
+        Chunks.clear();
+    }
+    if (Chunks.empty() || Chunks[0].TypeIndex != Header.TypeIndexBegin) {
+        Chunks.insert(Chunks.begin(), FTypeIndexOffset{Header.TypeIndexBegin, 0});
+    }
+
+    const uint32_t NumTypeRecords = GetNumTypeRecords();
+    RecordOffsets = std::make_unique<std::atomic<uint32_t>[]>(NumTypeRecords);
+    for (uint32_t i = 0; i < NumTypeRecords; i++) {
+        RecordOffsets[i].store(UndecodedRecordOffset, std::memory_order_relaxed);
+    }
+    ChunkDecodeFlags = std::make_unique<std::once_flag[]>(Chunks.size());
+    ChunkValidFlags = std::make_unique<bool[]>(Chunks.size());
+    return true;
+}
+
+FTypeRecord FPDBTypeStream::GetRecord(uint32_t TypeIndex) const {
+    if (!IsValidTypeIndex(TypeIndex)) {
+        return FTypeRecord{};
+    }
+    std::atomic<uint32_t>& RecordOffset = RecordOffsets[TypeIndex - Header.TypeIndexBegin];
+    uint32_t Offset = RecordOffset.load(std::memory_order_acquire);
+
+    if (Offset == UndecodedRecordOffset) {
+        DecodeChunkOnce(FindChunkForTypeIndex(TypeIndex));
+        Offset = RecordOffset.load(std::memory_order_acquire);
+    }
+    if (Offset == UndecodedRecordOffset || Offset == MalformedRecordOffset) {
+        return FTypeRecord{};
+    }
+    return GetRecordAtOffset(Offset);
+}
+
+bool FPDBTypeStream::BuildFullIndex() const {
+    return BuildFullIndex(FThreadPool::Get());
+}
+
+bool FPDBTypeStream::BuildFullIndex(FThreadPool& ThreadPool) const {
+    ParallelFor(ThreadPool, Chunks.size(), [this](size_t ChunkIndex) { DecodeChunkOnce(ChunkIndex); });
+
+    for (size_t ChunkIndex = 0; ChunkIndex < Chunks.size(); ChunkIndex++) {
+        if (!ChunkValidFlags[ChunkIndex]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FPDBTypeStream::GetChunkTypeIndexRange(size_t ChunkIndex, uint32_t& OutTypeIndexBegin, uint32_t& OutTypeIndexEnd) const {
+    OutTypeIndexBegin = Chunks[ChunkIndex].TypeIndex;
+    OutTypeIndexEnd = ChunkIndex + 1 < Chunks.size() ? Chunks[ChunkIndex + 1].TypeIndex : Header.TypeIndexEnd;
+}
+
+size_t FPDBTypeStream::FindChunkForTypeIndex(uint32_t TypeIndex) const {
+    ///Find the last chunk starting at or before the given type index
+    auto ChunkIterator = std::upper_bound(Chunks.begin(), Chunks.end(), TypeIndex, [](uint32_t Value, const FTypeIndexOffset& Entry) {
+        return Value < Entry.TypeIndex;
+    });
+    return static_cast<size_t>(ChunkIterator - Chunks.begin()) - 1;
+}
+
+void FPDBTypeStream::DecodeChunkOnce(size_t ChunkIndex) const {
+    ///Flags are written inside of call_once, so every thread that went through it observes the final value
+    std::call_once(ChunkDecodeFlags[ChunkIndex], [this, ChunkIndex]() {
+        ChunkValidFlags[ChunkIndex] = DecodeChunk(ChunkIndex);
+    });
+}
+
+bool FPDBTypeStream::DecodeChunk(size_t ChunkIndex) const {
+    uint32_t FirstTypeIndex = 0;
+    uint32_t LastTypeIndex = 0;
+    GetChunkTypeIndexRange(ChunkIndex, FirstTypeIndex, LastTypeIndex);
+    uint32_t CurrentOffset = Chunks[ChunkIndex].Offset;
+    bool bChunkIsValid = true;
+
+    ///Records must not cross into the next chunk, as its records are decoded from its own offset. The record crossing it and the rest of the chunk are malformed
+    const uint64_t ChunkEndOffset = ChunkIndex + 1 < Chunks.size() ? Chunks[ChunkIndex + 1].Offset : RecordData.size();
+
+    for (uint32_t TypeIndex = FirstTypeIndex; TypeIndex < LastTypeIndex; TypeIndex++) {
+        std::atomic<uint32_t>& RecordOffset = RecordOffsets[TypeIndex - Header.TypeIndexBegin];
+
+        ///Every record is prefixed with its length, which does not include the length field itself
+        if (static_cast<uint64_t>(CurrentOffset) + sizeof(uint16_t) * 2 > ChunkEndOffset) {
+            RecordOffset.store(MalformedRecordOffset, std::memory_order_release);
+            bChunkIsValid = false;
+            continue;
+        }
+        const uint16_t RecordLength = ReadUnaligned<uint16_t>(RecordData.data() + CurrentOffset);
+        if (RecordLength < sizeof(uint16_t) || static_cast<uint64_t>(CurrentOffset) + sizeof(uint16_t) + RecordLength > ChunkEndOffset) {
+            RecordOffset.store(MalformedRecordOffset, std::memory_order_release);
+            CurrentOffset = static_cast<uint32_t>(ChunkEndOffset);
+            bChunkIsValid = false;
+            continue;
+        }
+        RecordOffset.store(CurrentOffset, std::memory_order_release);
+        CurrentOffset += sizeof(uint16_t) + RecordLength;
+    }
+
+    ///The last record of the chunk must end exactly where the next chunk begins
+    return bChunkIsValid && CurrentOffset == ChunkEndOffset;
+}
+
+FTypeRecord FPDBTypeStream::GetRecordAtOffset(uint32_t Offset) const {
+    const uint8_t* RecordStart = RecordData.data() + Offset;
+    const uint16_t RecordLength = ReadUnaligned<uint16_t>(RecordStart);
+
+    FTypeRecord Record{};
+    Record.Kind = static_cast<ELeafKind>(ReadUnaligned<uint16_t>(RecordStart + sizeof(uint16_t)));
+    Record.Data = std::span<const uint8_t>{RecordStart + sizeof(uint16_t) * 2, static_cast<size_t>(RecordLength - sizeof(uint16_t))};
+    return Record;
+}
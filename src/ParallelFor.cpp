@@ -0,0 +1,19 @@
+#include "ParallelFor.h"
+#include "ThreadPool.h"
+
+void ParallelFor(size_t NumTasks, const std::function<void(size_t)>& Task) {
+    ParallelFor(FThreadPool::Get(), NumTasks, Task);
+}
+
+void ParallelFor(FThreadPool& ThreadPool, size_t NumTasks, const std::function<void(size_t)>& Task) {
+    if (NumTasks == 1) {
+        Task(0);
+        return;
+    }
+    FTaskGroup TaskGroup;
+
+    for (size_t TaskIndex = 0; TaskIndex < NumTasks; TaskIndex++) {
+        ThreadPool.Submit(TaskGroup, [&Task, TaskIndex]() { Task(TaskIndex); });
+    }
+    ThreadPool.Wait(TaskGroup);
+}
@@ -0,0 +1,120 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+///Pool and worker index of the current thread, used to push the nested tasks into the queue of the worker submitting them
+static thread_local FThreadPool* CurrentThreadPool = nullptr;
+static thread_local size_t CurrentWorkerIndex = 0;
+
+FThreadPool::FThreadPool(size_t NumThreads) {
+    NumThreads = std::max<size_t>(NumThreads, 1);
+    WorkerQueues.reserve(NumThreads);
+    for (size_t i = 0; i < NumThreads; i++) {
+        WorkerQueues.push_back(std::make_unique<FWorkerQueue>());
+    }
+    WorkerThreads.reserve(NumThreads);
+    for (size_t i = 0; i < NumThreads; i++) {
+        WorkerThreads.emplace_back([this, i]() { WorkerMain(i); });
+    }
+}
+
+FThreadPool::~FThreadPool() {
+    {
+        std::lock_guard Lock{WakeUpMutex};
+        bShuttingDown = true;
+    }
+    WakeUpCondition.notify_all();
+    for (std::thread& WorkerThread : WorkerThreads) {
+        WorkerThread.join();
+    }
+}
+
+FThreadPool& FThreadPool::Get() {
+    static FThreadPool SharedThreadPool{std::max(1u, std::thread::hardware_concurrency())};
+    return SharedThreadPool;
+}
+
+void FThreadPool::Submit(FTaskGroup& TaskGroup, std::function<void()> Task) {
+    TaskGroup.NumPendingTasks.fetch_add(1, std::memory_order_relaxed);
+
+    auto GroupTask = [this, &TaskGroup, Task = std::move(Task)]() {
+        Task();
+        if (TaskGroup.NumPendingTasks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            ///Last task of the group, wake up whoever is waiting for it
+            std::lock_guard Lock{WakeUpMutex};
+            WakeUpCondition.notify_all();
+        }
+    };
+
+    ///Workers push to their own queue so the nested tasks stay on the same core unless somebody steals them
+    const size_t QueueIndex = CurrentThreadPool == this ? CurrentWorkerIndex : NextSubmitQueue++ % WorkerQueues.size();
+    {
+        FWorkerQueue& Queue = *WorkerQueues[QueueIndex];
+        std::lock_guard Lock{Queue.QueueMutex};
+        Queue.Tasks.push_back(std::move(GroupTask));
+    }
+    NumQueuedTasks.fetch_add(1, std::memory_order_release);
+    {
+        std::lock_guard Lock{WakeUpMutex};
+    }
+    WakeUpCondition.notify_one();
+}
+
+void FThreadPool::Wait(FTaskGroup& TaskGroup) {
+    const size_t PreferredQueueIndex = CurrentThreadPool == this ? CurrentWorkerIndex : 0;
+
+    while (!TaskGroup.IsDone()) {
+        if (TryRunQueuedTask(PreferredQueueIndex)) {
+            continue;
+        }
+        ///Nothing to help with, the remaining tasks of the group are running on the other threads
+        std::unique_lock Lock{WakeUpMutex};
+        WakeUpCondition.wait(Lock, [&]() {
+            return TaskGroup.IsDone() || NumQueuedTasks.load(std::memory_order_acquire) != 0;
+        });
+    }
+}
+
+void FThreadPool::WorkerMain(size_t WorkerIndex) {
+    CurrentThreadPool = this;
+    CurrentWorkerIndex = WorkerIndex;
+
+    while (true) {
+        if (TryRunQueuedTask(WorkerIndex)) {
+            continue;
+        }
+        std::unique_lock Lock{WakeUpMutex};
+        WakeUpCondition.wait(Lock, [&]() {
+            return bShuttingDown.load() || NumQueuedTasks.load(std::memory_order_acquire) != 0;
+        });
+        if (bShuttingDown && NumQueuedTasks.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
+
+bool FThreadPool::TryRunQueuedTask(size_t PreferredQueueIndex) {
+    std::function<void()> Task;
+    const size_t NumQueues = WorkerQueues.size();
+
+    ///Newest task from our own queue first, then the oldest tasks from the queues of the other workers
+    for (size_t i = 0; i < NumQueues && !Task; i++) {
+        FWorkerQueue& Queue = *WorkerQueues[(PreferredQueueIndex + i) % NumQueues];
+        std::lock_guard Lock{Queue.QueueMutex};
+        if (Queue.Tasks.empty()) {
+            continue;
+        }
+        if (i == 0) {
+            Task = std::move(Queue.Tasks.back());
+            Queue.Tasks.pop_back();
+        } else {
+            Task = std::move(Queue.Tasks.front());
+            Queue.Tasks.pop_front();
+        }
+    }
+    if (!Task) {
+        return false;
+    }
+    NumQueuedTasks.fetch_sub(1, std::memory_order_acq_rel);
+    Task();
+    return true;
+}
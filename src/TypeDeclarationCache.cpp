@@ -0,0 +1,31 @@
+#include "TypeDeclarationCache.h"
+#include <mutex>
+
+const FCachedTypeDeclaration& FTypeDeclarationCache::FindOrAddDeclaration(uint64_t TypeId, const std::function<void(FCachedTypeDeclaration&)>& GenerateDeclaration) {
+    {
+        std::shared_lock Lock{DeclarationsLock};
+        const auto DeclarationIterator = Declarations.find(TypeId);
+        if (DeclarationIterator != Declarations.end()) {
+            return DeclarationIterator->second;
+        }
+    }
+    FCachedTypeDeclaration NewDeclaration{};
+    GenerateDeclaration(NewDeclaration);
+
+    std::unique_lock Lock{DeclarationsLock};
+    return Declarations.try_emplace(TypeId, std::move(NewDeclaration)).first->second;
+}
+
+const std::string& FTypeDeclarationCache::FindOrAddDefaultValue(uint64_t TypeId, const std::function<std::string()>& GenerateDefaultValue) {
+    {
+        std::shared_lock Lock{DefaultValuesLock};
+        const auto DefaultValueIterator = DefaultValues.find(TypeId);
+        if (DefaultValueIterator != DefaultValues.end()) {
+            return DefaultValueIterator->second;
+        }
+    }
+    std::string NewDefaultValue = GenerateDefaultValue();
+
+    std::unique_lock Lock{DefaultValuesLock};
+    return DefaultValues.try_emplace(TypeId, std::move(NewDefaultValue)).first->second;
+}
@@ -1,55 +1,27 @@
 #include <string>
-#include <fstream>
-#include <Windows.h>
-#include <Psapi.h>
-#include <atlbase.h>
-#include <dia2.h>
+#include <filesystem>
 #include <vector>
-#include <ImageHlp.h>
 #include <sstream>
 #include <iostream>
 #include <assert.h>
-
-std::wstring PrintfVarargs(const wchar_t* Fmt, va_list varargs) {
-    size_t CurrentBufferSize = 1024;
-    auto* CharacterBuffer = (wchar_t*) malloc(sizeof(wchar_t) * CurrentBufferSize);
-
-    ///Resize the buffer and try again as long as the function says we don't have enough space
-    while (_vsnwprintf_s(CharacterBuffer, CurrentBufferSize, CurrentBufferSize, Fmt, varargs) == -1) {
-        CurrentBufferSize = CurrentBufferSize * 2;
-        CharacterBuffer = (wchar_t*) realloc(CharacterBuffer, sizeof(wchar_t) * CurrentBufferSize);
-    }
-
-    std::wstring ResultString = CharacterBuffer;
-    free(CharacterBuffer);
-
-    return ResultString;
-}
-
-std::wstring Printf(const wchar_t* Fmt, ...) {
-    va_list varargs;
-    va_start(varargs, Fmt);
-    std::wstring Result = PrintfVarargs(Fmt, varargs);
-    va_end(varargs);
-    return Result;
-}
+#include "Format.h"
+#include "Platform.h"
+#include "TypeLayoutGenerator.h"
 
 class FGeneratedFile {
 private:
-    std::wstring FileName;
-    std::wstring OutputFilePath;
-    std::wstring FileOutputBuffer;
+    std::string FileName;
+    std::string FileOutputBuffer;
     bool bAutoEmitNewline;
     int IndentationLevel;
 public:
-    explicit FGeneratedFile(const std::wstring& OutputDirectory, const std::wstring& InFileName) {
+    explicit FGeneratedFile(const std::string& InFileName) {
         this->FileName = InFileName;
-        this->OutputFilePath = Printf(TEXT("%s/%s.h"), OutputDirectory.c_str(), InFileName.c_str());
         this->bAutoEmitNewline = true;
         this->IndentationLevel = 0;
     }
 
-    FORCEINLINE const std::wstring& GetFileName() const {
+    FORCEINLINE const std::string& GetFileName() const {
         return FileName;
     }
 
@@ -65,436 +37,334 @@ public:
         this->bAutoEmitNewline = bNewAutoEmitNewline;
     }
 
-    FORCEINLINE void Logf(const wchar_t* Fmt, ...) {
-        va_list varargs;
-        va_start(varargs, Fmt);
-
+    ///Formats the line straight into the output buffer, so emitting it does not allocate anything once the buffer has grown
+    template<typename... ArgTypes>
+    void Logf(TFormatString<std::type_identity_t<ArgTypes>...> Format, const ArgTypes&... Arguments) {
         if (IndentationLevel != 0) {
             FileOutputBuffer.append(IndentationLevel * 4, ' ');
         }
-        FileOutputBuffer.append(PrintfVarargs(Fmt, varargs));
+        FormatTo<ArgTypes...>(FileOutputBuffer, Format, Arguments...);
         if (bAutoEmitNewline) {
             FileOutputBuffer.push_back('\n');
         }
-
-        va_end(varargs);
     }
 
-    FORCEINLINE void WriteFile() {
-        std::wofstream OutputStream{OutputFilePath, std::ios_base::out};
-        if (!OutputStream.good()) {
-            throw std::exception{"Cannot open file for writing"};
-        }
-        OutputStream << FileOutputBuffer;
-        OutputStream.close();
+    ///Moves the UTF-8 contents of the file out of the buffer, so they can be handed over to the writer as they are
+    FORCEINLINE std::string TakeContents() {
+        return std::move(FileOutputBuffer);
     }
-};
-
-enum class EMemberAccess {
-    Unspecified = 0,
-    Private = 1,
-    Protected = 2,
-    Public = 3
-};
-
-struct FMemberVariable {
-    std::wstring VariableName{};
-    std::wstring VariableType{};
-    int32_t VariableOffset{0};
-    int32_t VariableSize{0};
-    EMemberAccess VariableAccess{EMemberAccess::Public};
-    bool bIsBitfield{false};
-    bool bIsArray{false};
-    bool bIsUDT{false};
-    int32_t BitfieldBitPosition{0};
-    int32_t BitfieldBitSize{0};
-    int32_t ArraySize{0};
-    /**
-     * True if the property needs value initialization.
-     * Value initialization is generally needed for all integral types and pointer types,
-     * and also for UDTs with no default constructor
-     * If you do not initialize these types explicitly, they will have garbage value
-     */
-    bool bNeedsValueInit{false};
-
-    /** Value to populate the variable with for default value init */
-    std::wstring ValueInitDefaultValue{};
-
-    /**
-     * True if the property needs the NoInit constructor call
-     * This is used to prevent the default initialization in places where it shouldn't happen
-     * and generally speaking constructor should do nothing
-     */
-    bool bNeedsNoInitConstructorCall{false};
-};
-
-struct FVirtualFunctionDeclaration {
-    std::wstring FunctionName{};
-    std::wstring FunctionDeclaration{};
-    int32_t VirtualTableOffset{0};
-    EMemberAccess FunctionAccess{EMemberAccess::Public};
-};
-
-struct FParentClassInfo {
-    std::wstring ClassName;
-    EMemberAccess ClassAccess{EMemberAccess::Unspecified};
-    int32_t ClassDataOffset{0};
-    int32_t ClassSize{0};
-    bool bHasConstructor{false};
-};
 
-struct FUserDefinedTypeLayout {
-    std::wstring ClassName{};
-    std::vector<FParentClassInfo> ParentClasses{};
-    std::vector<FMemberVariable> MemberVariables{};
-    std::vector<FVirtualFunctionDeclaration> VirtualFunctions{};
-    int32_t VirtualTableEntriesCount{0};
-    int32_t TotalTypeSize{0};
+    ///Writes the file into the output directory, or drops it if the file there has not changed
+    FORCEINLINE void WriteFile(FOutputDirectory& OutputDirectory) {
+        OutputDirectory.WriteFile(Format("{}.h", FileName), TakeContents());
+    }
 };
 
-std::wstring CreateBasicTypeName(DWORD BasicType, ULONGLONG TypeSize) {
+std::string CreateBasicTypeName(EBasicType BasicType, uint64_t TypeSize) {
     switch (BasicType) {
-        case btVoid:
+        case EBasicType::Void:
             assert(TypeSize == 0);
-            return TEXT("void");
-        case btChar:
+            return "void";
+        case EBasicType::Char:
             assert(TypeSize == 1);
-            return TEXT("ANSICHAR");
-        case btWChar:
+            return "ANSICHAR";
+        case EBasicType::WChar:
             assert(TypeSize == 2);
-            return TEXT("TCHAR");
-        case btBool:
+            return "TCHAR";
+        case EBasicType::Bool:
             assert(TypeSize == 1);
-            return TEXT("bool");
+            return "bool";
             ///MSVC does not differentiate between long and int,
             ///And neither does UE in fact, because some of the types below are defined
             ///as int and some of them are defined as long (namely uint64)
-        case btInt:
-        case btLong:
+        case EBasicType::Int:
             switch (TypeSize) {
-                case 1: return TEXT("int8");
-                case 2: return TEXT("int16");
-                case 4: return TEXT("int32");
-                case 8: return TEXT("int64");
+                case 1: return "int8";
+                case 2: return "int16";
+                case 4: return "int32";
+                case 8: return "int64";
                 default: assert(0);
             }
-            ///MSVC does not differentiate between long and int,
-            ///And neither does UE in fact, because some of the types below are defined
-            ///as int and some of them are defined as long (namely uint64)
-        case btUInt:
-        case btULong:
+            break;
+        case EBasicType::UInt:
             switch (TypeSize) {
-                case 1: return TEXT("uint8");
-                case 2: return TEXT("uint16");
-                case 4: return TEXT("uint32");
-                case 8: return TEXT("uint64");
+                case 1: return "uint8";
+                case 2: return "uint16";
+                case 4: return "uint32";
+                case 8: return "uint64";
                 default: assert(0);
             }
-        case btFloat:
+            break;
+        case EBasicType::Float:
             switch (TypeSize) {
-                case 4: return TEXT("float");
-                case 8: return TEXT("double");
+                case 4: return "float";
+                case 8: return "double";
                 default: assert(0);
             }
-        case btChar8:
+            break;
+        case EBasicType::Char8:
             assert(TypeSize == 1);
-            return TEXT("CHAR8");
-        case btChar16:
+            return "CHAR8";
+        case EBasicType::Char16:
             assert(TypeSize == 2);
-            return TEXT("CHAR16");
-        case btChar32:
+            return "CHAR16";
+        case EBasicType::Char32:
             assert(TypeSize == 4);
-            return TEXT("CHAR32");
+            return "CHAR32";
         default: assert(0);
     }
-    assert(0);
-    return Printf(TEXT("<unknown basic type %d: %d bytes>"), BasicType, TypeSize);
+    return Format("<unknown basic type {}: {} bytes>", static_cast<int32_t>(BasicType), static_cast<int32_t>(TypeSize));
 }
 
-void AppendConstVolatileModifiers(const CComPtr<IDiaSymbol>& TypeSymbol, std::wstring& OutputString, bool bPushSpaceBefore, bool bPushSpaceAfter) {
-    BOOL bIsConstantType = FALSE;
-    if (SUCCEEDED(TypeSymbol->get_constType(&bIsConstantType)) && bIsConstantType) {
+void AppendConstVolatileModifiers(const FSymbolInfo& TypeInfo, std::string& OutputString, bool bPushSpaceBefore, bool bPushSpaceAfter) {
+    if (TypeInfo.bIsConst) {
         if (bPushSpaceBefore) {
-            OutputString.push_back(TEXT(' '));
+            OutputString.push_back(' ');
         }
-        OutputString.append(TEXT("const"));
+        OutputString.append("const");
         if (bPushSpaceAfter) {
-            OutputString.push_back(TEXT(' '));
+            OutputString.push_back(' ');
         }
     }
-    BOOL bIsVolatileType = FALSE;
-    if (SUCCEEDED(TypeSymbol->get_volatileType(&bIsVolatileType)) && bIsVolatileType) {
+    if (TypeInfo.bIsVolatile) {
         ///No need to push the second space if we have const and it has pushed the after space already
         ///On the other hand, if we have not asked any spaces and we have const, we need to push one regardless
-        if ((bPushSpaceBefore && (!bPushSpaceAfter || !bIsConstantType)) || (bIsConstantType && !bPushSpaceAfter && !bPushSpaceBefore)) {
-            OutputString.push_back(TEXT(' '));
+        if ((bPushSpaceBefore && (!bPushSpaceAfter || !TypeInfo.bIsConst)) || (TypeInfo.bIsConst && !bPushSpaceAfter && !bPushSpaceBefore)) {
+            OutputString.push_back(' ');
         }
-        OutputString.append(TEXT("volatile"));
+        OutputString.append("volatile");
         if (bPushSpaceAfter) {
-            OutputString.push_back(TEXT(' '));
+            OutputString.push_back(' ');
         }
     }
 }
 
-std::wstring GenerateTypeDeclarationForSymbol(const CComPtr<IDiaSymbol>& TypeSymbol);
-
-std::wstring GenerateFunctionArgumentList(const CComPtr<IDiaSymbol>& FunctionTypeSymbol) {
-    std::wstring ResultArgumentList;
-
-    CComPtr<IDiaEnumSymbols> FunctionArgEnumerator{};
-    if (SUCCEEDED(FunctionTypeSymbol->findChildrenEx(SymTagFunctionArgType, nullptr, nsNone, &FunctionArgEnumerator))) {
-        LONG ArgumentCount = 0L;
-        FunctionArgEnumerator->get_Count(&ArgumentCount);
-
-        for (LONG i = 0; i < ArgumentCount; i++) {
-            CComPtr<IDiaSymbol> FunctionArgument{};
-            FunctionArgEnumerator->Item(i, &FunctionArgument);
+std::string GenerateFunctionArgumentList(const ISymbolSource& Source, FSymbolHandle FunctionTypeSymbol) {
+    std::string ResultArgumentList;
 
-            CComPtr<IDiaSymbol> ArgumentTypeSymbol{};
-            if (SUCCEEDED(FunctionArgument->get_type(&ArgumentTypeSymbol)) && ArgumentTypeSymbol) {
-                ResultArgumentList.append(GenerateTypeDeclarationForSymbol(ArgumentTypeSymbol));
+    std::vector<FSymbolHandle> FunctionArguments;
+    Source.GetChildren(FunctionTypeSymbol, ESymbolTag::FunctionArgType, FunctionArguments);
 
-                if ((i + 1) != ArgumentCount) {
-                    ResultArgumentList.append(TEXT(", "));
-                }
-            }
+    for (size_t i = 0; i < FunctionArguments.size(); i++) {
+        FSymbolInfo ArgumentInfo{};
+        if (!Source.GetSymbolInfo(FunctionArguments[i], ArgumentInfo)) {
+            continue;
         }
+        if (i != 0) {
+            ResultArgumentList.append(", ");
+        }
+        ///Variadic functions have the argument of no type as the last argument
+        ResultArgumentList.append(ArgumentInfo.Type.IsValid() ? GenerateTypeDeclarationForSymbol(Source, ArgumentInfo.Type) : "...");
     }
     return ResultArgumentList;
 }
 
-std::wstring GenerateFunctionTypeDeclarationForSymbol(const CComPtr<IDiaSymbol>& TypeSymbol, bool bGenerateFunctionPointerType) {
-    CComPtr<IDiaSymbol> FunctionReturnType{};
-    if (FAILED(TypeSymbol->get_type(&FunctionReturnType))) {
-        return TEXT("<unknown function type>");
+std::string GenerateFunctionTypeDeclarationForSymbol(const ISymbolSource& Source, FSymbolHandle TypeSymbol, bool bGenerateFunctionPointerType) {
+    FSymbolInfo FunctionTypeInfo{};
+    if (!Source.GetSymbolInfo(TypeSymbol, FunctionTypeInfo)) {
+        return "<unknown function type>";
     }
-    std::wstring ReturnTypeName = TEXT("void");
-    if (FunctionReturnType) {
-        ReturnTypeName = GenerateTypeDeclarationForSymbol(FunctionReturnType);
+    std::string ReturnTypeName = "void";
+    if (FunctionTypeInfo.Type.IsValid()) {
+        ReturnTypeName = GenerateTypeDeclarationForSymbol(Source, FunctionTypeInfo.Type);
     }
-    std::wstring ResultFunctionName = ReturnTypeName;
+    std::string ResultFunctionName = ReturnTypeName;
 
     if (bGenerateFunctionPointerType) {
-        ResultFunctionName.push_back(TEXT('('));
+        ResultFunctionName.push_back('(');
     }
 
-    CComPtr<IDiaSymbol> FunctionClassParent{};
-    BOOL bIsFunctionConst = FALSE;
+    bool bIsFunctionConst = false;
+    FSymbolInfo ClassParentInfo{};
 
-    if (SUCCEEDED(TypeSymbol->get_classParent(&FunctionClassParent)) && FunctionClassParent) {
+    if (FunctionTypeInfo.ClassParent.IsValid() && Source.GetSymbolInfo(FunctionTypeInfo.ClassParent, ClassParentInfo)) {
         if (bGenerateFunctionPointerType) {
-            BSTR ClassParentName{};
-            if (SUCCEEDED(FunctionClassParent->get_name(&ClassParentName)) && ClassParentName) {
+            const std::string ClassParentName = Source.GetSymbolName(FunctionTypeInfo.ClassParent);
+            if (!ClassParentName.empty()) {
                 ResultFunctionName.append(ClassParentName);
-                ResultFunctionName.append(TEXT("::"));
-
-                SysFreeString(ClassParentName);
+                ResultFunctionName.append("::");
             }
         }
         //TODO: It might be wrong and probably is wrong, I think const-ness of the object pointer should be checked instead
         //TODO: Need more samples though, and function types are really not that important, let's be real
-        FunctionClassParent->get_constType(&bIsFunctionConst);
+        bIsFunctionConst = ClassParentInfo.bIsConst;
     }
 
     if (bGenerateFunctionPointerType) {
-        ResultFunctionName.push_back(TEXT('*'));
-        AppendConstVolatileModifiers(TypeSymbol, ResultFunctionName, false, false);
+        ResultFunctionName.push_back('*');
+        AppendConstVolatileModifiers(FunctionTypeInfo, ResultFunctionName, false, false);
 
-        ResultFunctionName.push_back(TEXT(')'));
+        ResultFunctionName.push_back(')');
     }
 
-    ResultFunctionName.push_back(TEXT('('));
-    ResultFunctionName.append(GenerateFunctionArgumentList(TypeSymbol));
-    ResultFunctionName.push_back(TEXT(')'));
+    ResultFunctionName.push_back('(');
+    ResultFunctionName.append(GenerateFunctionArgumentList(Source, TypeSymbol));
+    ResultFunctionName.push_back(')');
 
     if (bIsFunctionConst) {
-        ResultFunctionName.append(TEXT(" const"));
+        ResultFunctionName.append(" const");
     }
     return ResultFunctionName;
 }
 
-std::wstring GenerateUDTTypeDeclarationForSymbol(const CComPtr<IDiaSymbol>& TypeSymbol, bool bGenerateCSU) {
-    std::wstring TypeName;
-    AppendConstVolatileModifiers(TypeSymbol, TypeName, false, true);
+std::string GenerateUDTTypeDeclarationForSymbol(const ISymbolSource& Source, FSymbolHandle TypeSymbol, const FSymbolInfo& TypeInfo, bool bGenerateCSU) {
+    std::string TypeName;
+    AppendConstVolatileModifiers(TypeInfo, TypeName, false, true);
 
     if (bGenerateCSU) {
-        DWORD TypeKind = UdtClass;
-        if (SUCCEEDED(TypeSymbol->get_udtKind(&TypeKind))) {
-            if (TypeKind == UdtClass) {
-                TypeName.append(TEXT("class "));
-            } else if (TypeKind == UdtStruct) {
-                TypeName.append(TEXT("struct "));
-            } else if (TypeKind == UdtUnion) {
-                TypeName.append(TEXT("union "));
-            }
+        if (TypeInfo.UDTKind == EUDTKind::Class) {
+            TypeName.append("class ");
+        } else if (TypeInfo.UDTKind == EUDTKind::Struct) {
+            TypeName.append("struct ");
+        } else if (TypeInfo.UDTKind == EUDTKind::Union) {
+            TypeName.append("union ");
         }
     }
-
-    BSTR TypeNameString{};
-    if (SUCCEEDED(TypeSymbol->get_name(&TypeNameString)) && TypeNameString) {
-        TypeName.append(TypeNameString);
-        SysFreeString(TypeNameString);
-    }
+    TypeName.append(Source.GetSymbolName(TypeSymbol));
     return TypeName;
 }
 
-std::wstring GenerateTypeDeclarationForSymbol(const CComPtr<IDiaSymbol>& TypeSymbol) {
-    DWORD SymbolTag = SymTagNull;
-    if (!SUCCEEDED(TypeSymbol->get_symTag(&SymbolTag))) {
-        return TEXT("<unknown symbol type>");
+///Walks the type to generate its declaration. Nested types are looked up through GenerateTypeDeclarationForSymbol, so they come from the cache too
+std::string GenerateUncachedTypeDeclarationForSymbol(const ISymbolSource& Source, FSymbolHandle TypeSymbol) {
+    FSymbolInfo TypeInfo{};
+    if (!Source.GetSymbolInfo(TypeSymbol, TypeInfo)) {
+        return "<unknown symbol type>";
     }
 
     ///Base types, like ints, longs, characters and so on
-    if (SymbolTag == SymTagBaseType) {
-        DWORD BaseType = btNoType;
-        ULONGLONG TypeSize = 0L;
-        if (FAILED(TypeSymbol->get_baseType(&BaseType)) || FAILED(TypeSymbol->get_length(&TypeSize))) {
-            return TEXT("<unknown base type symbol>");
+    if (TypeInfo.Tag == ESymbolTag::BaseType) {
+        if (TypeInfo.BasicType == EBasicType::NoType) {
+            return "<unknown base type symbol>";
         }
-        std::wstring BasicTypeName;
-        AppendConstVolatileModifiers(TypeSymbol, BasicTypeName, false, true);
-        BasicTypeName.append(CreateBasicTypeName(BaseType, TypeSize));
+        std::string BasicTypeName;
+        AppendConstVolatileModifiers(TypeInfo, BasicTypeName, false, true);
+        BasicTypeName.append(CreateBasicTypeName(TypeInfo.BasicType, TypeInfo.Length));
 
         return BasicTypeName;
     }
 
     ///Pointer types, and also the reference types
-    if (SymbolTag == SymTagPointerType) {
-        CComPtr<IDiaSymbol> PointedType{};
-        if (FAILED(TypeSymbol->get_type(&PointedType))) {
-            return TEXT("<unknown pointer type>");
+    if (TypeInfo.Tag == ESymbolTag::PointerType) {
+        FSymbolInfo PointedTypeInfo{};
+        if (!Source.GetSymbolInfo(TypeInfo.Type, PointedTypeInfo)) {
+            return "<unknown pointer type>";
         }
 
-        DWORD PointedTypeSymTag = SymTagNull;
-        PointedType->get_symTag(&PointedTypeSymTag);
-
         ///Special case: If we are pointing to the function type, generate the function pointer type
-        if (PointedTypeSymTag == SymTagFunctionType) {
-            return GenerateFunctionTypeDeclarationForSymbol(PointedType, true);
+        if (PointedTypeInfo.Tag == ESymbolTag::FunctionType) {
+            return GenerateFunctionTypeDeclarationForSymbol(Source, TypeInfo.Type, true);
         }
 
-        std::wstring ResultPointerName;
+        std::string ResultPointerName;
         ///Special case: If we are pointing to the UDT, append the CSU prefix so we do not have to make any pre-declarations
-        if (PointedTypeSymTag == SymTagUDT) {
-            ResultPointerName = GenerateUDTTypeDeclarationForSymbol(PointedType, true);
+        if (PointedTypeInfo.Tag == ESymbolTag::UDT) {
+            ResultPointerName = GenerateUDTTypeDeclarationForSymbol(Source, TypeInfo.Type, PointedTypeInfo, true);
         } else {
-            ResultPointerName = GenerateTypeDeclarationForSymbol(PointedType);
+            ResultPointerName = GenerateTypeDeclarationForSymbol(Source, TypeInfo.Type);
         }
 
-        BOOL bIsReferenceType = FALSE;
-        TypeSymbol->get_reference(&bIsReferenceType);
-
-        if (bIsReferenceType) {
-            ResultPointerName.append(TEXT("&"));
+        if (TypeInfo.bIsReference) {
+            ResultPointerName.append("&");
         } else {
-            ResultPointerName.append(TEXT("*"));
+            ResultPointerName.append("*");
         }
-        AppendConstVolatileModifiers(TypeSymbol, ResultPointerName, false, false);
+        AppendConstVolatileModifiers(TypeInfo, ResultPointerName, false, false);
         return ResultPointerName;
     }
 
     ///C-style statically sized arrays
-    if (SymbolTag == SymTagArrayType) {
-        CComPtr<IDiaSymbol> ElementType{};
-        if (FAILED(TypeSymbol->get_type(&ElementType))) {
-            return TEXT("<unknown array type>");
+    if (TypeInfo.Tag == ESymbolTag::ArrayType) {
+        if (!TypeInfo.Type.IsValid()) {
+            return "<unknown array type>";
         }
 
-        std::wstring ResultArrayName = GenerateTypeDeclarationForSymbol(ElementType);
-        ResultArrayName.push_back(TEXT('['));
+        std::string ResultArrayName = GenerateTypeDeclarationForSymbol(Source, TypeInfo.Type);
+        ResultArrayName.push_back('[');
 
-        DWORD ArrayElementCount = 0;
         //TODO: How non-sized arrays are represented (e.g. char[])
-        if (SUCCEEDED(TypeSymbol->get_count(&ArrayElementCount))) {
-            ResultArrayName.append(std::to_wstring(ArrayElementCount));
-        }
-        ResultArrayName.push_back(TEXT(']'));
-        AppendConstVolatileModifiers(TypeSymbol, ResultArrayName, true, false);
+        ResultArrayName.append(std::to_string(TypeInfo.Count));
+        ResultArrayName.push_back(']');
+        AppendConstVolatileModifiers(TypeInfo, ResultArrayName, true, false);
 
         ///We need to wrap the type into the identity because otherwise the array syntax is not valid
-        return Printf(TEXT("TIdentity<%s>::Type"), ResultArrayName.c_str());
+        return Format("TIdentity<{}>::Type", ResultArrayName);
     }
 
     ///Typedefs. For them we just use the name of the typedef and assume it is defined and valid
-    if (SymbolTag == SymTagTypedef) {
-        std::wstring TypedefNameString;
-        AppendConstVolatileModifiers(TypeSymbol, TypedefNameString, false, true);
+    if (TypeInfo.Tag == ESymbolTag::Typedef) {
+        std::string TypedefNameString;
+        AppendConstVolatileModifiers(TypeInfo, TypedefNameString, false, true);
 
-        BSTR TypedefName{};
-        if (FAILED(TypeSymbol->get_name(&TypedefName)) || !TypedefName) {
-           return TEXT("<unknown typedef>");
+        const std::string TypedefName = Source.GetSymbolName(TypeSymbol);
+        if (TypedefName.empty()) {
+           return "<unknown typedef>";
         }
         TypedefNameString.append(TypedefName);
-        SysFreeString(TypedefName);
         return TypedefNameString;
     }
 
     ///Enumerators. We use their types, but realistically speaking, we could use the underlying types too
     ///But since IDA doesn't seem to know which types are declared using enum and which are enum classes,
     ///we're gonna always go with an enum type
-    if (SymbolTag == SymTagEnum) {
-        std::wstring EnumNameString;
-        AppendConstVolatileModifiers(TypeSymbol, EnumNameString, false, true);
+    if (TypeInfo.Tag == ESymbolTag::Enum) {
+        std::string EnumNameString;
+        AppendConstVolatileModifiers(TypeInfo, EnumNameString, false, true);
 
-        BSTR EnumName{};
-        if (FAILED(TypeSymbol->get_name(&EnumName)) || !EnumName) {
-            return TEXT("<unknown enum type>");
+        const std::string EnumName = Source.GetSymbolName(TypeSymbol);
+        if (EnumName.empty()) {
+            return "<unknown enum type>";
         }
         EnumNameString.append(EnumName);
-        SysFreeString(EnumName);
 
         return EnumNameString;
     }
 
     ///User defined types. We reference them by names
-    if (SymbolTag == SymTagUDT) {
-        return GenerateUDTTypeDeclarationForSymbol(TypeSymbol, false);
+    if (TypeInfo.Tag == ESymbolTag::UDT) {
+        return GenerateUDTTypeDeclarationForSymbol(Source, TypeSymbol, TypeInfo, false);
     }
 
     ///Function signature types
-    if (SymbolTag == SymTagFunctionType) {
-        return GenerateFunctionTypeDeclarationForSymbol(TypeSymbol, false);
+    if (TypeInfo.Tag == ESymbolTag::FunctionType) {
+        return GenerateFunctionTypeDeclarationForSymbol(Source, TypeSymbol, false);
     }
 
     ///Virtual table. We just emit the placeholder that will cause a compilation error
     ///Realistically we should never generate variables of these types
-    if (SymbolTag == SymTagVTable) {
-        CComPtr<IDiaSymbol> ClassParentSymbol{};
-        if (FAILED(TypeSymbol->get_classParent(&ClassParentSymbol))) {
-            return TEXT("<unknown vtable type>");
+    if (TypeInfo.Tag == ESymbolTag::VTable) {
+        if (!TypeInfo.ClassParent.IsValid()) {
+            return "<unknown vtable type>";
         }
 
-        std::wstring ConstVolatilePrefix;
-        AppendConstVolatileModifiers(TypeSymbol, ConstVolatilePrefix, false, true);
+        std::string ConstVolatilePrefix;
+        AppendConstVolatileModifiers(TypeInfo, ConstVolatilePrefix, false, true);
 
-        std::wstring ClassName = TEXT("<Unknown Class>");
-        BSTR ClassNameString{};
-        if (SUCCEEDED(ClassParentSymbol->get_name(&ClassNameString)) && ClassNameString) {
-            ClassName = ClassNameString;
-            SysFreeString(ClassNameString);
+        std::string ClassName = Source.GetSymbolName(TypeInfo.ClassParent);
+        if (ClassName.empty()) {
+            ClassName = "<Unknown Class>";
         }
 
-        return Printf(TEXT("<%sVTable of Class %s>"), ConstVolatilePrefix.c_str(), ClassName.c_str());
+        return Format("<{}VTable of Class {}>", ConstVolatilePrefix, ClassName);
     }
 
     ///Some unhandled symbol type. We assert, and try to print the placeholder otherwise
     assert(0);
-    return Printf(TEXT("<unhandled symbol type with tag %lu>"), SymbolTag);
+    return Format("<unhandled symbol type with tag {}>", static_cast<int32_t>(TypeInfo.Tag));
 }
 
-std::wstring GenerateDefaultValueForType(const CComPtr<IDiaSymbol>& TypeSymbol) {
-    DWORD SymbolTag = SymTagNull;
-    if (!SUCCEEDED(TypeSymbol->get_symTag(&SymbolTag))) {
-        return TEXT("<unknown symbol type>");
+std::string GenerateDefaultValueForType(const ISymbolSource& Source, FSymbolHandle TypeSymbol) {
+    FSymbolInfo TypeInfo{};
+    if (!Source.GetSymbolInfo(TypeSymbol, TypeInfo)) {
+        return "<unknown symbol type>";
     }
 
     ///All basic types are convertible to numbers and back so you can use zero as an universal return value
-    if (SymbolTag == SymTagBaseType) {
-        return TEXT("0");
+    if (TypeInfo.Tag == ESymbolTag::BaseType) {
+        return "0";
     }
     ///For pointer types nullptr is probably the most universal value
-    if (SymbolTag == SymTagPointerType) {
-        return TEXT("nullptr");
+    if (TypeInfo.Tag == ESymbolTag::PointerType) {
+        return "nullptr";
     }
 
     ///For arrays it depends on whenever it's the trailing array or fixed style array
@@ -502,17 +372,16 @@ std::wstring GenerateDefaultValueForType(const CComPtr<IDiaSymbol>& TypeSymbol)
     ///And fixed size arrays can be initialized using the bracket initializer
     ///To be completely fair, C-style arrays cannot even be returned by functions, so it's not like it matters
     //TODO: How non-sized arrays are represented (e.g. char[])
-    if (SymbolTag == SymTagArrayType) {
-        return TEXT("{}");
+    if (TypeInfo.Tag == ESymbolTag::ArrayType) {
+        return "{}";
     }
 
     ///For typedefs we need to look up the underlying type default value
-    if (SymbolTag == SymTagTypedef) {
-        CComPtr<IDiaSymbol> UnderlyingTypeSymbol{};
-        if (FAILED(TypeSymbol->get_type(&UnderlyingTypeSymbol))) {
-            return TEXT("<unknown typedef value>");
+    if (TypeInfo.Tag == ESymbolTag::Typedef) {
+        if (!TypeInfo.Type.IsValid()) {
+            return "<unknown typedef value>";
         }
-        return GenerateDefaultValueForType(UnderlyingTypeSymbol);
+        return GenerateDefaultValueForType(Source, TypeInfo.Type);
     }
 
     ///For enumerators it really depends on whenever they're scoped or not
@@ -520,457 +389,304 @@ std::wstring GenerateDefaultValueForType(const CComPtr<IDiaSymbol>& TypeSymbol)
     ///Would be to return the first entry in the enumerator
     //TODO: Nah, we just return 0 casted to the enumeration type, because DIA SDK
     //TODO: Tells you that enum values are of type SymTagConstant, BUT THAT TYPE DOES NOT EVEN EXIST LMAO
-    if (SymbolTag == SymTagEnum) {
-        BSTR EnumName{};
-        if (FAILED(TypeSymbol->get_name(&EnumName)) || !EnumName) {
-            return TEXT("<unknown enum type default value>");
+    if (TypeInfo.Tag == ESymbolTag::Enum) {
+        const std::string EnumerationName = Source.GetSymbolName(TypeSymbol);
+        if (EnumerationName.empty()) {
+            return "<unknown enum type default value>";
         }
-        std::wstring EnumerationName = EnumName;
-        SysFreeString(EnumName);
-        return Printf(TEXT("(%s) 0"), EnumerationName.c_str());
+        return Format("({}) 0", EnumerationName);
     }
 
     ///User defined types are actually pretty tricky. We can dereference nullptr or try to default construct them
     ///We're making a best effort and just trying to default construct the value
-    if (SymbolTag == SymTagUDT) {
-        std::wstring TypeName;
-
-        BSTR TypeNameString{};
-        if (SUCCEEDED(TypeSymbol->get_name(&TypeNameString)) && TypeNameString) {
-            TypeName.append(TypeNameString);
-            SysFreeString(TypeNameString);
-        }
-        return Printf(TEXT("%s{}"), TypeName.c_str());
+    if (TypeInfo.Tag == ESymbolTag::UDT) {
+        const std::string TypeName = Source.GetSymbolName(TypeSymbol);
+        return Format("{}{{}}", TypeName);
     }
 
     ///Just use nullptr for function signatures
-    if (SymbolTag == SymTagFunctionType) {
-        return TEXT("nullptr");
+    if (TypeInfo.Tag == ESymbolTag::FunctionType) {
+        return "nullptr";
     }
 
     ///Some unhandled symbol type. We assert, and try to print the placeholder otherwise
     assert(0);
-    return Printf(TEXT("<unhandled symbol type with tag %lu>"), SymbolTag);
+    return Format("<unhandled symbol type with tag {}>", static_cast<int32_t>(TypeInfo.Tag));
 }
 
-bool DoesTypeNeedValueInitialization(const CComPtr<IDiaSymbol>& TypeSymbol, std::wstring& OutValueInitDefaultValue) {
-    DWORD SymbolTag = SymTagNull;
-    if (!SUCCEEDED(TypeSymbol->get_symTag(&SymbolTag))) {
+bool DoesTypeNeedValueInitialization(const ISymbolSource& Source, FSymbolHandle TypeSymbol, std::string& OutValueInitDefaultValue) {
+    FSymbolInfo TypeInfo{};
+    if (!Source.GetSymbolInfo(TypeSymbol, TypeInfo)) {
         return false;
     }
 
     ///All basic types need value initialization, or they will have trash as value
-    if (SymbolTag == SymTagBaseType) {
-        OutValueInitDefaultValue = TEXT("0");
+    if (TypeInfo.Tag == ESymbolTag::BaseType) {
+        OutValueInitDefaultValue = "0";
         return true;
     }
     ///Same applies to pointers, they need to be default initialized to nullptr
-    if (SymbolTag == SymTagPointerType) {
-        OutValueInitDefaultValue = TEXT("nullptr");
+    if (TypeInfo.Tag == ESymbolTag::PointerType) {
+        OutValueInitDefaultValue = "nullptr";
         return true;
     }
     ///Whenever arrays need to be default initialized or not depends on the underlying element type
-    if (SymbolTag == SymTagArrayType) {
-        CComPtr<IDiaSymbol> ElementType{};
-        if (FAILED(TypeSymbol->get_type(&ElementType))) {
-            return false;
-        }
-        return DoesTypeNeedValueInitialization(ElementType, OutValueInitDefaultValue);
-    }
     ///For typedefs we need to look up the underlying type to check if they need anything
-    if (SymbolTag == SymTagTypedef) {
-        CComPtr<IDiaSymbol> UnderlyingTypeSymbol{};
-        if (FAILED(TypeSymbol->get_type(&UnderlyingTypeSymbol))) {
-            return false;
-        }
-        return DoesTypeNeedValueInitialization(UnderlyingTypeSymbol, OutValueInitDefaultValue);
+    if (TypeInfo.Tag == ESymbolTag::ArrayType || TypeInfo.Tag == ESymbolTag::Typedef) {
+        return TypeInfo.Type.IsValid() && DoesTypeNeedValueInitialization(Source, TypeInfo.Type, OutValueInitDefaultValue);
     }
     ///Enumerations need value instantiation, which will give them 0 value of underlying type
-    if (SymbolTag == SymTagEnum) {
-        std::wstring EnumTypeName = GenerateUDTTypeDeclarationForSymbol(TypeSymbol, false);
-        OutValueInitDefaultValue = Printf(TEXT("(%s) 0"), EnumTypeName.c_str());
+    if (TypeInfo.Tag == ESymbolTag::Enum) {
+        std::string EnumTypeName = GenerateUDTTypeDeclarationForSymbol(Source, TypeSymbol, TypeInfo, false);
+        OutValueInitDefaultValue = Format("({}) 0", EnumTypeName);
         return true;
     }
     ///User defined types need value initialization if they do not have a default constructor
     ///TODO: There are also special cases for classes that lack default constructor that properly initializes them
-    if (SymbolTag == SymTagUDT) {
-        OutValueInitDefaultValue = TEXT("");
-        BOOL bTypeHasConstructor = FALSE;
-        TypeSymbol->get_constructor(&bTypeHasConstructor);
-        return !bTypeHasConstructor;
+    if (TypeInfo.Tag == ESymbolTag::UDT) {
+        OutValueInitDefaultValue = "";
+        return !TypeInfo.bHasConstructor;
     }
     ///Everything else totally does not default initialization
     return false;
 }
 
-bool DoesTypeNeedNoInitConstruction(const CComPtr<IDiaSymbol>& TypeSymbol) {
-    DWORD SymbolTag = SymTagNull;
-    if (!SUCCEEDED(TypeSymbol->get_symTag(&SymbolTag))) {
+bool DoesTypeNeedNoInitConstruction(const ISymbolSource& Source, FSymbolHandle TypeSymbol) {
+    FSymbolInfo TypeInfo{};
+    if (!Source.GetSymbolInfo(TypeSymbol, TypeInfo)) {
         return false;
     }
 
     ///Whenever arrays need their elements to be NoInit initialized or not depends on the underlying element type
-    if (SymbolTag == SymTagArrayType) {
-        CComPtr<IDiaSymbol> ElementType{};
-        if (FAILED(TypeSymbol->get_type(&ElementType))) {
-            return false;
-        }
-        return DoesTypeNeedNoInitConstruction(ElementType);
-    }
     ///For typedefs we need to look up the underlying type to check if they need NoInit call
-    if (SymbolTag == SymTagTypedef) {
-        CComPtr<IDiaSymbol> UnderlyingTypeSymbol{};
-        if (FAILED(TypeSymbol->get_type(&UnderlyingTypeSymbol))) {
-            return false;
-        }
-        return DoesTypeNeedNoInitConstruction(UnderlyingTypeSymbol);
+    if (TypeInfo.Tag == ESymbolTag::ArrayType || TypeInfo.Tag == ESymbolTag::Typedef) {
+        return TypeInfo.Type.IsValid() && DoesTypeNeedNoInitConstruction(Source, TypeInfo.Type);
     }
     ///User defined types need NoInit constructor calls if they have a constructor
-    if (SymbolTag == SymTagUDT) {
-        BOOL bTypeHasConstructor = FALSE;
-        TypeSymbol->get_constructor(&bTypeHasConstructor);
-        return bTypeHasConstructor;
+    if (TypeInfo.Tag == ESymbolTag::UDT) {
+        return TypeInfo.bHasConstructor;
     }
     ///Everything else does not need NoInit constructor calls
     return false;
 }
 
-bool IsSymbolUserDefinedType(const CComPtr<IDiaSymbol>& TypeSymbol) {
-    DWORD SymbolTag = SymTagNull;
-    if (!SUCCEEDED(TypeSymbol->get_symTag(&SymbolTag))) {
+bool IsSymbolUserDefinedType(const ISymbolSource& Source, FSymbolHandle TypeSymbol) {
+    FSymbolInfo TypeInfo{};
+    if (!Source.GetSymbolInfo(TypeSymbol, TypeInfo)) {
         return false;
     }
-    if (SymbolTag == SymTagTypedef) {
-        CComPtr<IDiaSymbol> UnderlyingTypeSymbol{};
-        if (FAILED(TypeSymbol->get_type(&UnderlyingTypeSymbol))) {
-            return false;
-        }
-        return IsSymbolUserDefinedType(UnderlyingTypeSymbol);
-    }
-    if (SymbolTag == SymTagUDT) {
-        return true;
+    if (TypeInfo.Tag == ESymbolTag::Typedef) {
+        return TypeInfo.Type.IsValid() && IsSymbolUserDefinedType(Source, TypeInfo.Type);
     }
-    return false;
+    return TypeInfo.Tag == ESymbolTag::UDT;
 }
 
-std::wstring GenerateFunctionDeclaration(const CComPtr<IDiaSymbol>& FunctionSymbol) {
-    CComPtr<IDiaSymbol> FunctionTypeSymbol;
-    if (FAILED(FunctionSymbol->get_type(&FunctionTypeSymbol)) || !FunctionTypeSymbol) {
-        return TEXT("<unknown function declaration>");
-    }
+///Returns the declaration and the initialization flags of the type, generating them the first time the type is referenced by the source
+const FCachedTypeDeclaration& FindOrAddTypeDeclaration(const ISymbolSource& Source, FSymbolHandle TypeSymbol) {
+    return Source.GetDeclarationCache().FindOrAddDeclaration(TypeSymbol.Id, [&](FCachedTypeDeclaration& OutDeclaration) {
+        OutDeclaration.Declaration = GenerateUncachedTypeDeclarationForSymbol(Source, TypeSymbol);
+        OutDeclaration.bIsUDT = IsSymbolUserDefinedType(Source, TypeSymbol);
+        OutDeclaration.bNeedsValueInit = DoesTypeNeedValueInitialization(Source, TypeSymbol, OutDeclaration.ValueInitDefaultValue);
+        OutDeclaration.bNeedsNoInitConstructorCall = DoesTypeNeedNoInitConstruction(Source, TypeSymbol);
+    });
+}
 
-    std::wstring FunctionDeclarationString;
+std::string GenerateTypeDeclarationForSymbol(const ISymbolSource& Source, FSymbolHandle TypeSymbol) {
+    return FindOrAddTypeDeclaration(Source, TypeSymbol).Declaration;
+}
 
-    BOOL bIsVirtualFunction = FALSE;
-    if (SUCCEEDED(FunctionSymbol->get_virtual(&bIsVirtualFunction)) && bIsVirtualFunction) {
-        FunctionDeclarationString.append(TEXT("virtual "));
+std::string GenerateFunctionDeclaration(const ISymbolSource& Source, FSymbolHandle FunctionSymbol, const FSymbolInfo& FunctionInfo) {
+    FSymbolInfo FunctionTypeInfo{};
+    if (!FunctionInfo.Type.IsValid() || !Source.GetSymbolInfo(FunctionInfo.Type, FunctionTypeInfo)) {
+        return "<unknown function declaration>";
     }
 
-    BOOL bIsStaticFunction = FALSE;
-    if (SUCCEEDED(FunctionSymbol->get_isStatic(&bIsStaticFunction)) && bIsStaticFunction) {
-        FunctionDeclarationString.append(TEXT("static "));
+    std::string FunctionDeclarationString;
+
+    if (FunctionInfo.bIsVirtual) {
+        FunctionDeclarationString.append("virtual ");
+    }
+    if (FunctionInfo.bIsStatic) {
+        FunctionDeclarationString.append("static ");
     }
 
-    std::wstring ReturnTypeString = TEXT("void");
-    CComPtr<IDiaSymbol> ReturnTypeSymbol{};
-    if (SUCCEEDED(FunctionTypeSymbol->get_type(&ReturnTypeSymbol)) && ReturnTypeSymbol) {
-        ReturnTypeString = GenerateTypeDeclarationForSymbol(ReturnTypeSymbol);
+    std::string ReturnTypeString = "void";
+    if (FunctionTypeInfo.Type.IsValid()) {
+        ReturnTypeString = GenerateTypeDeclarationForSymbol(Source, FunctionTypeInfo.Type);
     }
     FunctionDeclarationString.append(ReturnTypeString);
 
-    std::wstring FunctionName = TEXT("<unknown function name>");
-    BSTR FunctionNameString{};
-    if (SUCCEEDED(FunctionSymbol->get_name(&FunctionNameString)) && FunctionNameString) {
-        FunctionName = FunctionNameString;
-        SysFreeString(FunctionNameString);
+    std::string FunctionName = Source.GetSymbolName(FunctionSymbol);
+    if (FunctionName.empty()) {
+        FunctionName = "<unknown function name>";
     }
-    FunctionDeclarationString.push_back(TEXT(' '));
+    FunctionDeclarationString.push_back(' ');
     FunctionDeclarationString.append(FunctionName);
 
-    FunctionDeclarationString.push_back(TEXT('('));
-    FunctionDeclarationString.append(GenerateFunctionArgumentList(FunctionTypeSymbol));
-    FunctionDeclarationString.push_back(TEXT(')'));
+    FunctionDeclarationString.push_back('(');
+    FunctionDeclarationString.append(GenerateFunctionArgumentList(Source, FunctionInfo.Type));
+    FunctionDeclarationString.push_back(')');
 
     ///Append const to the member function if it is marked const
-    BOOL bIsConstFunction = FALSE;
-    if (SUCCEEDED(FunctionSymbol->get_constType(&bIsConstFunction)) && bIsConstFunction) {
-        FunctionDeclarationString.append(TEXT(" const"));
+    if (FunctionInfo.bIsConst) {
+        FunctionDeclarationString.append(" const");
     }
 
     ///If the function is virtual but is not intro virtual, append the override specifier
-    BOOL bIsIntroVirtual = FALSE;
-    if (SUCCEEDED(FunctionSymbol->get_intro(&bIsIntroVirtual)) && (bIsVirtualFunction && !bIsIntroVirtual)) {
-        FunctionDeclarationString.append(TEXT(" override"));
+    if (FunctionInfo.bIsVirtual && !FunctionInfo.bIsIntroVirtual) {
+        FunctionDeclarationString.append(" override");
     }
 
-    BOOL bIsPureVirtual = FALSE;
-    FunctionSymbol->get_pure(&bIsPureVirtual);
-    if (bIsPureVirtual) {
-        FunctionDeclarationString.append(TEXT(" = 0;"));
+    if (FunctionInfo.bIsPureVirtual) {
+        FunctionDeclarationString.append(" = 0;");
     } else {
-        FunctionDeclarationString.append(TEXT(" {"));
+        FunctionDeclarationString.append(" {");
 
         ///Generate dummy return statement if this function is not returning void
-        if (ReturnTypeString != TEXT("void")) {
-            std::wstring DummyReturnType = GenerateDefaultValueForType(ReturnTypeSymbol);
-            FunctionDeclarationString.append(Printf(TEXT(" return %s; "), DummyReturnType.c_str()));
+        if (ReturnTypeString != "void") {
+            const std::string& DummyReturnType = Source.GetDeclarationCache().FindOrAddDefaultValue(FunctionTypeInfo.Type.Id, [&]() {
+                return GenerateDefaultValueForType(Source, FunctionTypeInfo.Type);
+            });
+            FormatTo(FunctionDeclarationString, " return {}; ", DummyReturnType);
         }
-        FunctionDeclarationString.append(TEXT("};"));
+        FunctionDeclarationString.append("};");
     }
     return FunctionDeclarationString;
 }
 
-void GenerateUserDefinedTypeLayout(const CComPtr<IDiaSymbol>& UDTSymbol, FUserDefinedTypeLayout& OutLayout) {
-    BSTR SymbolName{};
-    if (SUCCEEDED(UDTSymbol->get_name(&SymbolName))) {
-        OutLayout.ClassName = SymbolName;
-        SysFreeString(SymbolName);
+void GenerateUserDefinedTypeLayout(const ISymbolSource& Source, FSymbolHandle UDTSymbol, FUserDefinedTypeLayout& OutLayout) {
+    FSymbolInfo UDTInfo{};
+    if (!Source.GetSymbolInfo(UDTSymbol, UDTInfo)) {
+        return;
     }
+    OutLayout.ClassName = Source.GetSymbolName(UDTSymbol);
 
     ///Iterate the base classes of the user defined type
-    CComPtr<IDiaEnumSymbols> BaseClassSymbols{};
-    if (SUCCEEDED(UDTSymbol->findChildrenEx(SymTagBaseClass, NULL, nsNone, &BaseClassSymbols))) {
-        LONG SymbolCount = 0;
-        BaseClassSymbols->get_Count(&SymbolCount);
-
-        for (LONG i = 0; i < SymbolCount; i++) {
-            CComPtr<IDiaSymbol> BaseClassSymbol{};
-            BaseClassSymbols->Item(i, &BaseClassSymbol);
-            FParentClassInfo ParentClassInfo{};
-
-            BSTR ParentClassName{};
-            if (SUCCEEDED(BaseClassSymbol->get_name(&ParentClassName)) && ParentClassName) {
-                ParentClassInfo.ClassName = ParentClassName;
-                SysFreeString(ParentClassName);
-            }
-
-            LONG ParentClassDataOffset{0};
-            if (SUCCEEDED(BaseClassSymbol->get_offset(&ParentClassDataOffset))) {
-                ParentClassInfo.ClassDataOffset = (int32_t) ParentClassDataOffset;
-            }
-
-            ULONGLONG ParentClassSize{0};
-            if (SUCCEEDED(BaseClassSymbol->get_length(&ParentClassSize))) {
-                ParentClassInfo.ClassSize = (int32_t) ParentClassSize;
-            }
+    std::vector<FSymbolHandle> BaseClassSymbols;
+    Source.GetChildren(UDTSymbol, ESymbolTag::BaseClass, BaseClassSymbols);
 
-            DWORD VariableAccess{};
-            if (SUCCEEDED(BaseClassSymbol->get_access(&VariableAccess))) {
-                if (VariableAccess == CV_private) {
-                    ParentClassInfo.ClassAccess = EMemberAccess::Private;
-                } else if (VariableAccess == CV_protected) {
-                    ParentClassInfo.ClassAccess = EMemberAccess::Protected;
-                } else if (VariableAccess == CV_public) {
-                    ParentClassInfo.ClassAccess = EMemberAccess::Public;
-                }
-            }
-
-            BOOL bHasConstructor{false};
-            if (SUCCEEDED(BaseClassSymbol->get_constructor(&bHasConstructor))) {
-                ParentClassInfo.bHasConstructor = bHasConstructor;
-            }
-
-            OutLayout.ParentClasses.push_back(ParentClassInfo);
+    for (FSymbolHandle BaseClassSymbol : BaseClassSymbols) {
+        FSymbolInfo BaseClassInfo{};
+        if (!Source.GetSymbolInfo(BaseClassSymbol, BaseClassInfo)) {
+            continue;
         }
-    }
+        FParentClassInfo ParentClassInfo{};
+        ParentClassInfo.ClassName = Source.GetSymbolName(BaseClassSymbol);
+        ParentClassInfo.ClassDataOffset = BaseClassInfo.Offset;
+        ParentClassInfo.ClassSize = (int32_t) BaseClassInfo.Length;
+        ParentClassInfo.ClassAccess = BaseClassInfo.Access;
+        ParentClassInfo.bHasConstructor = BaseClassInfo.bHasConstructor;
 
-    uint64_t TypeSizeInBytes{};
-    if (SUCCEEDED(UDTSymbol->get_length(&TypeSizeInBytes))) {
-        OutLayout.TotalTypeSize = (int32_t) TypeSizeInBytes;
+        OutLayout.ParentClasses.push_back(ParentClassInfo);
     }
 
-    ///Iterate the member variables of the user defined type
-    CComPtr<IDiaEnumSymbols> DataSymbols{};
-    if (SUCCEEDED(UDTSymbol->findChildrenEx(SymTagData, NULL, nsNone, &DataSymbols))) {
-        LONG SymbolCount = 0;
-        DataSymbols->get_Count(&SymbolCount);
-
-        for(LONG i = 0; i < SymbolCount; i++) {
-            CComPtr<IDiaSymbol> ChildDataSymbol{};
-            DataSymbols->Item(i, &ChildDataSymbol);
-
-            DWORD SymbolDataKind{};
-            DWORD SymbolLocationType{};
-
-            if (FAILED(ChildDataSymbol->get_dataKind(&SymbolDataKind)) ||
-                FAILED(ChildDataSymbol->get_locationType(&SymbolLocationType))) {
-                ChildDataSymbol.Release();
-                continue;
-            }
+    OutLayout.TotalTypeSize = (int32_t) UDTInfo.Length;
 
-            ///Skip over variables that are not member variables of the UDT
-            ///Or variables that are not this relative/bit fields
-            if (SymbolDataKind != DataKind::DataIsMember ||
-                (SymbolLocationType != LocIsThisRel && SymbolLocationType != LocIsBitField)) {
-                ChildDataSymbol.Release();
-                continue;
-            }
-
-            ///Skip over the compiler generated properties
-            BOOL bIsCompilerGenerated = FALSE;
-            if (SUCCEEDED(ChildDataSymbol->get_compilerGenerated(&bIsCompilerGenerated)) && bIsCompilerGenerated) {
-                ChildDataSymbol.Release();
-                continue;
-            }
+    ///Resolve the header the type has been defined in, if the symbol source records it
+    Source.GetSourceLine(UDTSymbol, OutLayout.SourceFilePath, OutLayout.SourceLineNumber);
 
-            FMemberVariable MemberVariable{};
-
-            BSTR VariableName{};
-            if (SUCCEEDED(ChildDataSymbol->get_name(&VariableName))) {
-                MemberVariable.VariableName = VariableName;
-                SysFreeString(VariableName);
-            }
-
-            CComPtr<IDiaSymbol> VariableType{};
-            if (SUCCEEDED(ChildDataSymbol->get_type(&VariableType))) {
-                ///If variable type is an array type, we want variable type to be an array element type instead
-                DWORD VariableTypeSymTag = SymTagNull;
-                if (SUCCEEDED(VariableType->get_symTag(&VariableTypeSymTag)) && VariableTypeSymTag == SymTagArrayType) {
-                    MemberVariable.bIsArray = true;
-
-                    CComPtr<IDiaSymbol> ElementType{};
-                    if (SUCCEEDED(VariableType->get_type(&ElementType))) {
-                        MemberVariable.VariableType = GenerateTypeDeclarationForSymbol(ElementType);
-                        MemberVariable.bIsUDT = IsSymbolUserDefinedType(ElementType);
-                    }
+    ///Iterate the member variables of the user defined type
+    std::vector<FSymbolHandle> DataSymbols;
+    Source.GetChildren(UDTSymbol, ESymbolTag::Data, DataSymbols);
 
-                    DWORD ArrayElementCount = 0;
-                    if (SUCCEEDED(VariableType->get_count(&ArrayElementCount))) {
-                        MemberVariable.ArraySize = (int32_t) ArrayElementCount;
-                    }
-                } else {
-                    MemberVariable.VariableType = GenerateTypeDeclarationForSymbol(VariableType);
-                    MemberVariable.bIsUDT = IsSymbolUserDefinedType(VariableType);
-                }
+    for (FSymbolHandle ChildDataSymbol : DataSymbols) {
+        FSymbolInfo DataInfo{};
+        if (!Source.GetSymbolInfo(ChildDataSymbol, DataInfo)) {
+            continue;
+        }
 
-                MemberVariable.bNeedsValueInit = DoesTypeNeedValueInitialization(VariableType, MemberVariable.ValueInitDefaultValue);
-                MemberVariable.bNeedsNoInitConstructorCall = DoesTypeNeedNoInitConstruction(VariableType);
-            }
+        ///Skip over variables that are not member variables of the UDT
+        ///Or variables that are not this relative/bit fields
+        if (DataInfo.Location != EDataLocation::ThisRelative && DataInfo.Location != EDataLocation::BitField) {
+            continue;
+        }
 
-            DWORD VariableAccess{};
-            if (SUCCEEDED(ChildDataSymbol->get_access(&VariableAccess))) {
-                if (VariableAccess == CV_private) {
-                    MemberVariable.VariableAccess = EMemberAccess::Private;
-                } else if (VariableAccess == CV_protected) {
-                    MemberVariable.VariableAccess = EMemberAccess::Protected;
-                } else if (VariableAccess == CV_public) {
-                    MemberVariable.VariableAccess = EMemberAccess::Public;
-                }
-            }
+        ///Skip over the compiler generated properties
+        if (DataInfo.bIsCompilerGenerated) {
+            continue;
+        }
 
-            ///We can always call get_offset because the location is either a bitfield or a this relative variable
-            LONG VariableOffset{};
-            if (SUCCEEDED(ChildDataSymbol->get_offset(&VariableOffset))) {
-                MemberVariable.VariableOffset = VariableOffset;
-            }
+        FMemberVariable MemberVariable{};
+        MemberVariable.VariableName = Source.GetSymbolName(ChildDataSymbol);
 
-            ///Bitfields have bitPosition and length in bits
-            if (SymbolLocationType == LocIsBitField) {
-                MemberVariable.bIsBitfield = true;
+        FSymbolInfo VariableTypeInfo{};
+        if (Source.GetSymbolInfo(DataInfo.Type, VariableTypeInfo)) {
+            const FCachedTypeDeclaration& VariableTypeDeclaration = FindOrAddTypeDeclaration(Source, DataInfo.Type);
 
-                DWORD BitPosition{};
-                if (SUCCEEDED(ChildDataSymbol->get_bitPosition(&BitPosition))) {
-                    MemberVariable.BitfieldBitPosition = (int32_t) BitPosition;
-                }
-                ULONGLONG BitSize{};
-                if (SUCCEEDED(ChildDataSymbol->get_length(&BitSize))) {
-                    MemberVariable.BitfieldBitSize = (int32_t) BitSize;
-                }
+            ///If variable type is an array type, we want variable type to be an array element type instead
+            if (VariableTypeInfo.Tag == ESymbolTag::ArrayType) {
+                MemberVariable.bIsArray = true;
 
-                ULONGLONG VariableSize{};
-                if (SUCCEEDED(VariableType->get_length(&VariableSize))) {
-                    MemberVariable.VariableSize = (int32_t) VariableSize;
+                if (VariableTypeInfo.Type.IsValid()) {
+                    const FCachedTypeDeclaration& ElementTypeDeclaration = FindOrAddTypeDeclaration(Source, VariableTypeInfo.Type);
+                    MemberVariable.VariableType = ElementTypeDeclaration.Declaration;
+                    MemberVariable.bIsUDT = ElementTypeDeclaration.bIsUDT;
                 }
+                MemberVariable.ArraySize = (int32_t) VariableTypeInfo.Count;
             } else {
-                //Retrieve normal size
-                ULONGLONG VariableSize{};
-                if (SUCCEEDED(ChildDataSymbol->get_length(&VariableSize))) {
-                    MemberVariable.VariableSize = (int32_t) VariableSize;
-                }
+                MemberVariable.VariableType = VariableTypeDeclaration.Declaration;
+                MemberVariable.bIsUDT = VariableTypeDeclaration.bIsUDT;
             }
 
-            OutLayout.MemberVariables.push_back(MemberVariable);
-            ChildDataSymbol.Release();
+            MemberVariable.bNeedsValueInit = VariableTypeDeclaration.bNeedsValueInit;
+            MemberVariable.ValueInitDefaultValue = VariableTypeDeclaration.ValueInitDefaultValue;
+            MemberVariable.bNeedsNoInitConstructorCall = VariableTypeDeclaration.bNeedsNoInitConstructorCall;
         }
-    }
 
-    ///Iterate the functions defined on the type
-    CComPtr<IDiaEnumSymbols> FunctionSymbols{};
-    if (SUCCEEDED(UDTSymbol->findChildrenEx(SymTagFunction, NULL, nsNone, &FunctionSymbols))) {
-        LONG SymbolCount = 0L;
-        FunctionSymbols->get_Count(&SymbolCount);
-
-        for(LONG i = 0; i < SymbolCount; i++) {
-            CComPtr<IDiaSymbol> ChildFunctionSymbol{};
-            FunctionSymbols->Item(i, &ChildFunctionSymbol);
-
-            BOOL bIsFunctionVirtual = 0;
-            BOOL bIsIntroVirtual = 0;
-
-            ///We skip over the functions that are not marked as intro virtuals
-            ///If function is not marked as intro it's not the first declaration of the virtual function but rather
-            ///an override, and we do not really care about overrides
-            if (FAILED(ChildFunctionSymbol->get_virtual(&bIsFunctionVirtual)) ||
-                FAILED(ChildFunctionSymbol->get_intro(&bIsIntroVirtual))) {
-                ChildFunctionSymbol.Release();
-                continue;
-            }
+        MemberVariable.VariableAccess = DataInfo.Access;
+        MemberVariable.VariableOffset = DataInfo.Offset;
 
-            ///Skip over non-intro virtual functions, we do not care about them
-            if (!bIsFunctionVirtual || !bIsIntroVirtual) {
-                ChildFunctionSymbol.Release();
-                continue;
-            }
+        ///Bitfields have bitPosition and length in bits
+        if (DataInfo.Location == EDataLocation::BitField) {
+            MemberVariable.bIsBitfield = true;
+            MemberVariable.BitfieldBitPosition = (int32_t) DataInfo.BitPosition;
+            MemberVariable.BitfieldBitSize = (int32_t) DataInfo.Length;
+            MemberVariable.VariableSize = (int32_t) VariableTypeInfo.Length;
+        } else {
+            //Retrieve normal size
+            MemberVariable.VariableSize = (int32_t) DataInfo.Length;
+        }
 
-            ///Skip over the compiler generated functions, like vector destructors
-            BOOL bIsCompilerGenerated = FALSE;
-            if (SUCCEEDED(ChildFunctionSymbol->get_compilerGenerated(&bIsCompilerGenerated)) && bIsCompilerGenerated) {
-                ChildFunctionSymbol.Release();
-                continue;
-            }
+        OutLayout.MemberVariables.push_back(MemberVariable);
+    }
 
-            FVirtualFunctionDeclaration FuncDeclaration{};
+    ///Iterate the functions defined on the type
+    std::vector<FSymbolHandle> FunctionSymbols;
+    Source.GetChildren(UDTSymbol, ESymbolTag::Function, FunctionSymbols);
 
-            BSTR FunctionName;
-            if (SUCCEEDED(ChildFunctionSymbol->get_name(&FunctionName))) {
-                FuncDeclaration.FunctionName = FunctionName;
-                SysFreeString(FunctionName);
-            }
+    for (FSymbolHandle ChildFunctionSymbol : FunctionSymbols) {
+        FSymbolInfo FunctionInfo{};
+        if (!Source.GetSymbolInfo(ChildFunctionSymbol, FunctionInfo)) {
+            continue;
+        }
 
-            FuncDeclaration.FunctionDeclaration = GenerateFunctionDeclaration(ChildFunctionSymbol);
+        ///We skip over the functions that are not marked as intro virtuals
+        ///If function is not marked as intro it's not the first declaration of the virtual function but rather
+        ///an override, and we do not really care about overrides
+        if (!FunctionInfo.bIsVirtual || !FunctionInfo.bIsIntroVirtual) {
+            continue;
+        }
 
-            DWORD AccessModifier;
-            if (SUCCEEDED(ChildFunctionSymbol->get_access(&AccessModifier))) {
-                if (AccessModifier == CV_public) {
-                    FuncDeclaration.FunctionAccess = EMemberAccess::Public;
-                } else if (AccessModifier == CV_protected) {
-                    FuncDeclaration.FunctionAccess = EMemberAccess::Protected;
-                } else if (AccessModifier == CV_private) {
-                    FuncDeclaration.FunctionAccess = EMemberAccess::Private;
-                }
-            }
+        ///Skip over the compiler generated functions, like vector destructors
+        if (FunctionInfo.bIsCompilerGenerated) {
+            continue;
+        }
 
-            DWORD VirtualBaseOffset;
-            if (SUCCEEDED(ChildFunctionSymbol->get_virtualBaseOffset(&VirtualBaseOffset))) {
-                FuncDeclaration.VirtualTableOffset = (int32_t) VirtualBaseOffset;
-            }
+        FVirtualFunctionDeclaration FuncDeclaration{};
+        FuncDeclaration.FunctionName = Source.GetSymbolName(ChildFunctionSymbol);
+        FuncDeclaration.FunctionDeclaration = GenerateFunctionDeclaration(Source, ChildFunctionSymbol, FunctionInfo);
+        FuncDeclaration.FunctionAccess = FunctionInfo.Access;
+        FuncDeclaration.VirtualTableOffset = FunctionInfo.VirtualBaseOffset;
 
-            OutLayout.VirtualFunctions.push_back(FuncDeclaration);
-            ChildFunctionSymbol.Release();
-        }
+        OutLayout.VirtualFunctions.push_back(FuncDeclaration);
     }
 
-    CComPtr<IDiaSymbol> VirtualTableShape{};
-    if (SUCCEEDED(UDTSymbol->get_virtualTableShape(&VirtualTableShape)) && VirtualTableShape) {
-        DWORD VirtualTableEntriesCount = 0;
-        if (SUCCEEDED(VirtualTableShape->get_count(&VirtualTableEntriesCount))) {
-            OutLayout.VirtualTableEntriesCount = (int32_t) VirtualTableEntriesCount;
-        }
-    }
+    ///Number of the entries of the virtual table shape of the type
+    OutLayout.VirtualTableEntriesCount = (int32_t) UDTInfo.Count;
 }
 
-void ReplaceAllOccurrences(std::wstring& s, const std::wstring& toReplace, const std::wstring& replaceWith) {
-    std::wostringstream oss;
+void ReplaceAllOccurrences(std::string& s, const std::string& toReplace, const std::string& replaceWith) {
+    std::ostringstream oss;
     std::size_t pos = 0;
     std::size_t prevPos = pos;
 
@@ -989,14 +705,14 @@ void ReplaceAllOccurrences(std::wstring& s, const std::wstring& toReplace, const
 }
 
 ///Sanitizes CPP identifier by replacing :: with __, making it usable in filenames and macros
-std::wstring SanitizeCppIdentifier(const std::wstring& Identifier) {
-    std::wstring Result = Identifier;
-    ReplaceAllOccurrences(Result, TEXT("::"), TEXT("__"));
+std::string SanitizeCppIdentifier(const std::string& Identifier) {
+    std::string Result = Identifier;
+    ReplaceAllOccurrences(Result, "::", "__");
     return Result;
 }
 
 void GenerateMemberVariableLayout(FGeneratedFile& GeneratedFile, const FUserDefinedTypeLayout& TypeLayout) {
-    GeneratedFile.Logf(TEXT("#define IMPLEMENT_MEMBER_VARIABLE_LAYOUT_%s \\"), SanitizeCppIdentifier(TypeLayout.ClassName).c_str());
+    GeneratedFile.Logf("#define IMPLEMENT_MEMBER_VARIABLE_LAYOUT_{} \\", SanitizeCppIdentifier(TypeLayout.ClassName));
     EMemberAccess CurrentAccess = EMemberAccess::Unspecified;
 
     for (const FMemberVariable& Variable : TypeLayout.MemberVariables) {
@@ -1004,32 +720,32 @@ void GenerateMemberVariableLayout(FGeneratedFile& GeneratedFile, const FUserDefi
             CurrentAccess = Variable.VariableAccess;
 
             if (CurrentAccess == EMemberAccess::Public) {
-                GeneratedFile.Logf(TEXT("public: \\"));
+                GeneratedFile.Logf("public: \\");
             } else if (CurrentAccess == EMemberAccess::Protected) {
-                GeneratedFile.Logf(TEXT("protected: \\"));
+                GeneratedFile.Logf("protected: \\");
             } else if (CurrentAccess == EMemberAccess::Private) {
-                GeneratedFile.Logf(TEXT("private: \\"));
+                GeneratedFile.Logf("private: \\");
             }
         }
 
         GeneratedFile.BeginIndentLevel();
         if (Variable.bIsBitfield) {
             ///Generate a bitfield
-            GeneratedFile.Logf(TEXT("%s %s: %d; \\"), Variable.VariableType.c_str(), Variable.VariableName.c_str(), Variable.BitfieldBitSize);
+            GeneratedFile.Logf("{} {}: {}; \\", Variable.VariableType, Variable.VariableName, Variable.BitfieldBitSize);
         } else if (Variable.bIsArray) {
             ///Generate an array field
-            GeneratedFile.Logf(TEXT("%s %s[%d]; \\"), Variable.VariableType.c_str(), Variable.VariableName.c_str(), Variable.ArraySize);
+            GeneratedFile.Logf("{} {}[{}]; \\", Variable.VariableType, Variable.VariableName, Variable.ArraySize);
         } else {
             ///Generate a normal field
-            GeneratedFile.Logf(TEXT("%s %s; \\"), Variable.VariableType.c_str(), Variable.VariableName.c_str());
+            GeneratedFile.Logf("{} {}; \\", Variable.VariableType, Variable.VariableName);
         }
         GeneratedFile.EndIndentLevel();
     }
-    GeneratedFile.Logf(TEXT(""));
+    GeneratedFile.Logf("");
 }
 
 void GenerateVirtualTableLayout(FGeneratedFile& GeneratedFile, const FUserDefinedTypeLayout& TypeLayout) {
-    GeneratedFile.Logf(TEXT("#define IMPLEMENT_VIRTUAL_TABLE_LAYOUT_%s \\"), SanitizeCppIdentifier(TypeLayout.ClassName).c_str());
+    GeneratedFile.Logf("#define IMPLEMENT_VIRTUAL_TABLE_LAYOUT_{} \\", SanitizeCppIdentifier(TypeLayout.ClassName));
     EMemberAccess CurrentAccess = EMemberAccess::Unspecified;
 
     for (const FVirtualFunctionDeclaration& Function : TypeLayout.VirtualFunctions) {
@@ -1037,27 +753,27 @@ void GenerateVirtualTableLayout(FGeneratedFile& GeneratedFile, const FUserDefine
             CurrentAccess = Function.FunctionAccess;
 
             if (CurrentAccess == EMemberAccess::Public) {
-                GeneratedFile.Logf(TEXT("public: \\"));
+                GeneratedFile.Logf("public: \\");
             } else if (CurrentAccess == EMemberAccess::Protected) {
-                GeneratedFile.Logf(TEXT("protected: \\"));
+                GeneratedFile.Logf("protected: \\");
             } else if (CurrentAccess == EMemberAccess::Private) {
-                GeneratedFile.Logf(TEXT("private: \\"));
+                GeneratedFile.Logf("private: \\");
             }
         }
 
         GeneratedFile.BeginIndentLevel();
 
-        std::wstring FunctionDeclaration = Function.FunctionDeclaration;
-        ReplaceAllOccurrences(FunctionDeclaration, Printf(TEXT("%s::"), TypeLayout.ClassName.c_str()), TEXT(""));
-        GeneratedFile.Logf(TEXT("%s \\"), FunctionDeclaration.c_str());
+        std::string FunctionDeclaration = Function.FunctionDeclaration;
+        ReplaceAllOccurrences(FunctionDeclaration, Format("{}::", TypeLayout.ClassName), "");
+        GeneratedFile.Logf("{} \\", FunctionDeclaration);
 
         GeneratedFile.EndIndentLevel();
     }
-    GeneratedFile.Logf(TEXT(""));
+    GeneratedFile.Logf("");
 }
 
 void GenerateTopLevelMacroDefinitions(FGeneratedFile& GeneratedFile, const FUserDefinedTypeLayout& TypeLayout) {
-    GeneratedFile.Logf(TEXT("#define VIRTUAL_FUNCTION_COUNT_%s %d"), SanitizeCppIdentifier(TypeLayout.ClassName).c_str(), TypeLayout.VirtualTableEntriesCount);
+    GeneratedFile.Logf("#define VIRTUAL_FUNCTION_COUNT_{} {}", SanitizeCppIdentifier(TypeLayout.ClassName), TypeLayout.VirtualTableEntriesCount);
 }
 
 enum ENoInit { NoInit };
@@ -1073,7 +789,7 @@ struct Foo : Bar {
 };
 
 void GenerateTypeLayoutNoInitConstructor(FGeneratedFile& GeneratedFile, const FUserDefinedTypeLayout& TypeLayout) {
-    GeneratedFile.Logf(TEXT("#define IMPLEMENT_NO_INIT_CONSTRUCTOR_%s \\"), SanitizeCppIdentifier(TypeLayout.ClassName).c_str());
+    GeneratedFile.Logf("#define IMPLEMENT_NO_INIT_CONSTRUCTOR_{} \\", SanitizeCppIdentifier(TypeLayout.ClassName));
     GeneratedFile.BeginIndentLevel();
 
     int32_t NoInitConstructorsNeeded = 0;
@@ -1084,7 +800,7 @@ void GenerateTypeLayoutNoInitConstructor(FGeneratedFile& GeneratedFile, const FU
         NoInitConstructorsNeeded += MemberVariable.bNeedsNoInitConstructorCall;
     }
 
-    GeneratedFile.Logf(TEXT("explicit inline %s(ENoInit)%s \\"), TypeLayout.ClassName.c_str(), NoInitConstructorsNeeded ? TEXT(" :") : TEXT(""));
+    GeneratedFile.Logf("explicit inline {}(ENoInit){} \\", TypeLayout.ClassName, NoInitConstructorsNeeded ? " :" : "");
 
     if (NoInitConstructorsNeeded) {
         GeneratedFile.BeginIndentLevel();
@@ -1095,43 +811,43 @@ void GenerateTypeLayoutNoInitConstructor(FGeneratedFile& GeneratedFile, const FU
         for (const FParentClassInfo& ParentClass : TypeLayout.ParentClasses) {
             if (ParentClass.bHasConstructor) {
                 NoInitConstructorsCalled++;
-                const wchar_t* OptionalComma = NoInitConstructorsCalled < NoInitConstructorsNeeded ? TEXT(",") : TEXT("");
-                GeneratedFile.Logf(TEXT("%s(NoInit)%s \\"), ParentClass.ClassName.c_str(), OptionalComma);
+                const char* OptionalComma = NoInitConstructorsCalled < NoInitConstructorsNeeded ? "," : "";
+                GeneratedFile.Logf("{}(NoInit){} \\", ParentClass.ClassName, OptionalComma);
             }
         }
 
         for (const FMemberVariable& MemberVariable : TypeLayout.MemberVariables) {
             if (MemberVariable.bNeedsNoInitConstructorCall) {
                 NoInitConstructorsCalled++;
-                const wchar_t* OptionalComma = NoInitConstructorsCalled < NoInitConstructorsNeeded ? TEXT(",") : TEXT("");
+                const char* OptionalComma = NoInitConstructorsCalled < NoInitConstructorsNeeded ? "," : "";
 
                 ///Arrays need NoInit constructor called on each of their elements, or it will call default constructor instead
                 ///Which is definitely not what we want there
                 if (MemberVariable.bIsArray && MemberVariable.bIsUDT) {
-                    std::wstring ArrayElementsInitializer;
+                    std::string ArrayElementsInitializer;
                     for (int32_t i = 0; i < MemberVariable.ArraySize; i++) {
-                        ArrayElementsInitializer.append(Printf(TEXT("%s(NoInit)"), MemberVariable.VariableType.c_str()));
+                        FormatTo(ArrayElementsInitializer, "{}(NoInit)", MemberVariable.VariableType);
 
                         if ((i + 1) != MemberVariable.ArraySize) {
-                            ArrayElementsInitializer.append(TEXT(", "));
+                            ArrayElementsInitializer.append(", ");
                         }
                     }
                     ///Array initializers need to be initializer lists, normal curly brackets are not allowed
-                    GeneratedFile.Logf(TEXT("%s{%s}%s \\"), MemberVariable.VariableName.c_str(), ArrayElementsInitializer.c_str(), OptionalComma);
+                    GeneratedFile.Logf("{}{{{}}}{} \\", MemberVariable.VariableName, ArrayElementsInitializer, OptionalComma);
                 } else {
-                    GeneratedFile.Logf(TEXT("%s(NoInit)%s \\"), MemberVariable.VariableName.c_str(), OptionalComma);
+                    GeneratedFile.Logf("{}(NoInit){} \\", MemberVariable.VariableName, OptionalComma);
                 }
             }
         }
         GeneratedFile.EndIndentLevel();
     }
 
-    GeneratedFile.Logf(TEXT("{} \\"));
+    GeneratedFile.Logf("{{}} \\");
     GeneratedFile.EndIndentLevel();
 }
 
 void GenerateTypeLayoutForceInitConstructor(FGeneratedFile& GeneratedFile, const FUserDefinedTypeLayout& TypeLayout) {
-    GeneratedFile.Logf(TEXT("#define IMPLEMENT_FORCE_INIT_CONSTRUCTOR_%s \\"), SanitizeCppIdentifier(TypeLayout.ClassName).c_str());
+    GeneratedFile.Logf("#define IMPLEMENT_FORCE_INIT_CONSTRUCTOR_{} \\", SanitizeCppIdentifier(TypeLayout.ClassName));
     GeneratedFile.BeginIndentLevel();
 
     int32_t ForceInitConstructorsNeeded = 0;
@@ -1142,7 +858,7 @@ void GenerateTypeLayoutForceInitConstructor(FGeneratedFile& GeneratedFile, const
         ForceInitConstructorsNeeded += MemberVariable.bNeedsValueInit;
     }
 
-    GeneratedFile.Logf(TEXT("explicit inline %s(EForceInit)%s \\"), TypeLayout.ClassName.c_str(), ForceInitConstructorsNeeded ? TEXT(" :") : TEXT(""));
+    GeneratedFile.Logf("explicit inline {}(EForceInit){} \\", TypeLayout.ClassName, ForceInitConstructorsNeeded ? " :" : "");
 
     if (ForceInitConstructorsNeeded) {
         GeneratedFile.BeginIndentLevel();
@@ -1153,71 +869,155 @@ void GenerateTypeLayoutForceInitConstructor(FGeneratedFile& GeneratedFile, const
         for (const FParentClassInfo& ParentClass : TypeLayout.ParentClasses) {
             if (!ParentClass.bHasConstructor) {
                 ForceInitConstructorsCalled++;
-                const wchar_t* OptionalComma = ForceInitConstructorsCalled < ForceInitConstructorsNeeded ? TEXT(",") : TEXT("");
-                GeneratedFile.Logf(TEXT("%s()%s \\"), ParentClass.ClassName.c_str(), OptionalComma);
+                const char* OptionalComma = ForceInitConstructorsCalled < ForceInitConstructorsNeeded ? "," : "";
+                GeneratedFile.Logf("{}(){} \\", ParentClass.ClassName, OptionalComma);
             }
         }
 
         for (const FMemberVariable& MemberVariable : TypeLayout.MemberVariables) {
             if (MemberVariable.bNeedsValueInit) {
                 ForceInitConstructorsCalled++;
-                const wchar_t* OptionalComma = ForceInitConstructorsCalled < ForceInitConstructorsNeeded ? TEXT(",") : TEXT("");
+                const char* OptionalComma = ForceInitConstructorsCalled < ForceInitConstructorsNeeded ? "," : "";
 
                 ///Arrays need initializer list used instead of brackets initializer
                 if (MemberVariable.bIsArray) {
-                    std::wstring ArrayElementsInitializer;
+                    std::string ArrayElementsInitializer;
                     for (int32_t i = 0; i < MemberVariable.ArraySize; i++) {
                         ///Only call constructors on UDTs, otherwise substitute the default value directly
                         if (MemberVariable.bIsUDT) {
-                            ArrayElementsInitializer.append(Printf(TEXT("%s(%s)"), MemberVariable.VariableType.c_str(), MemberVariable.ValueInitDefaultValue.c_str()));
+                            FormatTo(ArrayElementsInitializer, "{}({})", MemberVariable.VariableType, MemberVariable.ValueInitDefaultValue);
                         } else {
                             ArrayElementsInitializer.append(MemberVariable.ValueInitDefaultValue);
                         }
                         if ((i + 1) != MemberVariable.ArraySize) {
-                            ArrayElementsInitializer.append(TEXT(", "));
+                            ArrayElementsInitializer.append(", ");
                         }
                     }
-                    GeneratedFile.Logf(TEXT("%s{%s}%s \\"), MemberVariable.VariableName.c_str(), ArrayElementsInitializer.c_str(), OptionalComma);
+                    GeneratedFile.Logf("{}{{{}}}{} \\", MemberVariable.VariableName, ArrayElementsInitializer, OptionalComma);
                 } else {
-                    GeneratedFile.Logf(TEXT("%s(%s)%s \\"), MemberVariable.VariableName.c_str(), MemberVariable.ValueInitDefaultValue.c_str(), OptionalComma);
+                    GeneratedFile.Logf("{}({}){} \\", MemberVariable.VariableName, MemberVariable.ValueInitDefaultValue, OptionalComma);
                 }
             }
         }
         GeneratedFile.EndIndentLevel();
     }
 
-    GeneratedFile.Logf(TEXT("{} \\"));
+    GeneratedFile.Logf("{{}} \\");
     GeneratedFile.EndIndentLevel();
 }
 
-bool GenerateTypeLayoutFile(const std::wstring& OutputDirectory, const CComPtr<IDiaSymbol>& GlobalScope, const std::wstring& UDTName) {
-    CComPtr<IDiaEnumSymbols> SymbolsEnumerator;
-    GlobalScope->findChildrenEx(SymTagUDT, UDTName.c_str(), nsfUndecoratedName, &SymbolsEnumerator);
-
-    CComPtr<IDiaSymbol> UDTSymbol;
-    SymbolsEnumerator->Item(0, &UDTSymbol);
-
-    if (UDTSymbol == NULL) {
-        return false;
+static void GenerateTypeLayoutFile(FGeneratedFile& GeneratedFile, const FUserDefinedTypeLayout& TypeLayout) {
+    GeneratedFile.Logf("/* Generated file for UDT '{}' */", TypeLayout.ClassName);
+    if (!TypeLayout.SourceFilePath.empty()) {
+        GeneratedFile.Logf("/* Declared in '{}' at line {} */", TypeLayout.SourceFilePath, TypeLayout.SourceLineNumber);
     }
-
-    FUserDefinedTypeLayout TypeLayout{};
-    GenerateUserDefinedTypeLayout(UDTSymbol, TypeLayout);
-
-    FGeneratedFile GeneratedFile{OutputDirectory, SanitizeCppIdentifier(TypeLayout.ClassName)};
-    GeneratedFile.Logf(TEXT("/* Generated file for UDT '%s' */"), TypeLayout.ClassName.c_str());
-    GeneratedFile.Logf(TEXT(""));
+    GeneratedFile.Logf("");
     GenerateTopLevelMacroDefinitions(GeneratedFile, TypeLayout);
-    GeneratedFile.Logf(TEXT(""));
+    GeneratedFile.Logf("");
     GenerateMemberVariableLayout(GeneratedFile, TypeLayout);
-    GeneratedFile.Logf(TEXT(""));
+    GeneratedFile.Logf("");
     GenerateVirtualTableLayout(GeneratedFile, TypeLayout);
-    GeneratedFile.Logf(TEXT(""));
+    GeneratedFile.Logf("");
     GenerateTypeLayoutNoInitConstructor(GeneratedFile, TypeLayout);
-    GeneratedFile.Logf(TEXT(""));
+    GeneratedFile.Logf("");
     GenerateTypeLayoutForceInitConstructor(GeneratedFile, TypeLayout);
-    GeneratedFile.Logf(TEXT(""));
-    GeneratedFile.WriteFile();
+    GeneratedFile.Logf("");
+}
+
+static void GenerateVirtualTableRVAFile(FGeneratedFile& GeneratedFile, const FVirtualTableRVALayout& RVALayout) {
+    const std::string SanitizedClassName = SanitizeCppIdentifier(RVALayout.ClassName);
+    GeneratedFile.Logf("/* Generated virtual function RVAs for UDT '{}' */", RVALayout.ClassName);
+    GeneratedFile.Logf("");
+    GeneratedFile.Logf("#define VIRTUAL_TABLE_RVA_{} 0x{:08X}", SanitizedClassName, RVALayout.VirtualTableRVA);
+    GeneratedFile.Logf("");
 
+    ///X-macro invoked with the slot index, the function name and the RVA of every virtual function, in the virtual table order
+    ///RVA is 0 for pure virtual functions and for the functions the linker has not kept
+    GeneratedFile.Logf("#define FOR_EACH_VIRTUAL_FUNCTION_RVA_{}(Macro) \\", SanitizedClassName);
+    GeneratedFile.BeginIndentLevel();
+    for (const FVirtualFunctionRVA& Function : RVALayout.VirtualFunctions) {
+        GeneratedFile.Logf("Macro({}, {}, 0x{:08X}) \\", Function.VirtualTableSlot, Function.FunctionName, Function.FunctionRVA);
+    }
+    GeneratedFile.EndIndentLevel();
+    GeneratedFile.Logf("");
+
+    GeneratedFile.Logf("#define FOR_EACH_CONSTRUCTOR_RVA_{}(Macro) \\", SanitizedClassName);
+    GeneratedFile.BeginIndentLevel();
+    for (uint32_t ConstructorRVA : RVALayout.ConstructorRVAs) {
+        GeneratedFile.Logf("Macro(0x{:08X}) \\", ConstructorRVA);
+    }
+    GeneratedFile.EndIndentLevel();
+    GeneratedFile.Logf("");
+}
+
+void WriteTypeLayoutFile(FOutputDirectory& OutputDirectory, const FUserDefinedTypeLayout& TypeLayout) {
+    FGeneratedFile GeneratedFile{SanitizeCppIdentifier(TypeLayout.ClassName)};
+    GenerateTypeLayoutFile(GeneratedFile, TypeLayout);
+    GeneratedFile.WriteFile(OutputDirectory);
+}
+
+void WriteVirtualTableRVAFile(FOutputDirectory& OutputDirectory, const FVirtualTableRVALayout& RVALayout) {
+    FGeneratedFile GeneratedFile{Format("{}_VTableRVA", SanitizeCppIdentifier(RVALayout.ClassName))};
+    GenerateVirtualTableRVAFile(GeneratedFile, RVALayout);
+    GeneratedFile.WriteFile(OutputDirectory);
+}
+
+std::string GenerateTypeLayoutSection(const FUserDefinedTypeLayout& TypeLayout, const FVirtualTableRVALayout* RVALayout) {
+    const std::string SanitizedClassName = SanitizeCppIdentifier(TypeLayout.ClassName);
+    FGeneratedFile GeneratedFile{SanitizedClassName};
+    GeneratedFile.Logf("#ifndef UVTD_TYPE_SECTION_{}", SanitizedClassName);
+    GeneratedFile.Logf("#define UVTD_TYPE_SECTION_{}", SanitizedClassName);
+    GenerateTypeLayoutFile(GeneratedFile, TypeLayout);
+    if (RVALayout != nullptr) {
+        GenerateVirtualTableRVAFile(GeneratedFile, *RVALayout);
+    }
+    GeneratedFile.Logf("#endif /* UVTD_TYPE_SECTION_{} */", SanitizedClassName);
+    GeneratedFile.Logf("");
+    return GeneratedFile.TakeContents();
+}
+
+void WriteConsolidatedLayoutFile(FOutputDirectory& OutputDirectory, const std::string& FileName, const std::string& DebugFileName, const std::vector<FTypeLayoutSection>& Sections) {
+    ///Offsets and sizes are printed with a fixed width, so the size of the index does not depend on them, and it can be generated before it is known where the sections end up
+    const auto GenerateIndex = [&](size_t SectionsOffset) {
+        FGeneratedFile GeneratedFile{FileName};
+        GeneratedFile.Logf("/* Generated layouts of the types dumped from '{}' */", DebugFileName);
+        GeneratedFile.Logf("");
+        GeneratedFile.Logf("/* Index of the type sections, the offsets and the sizes are in bytes from the start of this file");
+        GeneratedFile.Logf(" *     Offset       Size  Type");
+        size_t SectionOffset = SectionsOffset;
+        for (const FTypeLayoutSection& Section : Sections) {
+            GeneratedFile.Logf(" * {:010} {:010}  {}", SectionOffset, Section.Contents.size(), Section.ClassName);
+            SectionOffset += Section.Contents.size();
+        }
+        GeneratedFile.Logf(" */");
+        GeneratedFile.Logf("");
+        return GeneratedFile.TakeContents();
+    };
+    std::string FileContents = GenerateIndex(0);
+    FileContents = GenerateIndex(FileContents.size());
+
+    size_t TotalSize = FileContents.size();
+    for (const FTypeLayoutSection& Section : Sections) {
+        TotalSize += Section.Contents.size();
+    }
+    FileContents.reserve(TotalSize);
+    for (const FTypeLayoutSection& Section : Sections) {
+        FileContents.append(Section.Contents);
+    }
+    OutputDirectory.WriteFile(Format("{}.h", FileName), std::move(FileContents));
+}
+
+bool GenerateTypeLayoutFile(FOutputDirectory& OutputDirectory, const ISymbolSource& Source, const std::string& UDTName) {
+    const FSymbolHandle UDTSymbol = Source.FindUserDefinedType(UDTName);
+    if (!UDTSymbol.IsValid()) {
+        return false;
+    }
+    GenerateTypeLayoutFile(OutputDirectory, Source, UDTSymbol);
     return true;
-}
\ No newline at end of file
+}
+
+void GenerateTypeLayoutFile(FOutputDirectory& OutputDirectory, const ISymbolSource& Source, FSymbolHandle UDTSymbol) {
+    FUserDefinedTypeLayout TypeLayout{};
+    GenerateUserDefinedTypeLayout(Source, UDTSymbol, TypeLayout);
+    WriteTypeLayoutFile(OutputDirectory, TypeLayout);
+}
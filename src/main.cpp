@@ -1,16 +1,32 @@
 #include <string>
 #include <fstream>
-#include <Windows.h>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <algorithm>
+#include <charconv>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include "Platform.h"
+#include "DumpLog.h"
+#include "PDBSymbolSource.h"
+#include "TypeLayoutGenerator.h"
+#include "DwarfSymbolSource.h"
+#include "ParallelFor.h"
+#include "StringConversion.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
 #include <Psapi.h>
 #include <atlbase.h>
 #include <dia2.h>
 #include <DbgHelp.h>
-#include <filesystem>
-#include <iostream>
-
-///From TypeLayoutGenerator.cpp
-///Yes I know I am a bad person for not making a header file
-bool GenerateTypeLayoutFile(const std::wstring& OutputDirectory, const CComPtr<IDiaSymbol>& GlobalScope, const std::wstring& UDTName);
+#include "DiaSymbolSource.h"
 
 HRESULT CoCreateDiaDataSource(HMODULE diaDllHandle, CComPtr<IDiaDataSource>& OutDataSource) {
     auto DllGetClassObject = (BOOL (WINAPI*)(REFCLSID, REFIID, LPVOID *)) GetProcAddress(diaDllHandle, "DllGetClassObject");
@@ -28,6 +44,7 @@ HRESULT CoCreateDiaDataSource(HMODULE diaDllHandle, CComPtr<IDiaDataSource>& Out
     }
     return S_OK;
 }
+#endif
 
 enum class ETypeSelectorImportance {
     Normal,
@@ -36,32 +53,43 @@ enum class ETypeSelectorImportance {
 };
 
 struct FTypeSelector {
-    std::wstring TypeName;
+    ///UTF-8 name of the type, same as the symbol sources spell them
+    std::string TypeName;
     ETypeSelectorImportance Importance;
 };
 
+///UTF-8 byte order mark some editors put at the start of the file
+static constexpr std::string_view UTF8ByteOrderMark = "\xEF\xBB\xBF";
+
+///File is read as the UTF-8 bytes, the wide streams would decode it with the locale of the process instead
 bool ReadTypesToDump(const std::wstring& FileName, std::vector<FTypeSelector>& OutTypesToDump) {
-    std::wifstream FileStream{FileName};
+    std::ifstream FileStream{std::filesystem::path{FileName}, std::ios::binary};
     if (!FileStream.good()) {
         return false;
     }
 
-    while (!FileStream.eof()) {
-        std::wstring FileReadLine;
-        std::getline(FileStream, FileReadLine);
+    std::string FileReadLine;
+    for (bool bIsFirstLine = true; std::getline(FileStream, FileReadLine); bIsFirstLine = false) {
+        if (bIsFirstLine && FileReadLine.starts_with(UTF8ByteOrderMark)) {
+            FileReadLine.erase(0, UTF8ByteOrderMark.size());
+        }
+        ///Files written on Windows end their lines with CRLF
+        if (!FileReadLine.empty() && FileReadLine.back() == '\r') {
+            FileReadLine.pop_back();
+        }
 
         ///Skip empty lines and comments starting with a #
         if (!FileReadLine.empty() && FileReadLine[0] != '#') {
             ETypeSelectorImportance Importance = ETypeSelectorImportance::Normal;
-            wchar_t FirstSymbol = FileReadLine[0];
+            const char FirstSymbol = FileReadLine[0];
 
             ///Optional type declarations start with a question mark
-            if (FirstSymbol == TEXT('?')) {
+            if (FirstSymbol == '?') {
                 Importance = ETypeSelectorImportance::Optional;
                 FileReadLine.erase(0, 1);
             }
             ///Important type declarations are prefixed with an exclamination mark
-            if (FirstSymbol == TEXT('!')) {
+            if (FirstSymbol == '!') {
                 Importance = ETypeSelectorImportance::Important;
                 FileReadLine.erase(0, 1);
             }
@@ -71,50 +99,279 @@ bool ReadTypesToDump(const std::wstring& FileName, std::vector<FTypeSelector>& O
     return !OutTypesToDump.empty();
 }
 
-bool DumpTypesForDebugFile(const std::filesystem::path& PDBFilePath, const std::filesystem::path& OutputFolderPath, HMODULE DiaModuleHandle, const std::vector<FTypeSelector>& TypesToDump) {
+///Returns the number of bytes of the physical memory the process currently occupies, or 0 if the platform does not tell us
+uint64_t GetResidentMemorySize() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS MemoryCounters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &MemoryCounters, sizeof(MemoryCounters))) {
+        return MemoryCounters.WorkingSetSize;
+    }
+    return 0;
+#else
+    ///Second field of statm is the resident set size in pages
+    std::ifstream StatmStream{"/proc/self/statm"};
+    uint64_t VirtualPages = 0, ResidentPages = 0;
+    if (!(StatmStream >> VirtualPages >> ResidentPages)) {
+        return 0;
+    }
+    return ResidentPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+/**
+ * Dumps the debug files on up to the given number of worker threads, every file getting its own independent session
+ * Before a file is opened, the resident memory of the process (or the sizes of the files being dumped, if larger, as their pages
+ * are only faulted in over time) plus the size of the file is checked against the memory budget, and the file waits for the running
+ * dumps to finish if it does not fit. A file is always let through when nothing else is running, so an oversized file is still dumped
+ * Every file is dumped even when some of them fail. Returns false if any of them did
+ */
+bool RunDumpJobs(const std::vector<std::filesystem::path>& DebugFilePaths, size_t NumJobs, uint64_t MemoryBudget, const std::function<bool(const std::filesystem::path&)>& DumpDebugFile) {
+    std::mutex SchedulerLock;
+    std::condition_variable JobFinishedCondition;
+    size_t NextFileIndex = 0;
+    size_t NumRunningJobs = 0;
+    uint64_t RunningJobsFileSize = 0;
+    bool bAllSucceeded = true;
+
+    const auto WorkerMain = [&]() {
+        std::unique_lock Lock{SchedulerLock};
+        while (NextFileIndex < DebugFilePaths.size()) {
+            const std::filesystem::path& DebugFilePath = DebugFilePaths[NextFileIndex];
+            std::error_code ErrorCode;
+            uint64_t FileSize = std::filesystem::file_size(DebugFilePath, ErrorCode);
+            ///File which size cannot be read does not count against the budget, its dump reports the failure to open it
+            if (ErrorCode) {
+                FileSize = 0;
+            }
+
+            if (MemoryBudget != 0 && NumRunningJobs != 0 && std::max(GetResidentMemorySize(), RunningJobsFileSize) + FileSize > MemoryBudget) {
+                JobFinishedCondition.wait(Lock);
+                continue;
+            }
+            NextFileIndex++;
+            NumRunningJobs++;
+            RunningJobsFileSize += FileSize;
+            Lock.unlock();
+
+            const bool bSucceeded = DumpDebugFile(DebugFilePath);
+
+            Lock.lock();
+            NumRunningJobs--;
+            RunningJobsFileSize -= FileSize;
+            bAllSucceeded &= bSucceeded;
+            JobFinishedCondition.notify_all();
+        }
+    };
+
+    ///Calling thread is one of the workers
+    std::vector<std::thread> WorkerThreads;
+    const size_t NumWorkers = std::min(std::max<size_t>(NumJobs, 1), DebugFilePaths.size());
+    for (size_t i = 1; i < NumWorkers; i++) {
+        WorkerThreads.emplace_back(WorkerMain);
+    }
+    WorkerMain();
+    for (std::thread& WorkerThread : WorkerThreads) {
+        WorkerThread.join();
+    }
+    return bAllSucceeded;
+}
+
+///Layouts generated for a single dumped type, kept until the files of all of the types are written
+struct FDumpedTypeLayout {
+    FUserDefinedTypeLayout TypeLayout{};
+    ///RVA layout is only generated by the symbol sources that know the RVAs, i.e. the native reader of the PDBs with symbols and section headers,
+    ///and only for the classes whose vftable symbol has been found
+    bool bHasRVALayout{false};
+    FVirtualTableRVALayout RVALayout{};
+};
+
+/**
+ * Resolves all of the selected types in one batch and then dumps the found ones, shared between the DIA, the native PDB and the DWARF readers
+ * Types are identified by the ids of the reader they have been resolved with, 0 meaning that the type does not exist
+ * When the reader can be queried from several threads, the layouts are generated as separate tasks on the shared thread pool, and the files
+ * are written the same way once all of them are done. Types resolving to the same file only have it written by the last one of them,
+ * same as it would be overwritten by a serial run, so the output does not depend on the order the tasks happen to finish in
+ * Files with the same contents as the last time they have been dumped are not touched, so the builds including them stay up to date
+ */
+bool DumpTypesWithGenerator(const std::filesystem::path& PDBFilePath, const std::filesystem::path& OutputFolderPath, const std::vector<FTypeSelector>& TypesToDump, bool bWriteSingleHeader, const FDumpLog& Log,
+    bool bGenerateInParallel, const std::function<void(const std::vector<std::string>&, std::vector<uint64_t>&)>& ResolveTypes, const std::function<void(uint64_t, FDumpedTypeLayout&)>& GenerateLayout) {
+    FOutputDirectory OutputDir{OutputFolderPath / PDBFilePath.filename().replace_extension()};
+    if (!OutputDir.Open()) {
+        Log.Error(TEXT("Failed to create the output directory ") + OutputDir.GetPath().wstring());
+        return false;
+    }
+
+    Log.Info(TEXT("Begin dumping types for PDB file ") + PDBFilePath.filename().wstring());
+    std::vector<std::string> TypeNames;
+    TypeNames.reserve(TypesToDump.size());
+    for (const FTypeSelector& TypeName : TypesToDump) {
+        TypeNames.push_back(TypeName.TypeName);
+    }
+    std::vector<uint64_t> ResolvedTypes;
+    ResolveTypes(TypeNames, ResolvedTypes);
+
+    ///Missing types are reported before anything is written, so a missing Important type does not leave a partial dump behind
+    bool bIsImportantTypeMissing = false;
+    for (size_t i = 0; i < TypesToDump.size(); i++) {
+        const FTypeSelector& TypeName = TypesToDump[i];
+        if (ResolvedTypes[i] != 0 || TypeName.Importance == ETypeSelectorImportance::Optional) {
+            continue;
+        }
+        Log.Info(TEXT("Failed to dump type ") + ConvertUTF8ToWide(TypeName.TypeName));
+        if (TypeName.Importance == ETypeSelectorImportance::Important) {
+            Log.Info(TEXT("Type ") + ConvertUTF8ToWide(TypeName.TypeName) + TEXT(" was marked as Important (!)"));
+            bIsImportantTypeMissing = true;
+        }
+    }
+    if (bIsImportantTypeMissing) {
+        Log.Info(TEXT("Types marked as Important (!) are missing. Aborting the dump."));
+        return false;
+    }
+
+    std::vector<uint64_t> DumpedTypes;
+    for (size_t i = 0; i < TypesToDump.size(); i++) {
+        if (ResolvedTypes[i] != 0) {
+            Log.Info(TEXT("Dumping type ") + ConvertUTF8ToWide(TypesToDump[i].TypeName));
+            DumpedTypes.push_back(ResolvedTypes[i]);
+        }
+    }
+
+    const auto RunTasks = [bGenerateInParallel](size_t NumTasks, const std::function<void(size_t)>& Task) {
+        if (bGenerateInParallel) {
+            ParallelFor(NumTasks, Task);
+        } else {
+            for (size_t TaskIndex = 0; TaskIndex < NumTasks; TaskIndex++) {
+                Task(TaskIndex);
+            }
+        }
+    };
+    std::vector<FDumpedTypeLayout> DumpedLayouts(DumpedTypes.size());
+    RunTasks(DumpedTypes.size(), [&](size_t TypeIndex) {
+        GenerateLayout(DumpedTypes[TypeIndex], DumpedLayouts[TypeIndex]);
+    });
+
+    ///Later types win the files they share with the earlier ones, which covers the same type being selected more than once too
+    std::unordered_map<std::string, size_t> FileOwners;
+    for (size_t TypeIndex = 0; TypeIndex < DumpedLayouts.size(); TypeIndex++) {
+        FileOwners.insert_or_assign(SanitizeCppIdentifier(DumpedLayouts[TypeIndex].TypeLayout.ClassName), TypeIndex);
+    }
+    std::vector<size_t> WrittenTypes;
+    for (size_t TypeIndex = 0; TypeIndex < DumpedLayouts.size(); TypeIndex++) {
+        if (FileOwners[SanitizeCppIdentifier(DumpedLayouts[TypeIndex].TypeLayout.ClassName)] == TypeIndex) {
+            WrittenTypes.push_back(TypeIndex);
+        }
+    }
+    if (bWriteSingleHeader) {
+        ///Sections are generated in parallel and then joined in the order of the selected types, the same types a header per type run would write
+        std::vector<FTypeLayoutSection> Sections(WrittenTypes.size());
+        RunTasks(WrittenTypes.size(), [&](size_t WrittenTypeIndex) {
+            const FDumpedTypeLayout& DumpedLayout = DumpedLayouts[WrittenTypes[WrittenTypeIndex]];
+            Sections[WrittenTypeIndex].ClassName = DumpedLayout.TypeLayout.ClassName;
+            Sections[WrittenTypeIndex].Contents = GenerateTypeLayoutSection(DumpedLayout.TypeLayout, DumpedLayout.bHasRVALayout ? &DumpedLayout.RVALayout : nullptr);
+        });
+        const std::filesystem::path DebugFileStem = PDBFilePath.filename().replace_extension();
+        WriteConsolidatedLayoutFile(OutputDir, ConvertWideToUTF8(DebugFileStem.wstring()), ConvertWideToUTF8(PDBFilePath.filename().wstring()), Sections);
+    } else {
+        RunTasks(WrittenTypes.size(), [&](size_t WrittenTypeIndex) {
+            const FDumpedTypeLayout& DumpedLayout = DumpedLayouts[WrittenTypes[WrittenTypeIndex]];
+            WriteTypeLayoutFile(OutputDir, DumpedLayout.TypeLayout);
+            if (DumpedLayout.bHasRVALayout) {
+                WriteVirtualTableRVAFile(OutputDir, DumpedLayout.RVALayout);
+            }
+        });
+    }
+    ///Files are written in the background while the rest of them are being generated, and only waited for here
+    const bool bAllFilesWritten = OutputDir.WaitForPendingWrites();
+    for (const std::string& FailedFileName : OutputDir.GetFailedFileNames()) {
+        Log.Error(TEXT("Failed to write the generated file ") + (OutputDir.GetPath() / ConvertUTF8ToPath(FailedFileName)).wstring());
+    }
+    if (!OutputDir.SaveManifest()) {
+        Log.Error(TEXT("Failed to save the output manifest into ") + OutputDir.GetPath().wstring());
+    }
+    Log.Info(std::to_wstring(OutputDir.GetNumWrittenFiles()) + TEXT(" files written, ") + std::to_wstring(OutputDir.GetNumUnchangedFiles()) + TEXT(" files unchanged"));
+
+    Log.Info(TEXT("Finished dumping types for PDB file ") + PDBFilePath.filename().wstring());
+    return bAllFilesWritten;
+}
+
+///Dumps the selected types of the symbol source. Every name is resolved up front through the hashed name lookup of the source
+bool DumpTypesWithSymbolSource(const std::filesystem::path& PDBFilePath, const std::filesystem::path& OutputFolderPath, const std::vector<FTypeSelector>& TypesToDump, bool bWriteSingleHeader, const FDumpLog& Log, const ISymbolSource& SymbolSource) {
+    const auto ResolveTypes = [&](const std::vector<std::string>& TypeNames, std::vector<uint64_t>& OutResolvedTypes) {
+        for (const std::string& TypeName : TypeNames) {
+            OutResolvedTypes.push_back(SymbolSource.FindUserDefinedType(TypeName).Id);
+        }
+    };
+    return DumpTypesWithGenerator(PDBFilePath, OutputFolderPath, TypesToDump, bWriteSingleHeader, Log, SymbolSource.SupportsConcurrentAccess(), ResolveTypes, [&](uint64_t UDTSymbol, FDumpedTypeLayout& OutLayout) {
+        GenerateUserDefinedTypeLayout(SymbolSource, FSymbolHandle{UDTSymbol}, OutLayout.TypeLayout);
+        OutLayout.bHasRVALayout = SymbolSource.GenerateVirtualTableRVALayout(FSymbolHandle{UDTSymbol}, OutLayout.RVALayout);
+    });
+}
+
+#ifdef _WIN32
+bool DumpTypesForDebugFile(const std::filesystem::path& PDBFilePath, const std::filesystem::path& OutputFolderPath, HMODULE DiaModuleHandle, const std::vector<FTypeSelector>& TypesToDump, bool bWriteSingleHeader, const FDumpLog& Log) {
     CComPtr<IDiaDataSource> DiaDataSource;
 
     if (FAILED(CoCreateDiaDataSource(DiaModuleHandle, DiaDataSource))) {
-        std::wcerr << TEXT("Failed to create DIA data source from dia DLL handle") << std::endl;
-        exit(1);
+        Log.Error(TEXT("Failed to create DIA data source from dia DLL handle"));
+        return false;
     }
 
     if (FAILED(DiaDataSource->loadDataFromPdb(PDBFilePath.wstring().c_str()))) {
-        std::wcerr << TEXT("Failed to load data from PDB file ") << PDBFilePath.wstring() << std::endl;
+        Log.Error(TEXT("Failed to load data from PDB file ") + PDBFilePath.wstring());
         return false;
     }
 
     CComPtr<IDiaSession> DiaSession;
     if (FAILED(DiaDataSource->openSession(&DiaSession))) {
-        std::wcerr << TEXT("Failed to open DIA session for PDB file ") << PDBFilePath.wstring() << std::endl;
+        Log.Error(TEXT("Failed to open DIA session for PDB file ") + PDBFilePath.wstring());
         return false;
     }
 
     CComPtr<IDiaSymbol> GlobalScopeSymbol;
     if (FAILED(DiaSession->get_globalScope(&GlobalScopeSymbol))) {
-        std::wcerr << TEXT("Failed to retrieve DIA global scope symbol for PDB file ") << PDBFilePath.wstring() << std::endl;
+        Log.Error(TEXT("Failed to retrieve DIA global scope symbol for PDB file ") + PDBFilePath.wstring());
         return false;
     }
 
-    std::filesystem::path OutputDir = OutputFolderPath / PDBFilePath.filename().replace_extension();
-    create_directories(OutputDir);
+    const FDiaSymbolSource SymbolSource{DiaSession, GlobalScopeSymbol};
+    return DumpTypesWithSymbolSource(PDBFilePath, OutputFolderPath, TypesToDump, bWriteSingleHeader, Log, SymbolSource);
+}
+#endif
 
-    std::wcout << TEXT("Begin dumping types for PDB file ") << PDBFilePath.filename().wstring() << std::endl;
-    for (const FTypeSelector& TypeName : TypesToDump) {
-        std::wcout << TEXT("Dumping type ") << TypeName.TypeName << std::endl;
-        if (!GenerateTypeLayoutFile(OutputDir.wstring(), GlobalScopeSymbol, TypeName.TypeName)) {
-            if (TypeName.Importance != ETypeSelectorImportance::Optional) {
-                std::wcout << TEXT("Failed to dump type ") << TypeName.TypeName << std::endl;
-            }
-            if (TypeName.Importance == ETypeSelectorImportance::Important) {
-                std::wcout << TEXT("Type was marked as Important (!). Aborting the dump.") << std::endl;
-                return false;
-            }
-        }
+bool DumpTypesForDebugFileNative(const std::filesystem::path& PDBFilePath, const std::filesystem::path& OutputFolderPath, const std::vector<FTypeSelector>& TypesToDump, bool bWriteSingleHeader, const FDumpLog& Log) {
+    FPDBSymbolSource SymbolSource;
+    if (!SymbolSource.Open(PDBFilePath, Log)) {
+        Log.Error(TEXT("Failed to load data from PDB file ") + PDBFilePath.wstring());
+        return false;
+    }
+
+    return DumpTypesWithSymbolSource(PDBFilePath, OutputFolderPath, TypesToDump, bWriteSingleHeader, Log, SymbolSource);
+}
+
+///Dumps the types from the DWARF debug information of the ELF file, either the binary itself or the .debug file split from it
+bool DumpTypesForDebugFileDwarf(const std::filesystem::path& ELFFilePath, const std::filesystem::path& OutputFolderPath, const std::vector<FTypeSelector>& TypesToDump, bool bWriteSingleHeader, const FDumpLog& Log) {
+    FDwarfSymbolSource SymbolSource;
+    if (!SymbolSource.Open(ELFFilePath, Log)) {
+        Log.Error(TEXT("Failed to load DWARF debug information from ELF file ") + ELFFilePath.wstring());
+        return false;
     }
 
-    std::wcout << TEXT("Finished dumping types for PDB file ") << PDBFilePath.filename().wstring() << std::endl;
-    return true;
+    return DumpTypesWithSymbolSource(ELFFilePath, OutputFolderPath, TypesToDump, bWriteSingleHeader, Log, SymbolSource);
+}
+
+///Parses the value of the numeric command line argument. Returns false if the value is not a whole non-negative number
+bool ParseNumericArgument(std::string_view Value, uint64_t& OutValue) {
+    const char* ValueEnd = Value.data() + Value.size();
+    const auto [ParseEnd, ErrorCode] = std::from_chars(Value.data(), ValueEnd, OutValue);
+    return ErrorCode == std::errc{} && ParseEnd == ValueEnd;
+}
+
+void PrintUsage() {
+    std::wcerr << TEXT("Usage: UnrealVTableDumper [--native] [--single-header] [--jobs N] [--memory-budget MB]") << std::endl;
+    std::wcerr << TEXT("  --native             read the PDB files with the native reader instead of DIA") << std::endl;
+    std::wcerr << TEXT("  --single-header      write all of the types of a debug file into a single header") << std::endl;
+    std::wcerr << TEXT("  --jobs N             dump up to N debug files at the same time") << std::endl;
+    std::wcerr << TEXT("  --memory-budget MB   hold back opening another debug file while the resident memory is over MB") << std::endl;
 }
 
 int main(int argc, const char** argv) {
@@ -124,13 +381,56 @@ int main(int argc, const char** argv) {
 
     std::filesystem::path InputPDBsFolder = CurrentDirectory / TEXT("GameDebugFiles");
     std::filesystem::path OutputFolder = CurrentDirectory / TEXT("Output");
-    std::filesystem::path DiaDllPath = CurrentDirectory / TEXT("msdia140.dll");
 
-    HMODULE DiaDllHandle = LoadLibraryW(DiaDllPath.wstring().c_str());
-    if (DiaDllHandle == nullptr) {
-        std::wcout << TEXT("Failed to load msdia140.dll file, make sure it's in the run director at ") << DiaDllPath << std::endl;
-        return 1;
+    ///--native reads the type records straight from the PDB file instead of going through DIA
+    ///DIA is only available on Windows, so everywhere else the native reader is always used
+    ///--jobs N dumps up to N debug files at the same time, and --memory-budget M (in MB) holds back opening another one
+    ///while it would take the resident memory of the process over M
+    ///--single-header writes all of the dumped types of a debug file into a single header named after it, instead of a header or two per type
+    [[maybe_unused]] bool bUseNativeReader = false;
+    bool bWriteSingleHeader = false;
+    size_t NumJobs = 1;
+    uint64_t MemoryBudget = 0;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view Argument{argv[i]};
+        if (Argument == "--native") {
+            bUseNativeReader = true;
+        } else if (Argument == "--single-header") {
+            bWriteSingleHeader = true;
+        } else if (Argument == "--jobs" || Argument == "--memory-budget") {
+            uint64_t Value = 0;
+            if (i + 1 >= argc || !ParseNumericArgument(argv[++i], Value)) {
+                std::wcerr << TEXT("Argument ") << ConvertUTF8ToWide(Argument) << TEXT(" expects a whole number") << std::endl;
+                PrintUsage();
+                return 1;
+            }
+            if (Argument == "--jobs") {
+                NumJobs = std::max<size_t>(static_cast<size_t>(Value), 1);
+            } else if (Value > UINT64_MAX / (1024 * 1024)) {
+                std::wcerr << TEXT("Memory budget of ") << Value << TEXT(" MB is too large") << std::endl;
+                PrintUsage();
+                return 1;
+            } else {
+                MemoryBudget = Value * 1024 * 1024;
+            }
+        } else {
+            std::wcerr << TEXT("Unknown argument ") << ConvertUTF8ToWide(Argument) << std::endl;
+            PrintUsage();
+            return 1;
+        }
+    }
+
+#ifdef _WIN32
+    std::filesystem::path DiaDllPath = CurrentDirectory / TEXT("msdia140.dll");
+    HMODULE DiaDllHandle = nullptr;
+    if (!bUseNativeReader) {
+        DiaDllHandle = LoadLibraryW(DiaDllPath.wstring().c_str());
+        if (DiaDllHandle == nullptr) {
+            std::wcout << TEXT("Failed to load msdia140.dll file, make sure it's in the run director at ") << DiaDllPath << std::endl;
+            return 1;
+        }
     }
+#endif
 
     std::vector<FTypeSelector> TypesToDump;
     if (!ReadTypesToDump(TEXT("TypesToDump.txt"), TypesToDump)) {
@@ -138,16 +438,41 @@ int main(int argc, const char** argv) {
         return 1;
     }
 
-    std::wcout << TEXT("Scanning the input directory ") << InputPDBsFolder.wstring() << TEXT(" for PDB files") << std::endl;
+    std::wcout << TEXT("Scanning the input directory ") << InputPDBsFolder.wstring() << TEXT(" for PDB and ELF debug files") << std::endl;
+    std::vector<std::filesystem::path> DebugFilePaths;
     for (auto& DirectoryEntry : std::filesystem::directory_iterator{InputPDBsFolder}) {
-        ///We are only interested in regular PDB files
-        if (DirectoryEntry.is_regular_file() && DirectoryEntry.path().extension() == TEXT(".pdb")) {
-
-            if (!DumpTypesForDebugFile(DirectoryEntry.path(), OutputFolder, DiaDllHandle, TypesToDump)) {
-                std::wcout << TEXT("Failed to dump types for debug file ") << DirectoryEntry.path().wstring() << std::endl;
-                return 1;
-            }
+        ///We are only interested in regular PDB files, and in the ELF files carrying the DWARF debug information of the Linux builds
+        if (!DirectoryEntry.is_regular_file()) {
+            continue;
+        }
+        ///DWARF packages are ELF files too, but they are read together with the file they belong to
+        if (DirectoryEntry.path().extension() == TEXT(".pdb") || (DirectoryEntry.path().extension() != TEXT(".dwp") && FELFFile::IsELFFile(DirectoryEntry.path()))) {
+            DebugFilePaths.push_back(DirectoryEntry.path());
         }
     }
-    return 0;
-}
\ No newline at end of file
+    ///Directory order is unspecified, files are started in the order of their names
+    std::sort(DebugFilePaths.begin(), DebugFilePaths.end());
+
+    const bool bAllSucceeded = RunDumpJobs(DebugFilePaths, NumJobs, MemoryBudget, [&](const std::filesystem::path& DebugFilePath) {
+        const FDumpLog Log{DebugFilePath, NumJobs > 1};
+        bool bDumpSucceeded = true;
+
+        if (DebugFilePath.extension() == TEXT(".pdb")) {
+#ifdef _WIN32
+            bDumpSucceeded = bUseNativeReader ?
+                DumpTypesForDebugFileNative(DebugFilePath, OutputFolder, TypesToDump, bWriteSingleHeader, Log) :
+                DumpTypesForDebugFile(DebugFilePath, OutputFolder, DiaDllHandle, TypesToDump, bWriteSingleHeader, Log);
+#else
+            bDumpSucceeded = DumpTypesForDebugFileNative(DebugFilePath, OutputFolder, TypesToDump, bWriteSingleHeader, Log);
+#endif
+        } else {
+            bDumpSucceeded = DumpTypesForDebugFileDwarf(DebugFilePath, OutputFolder, TypesToDump, bWriteSingleHeader, Log);
+        }
+
+        if (!bDumpSucceeded) {
+            Log.Info(TEXT("Failed to dump types for debug file ") + DebugFilePath.wstring());
+        }
+        return bDumpSucceeded;
+    });
+    return bAllSucceeded ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+#include "AsyncFileWriter.h"
+#include "DwarfSymbolSource.h"
+#include "OutputFile.h"
+#include "PDBSymbolSource.h"
+#include "TypeLayoutGenerator.h"
+#include "TestHarness.h"
+#include <atomic>
+
+static constexpr size_t NumQueuedFiles = 64;
+static constexpr size_t QueuedFileSize = 1000;
+
+///Contents unique to every file, so a buffer written into the wrong file is noticed
+static std::string MakeQueuedFileContents(size_t FileIndex) {
+    std::string Contents = "/* File " + std::to_string(FileIndex) + " */\n";
+    Contents.resize(QueuedFileSize, static_cast<char>('a' + FileIndex % 26));
+    return Contents;
+}
+
+///Queue only fits a few of the files at once, so queueing them keeps waiting for the writer thread to catch up
+static void TestBoundedQueue() {
+    const std::filesystem::path DirectoryPath = MakeEmptyTestDirectory("AsyncFileWriterQueue");
+    std::atomic<size_t> NumSucceededWrites{0};
+    {
+        FAsyncFileWriter FileWriter{4 * QueuedFileSize};
+        for (size_t FileIndex = 0; FileIndex < NumQueuedFiles; FileIndex++) {
+            FileWriter.WriteFile(DirectoryPath / ("File" + std::to_string(FileIndex) + ".h"), MakeQueuedFileContents(FileIndex), [&](bool bSucceeded) {
+                NumSucceededWrites += bSucceeded ? 1 : 0;
+            });
+        }
+        ///Single file larger than the whole queue is still accepted once the queue drains
+        FileWriter.WriteFile(DirectoryPath / "Large.h", std::string(16 * QueuedFileSize, 'L'), [&](bool bSucceeded) {
+            NumSucceededWrites += bSucceeded ? 1 : 0;
+        });
+        ///Files queued before the writer is destroyed are still written
+    }
+    CHECK_EQUAL(NumSucceededWrites.load(), NumQueuedFiles + 1);
+    for (size_t FileIndex = 0; FileIndex < NumQueuedFiles; FileIndex++) {
+        CHECK_EQUAL(ReadFileContents(DirectoryPath / ("File" + std::to_string(FileIndex) + ".h")), MakeQueuedFileContents(FileIndex));
+    }
+    CHECK_EQUAL(ReadFileContents(DirectoryPath / "Large.h"), std::string(16 * QueuedFileSize, 'L'));
+}
+
+///Failed write is reported through the completion instead of being dropped
+static void TestFailedWrite() {
+    const std::filesystem::path DirectoryPath = MakeEmptyTestDirectory("AsyncFileWriterFailure");
+    std::atomic<bool> bReportedFailure{false};
+    {
+        FAsyncFileWriter FileWriter{QueuedFileSize};
+        FileWriter.WriteFile(DirectoryPath / "Missing" / "File.h", MakeQueuedFileContents(0), [&](bool bSucceeded) {
+            bReportedFailure = !bSucceeded;
+        });
+    }
+    CHECK(bReportedFailure.load());
+}
+
+///Existing file is replaced through a temporary file, which does not outlive the write
+static void TestReplacedFile() {
+    const std::filesystem::path DirectoryPath = MakeEmptyTestDirectory("AsyncFileWriterReplace");
+    CHECK(WriteFileContents(DirectoryPath / "File.h", std::string(4 * QueuedFileSize, 'X')));
+    std::atomic<bool> bSucceeded{false};
+    {
+        FAsyncFileWriter FileWriter{QueuedFileSize};
+        FileWriter.WriteFile(DirectoryPath / "File.h", MakeQueuedFileContents(0), [&](bool bWriteSucceeded) {
+            bSucceeded = bWriteSucceeded;
+        });
+    }
+    CHECK(bSucceeded.load());
+    CHECK_EQUAL(ReadFileContents(DirectoryPath / "File.h"), MakeQueuedFileContents(0));
+    size_t NumFiles = 0;
+    for (const auto& DirectoryEntry : std::filesystem::directory_iterator{DirectoryPath}) {
+        CHECK_EQUAL(DirectoryEntry.path().filename(), std::filesystem::path{"File.h"});
+        NumFiles++;
+    }
+    CHECK_EQUAL(NumFiles, size_t{1});
+}
+
+///Compares every file written into the directory with the expected file of the same name, and checks that nothing else has been written
+static void CheckExpectedFiles(const std::filesystem::path& DirectoryPath, const std::filesystem::path& ExpectedDirectoryPath) {
+    size_t NumExpectedFiles = 0;
+    for (const auto& DirectoryEntry : std::filesystem::directory_iterator{ExpectedDirectoryPath}) {
+        CHECK_EQUAL(ReadFileContents(DirectoryPath / DirectoryEntry.path().filename()), ReadFileContents(DirectoryEntry.path()));
+        NumExpectedFiles++;
+    }
+    size_t NumWrittenFiles = 0;
+    for (const auto& DirectoryEntry : std::filesystem::directory_iterator{DirectoryPath}) {
+        NumWrittenFiles += DirectoryEntry.path().filename() != FOutputDirectory::ManifestFileName ? 1 : 0;
+    }
+    CHECK_EQUAL(NumWrittenFiles, NumExpectedFiles);
+}
+
+///Headers of the fixtures are byte for byte the ones a dump of them writes, kept in Fixtures/Expected
+static void TestExpectedLayoutFiles() {
+    const std::filesystem::path DirectoryPath = MakeEmptyTestDirectory("AsyncFileWriterLayouts");
+
+    FDwarfSymbolSource DwarfSource;
+    CHECK(DwarfSource.Open(GetFixturePath("LayoutTypes.elf"), FDumpLog{}));
+    {
+        FOutputDirectory OutputDirectory{DirectoryPath / "LayoutTypes"};
+        CHECK(OutputDirectory.Open());
+        for (const std::string TypeName : {"AActor", "APawn", "FName"}) {
+            CHECK(GenerateTypeLayoutFile(OutputDirectory, DwarfSource, TypeName));
+        }
+        CHECK(OutputDirectory.SaveManifest());
+    }
+    CheckExpectedFiles(DirectoryPath / "LayoutTypes", GetFixturePath("Expected/LayoutTypes"));
+
+    FPDBSymbolSource PDBSource;
+    CHECK(PDBSource.Open(GetFixturePath("VirtualTable.pdb"), FDumpLog{}));
+    {
+        FOutputDirectory OutputDirectory{DirectoryPath / "VirtualTable"};
+        CHECK(OutputDirectory.Open());
+        const FSymbolHandle UDTSymbol = PDBSource.FindUserDefinedType("AActor");
+        FUserDefinedTypeLayout TypeLayout{};
+        GenerateUserDefinedTypeLayout(PDBSource, UDTSymbol, TypeLayout);
+        WriteTypeLayoutFile(OutputDirectory, TypeLayout);
+        FVirtualTableRVALayout RVALayout{};
+        CHECK(PDBSource.GenerateVirtualTableRVALayout(UDTSymbol, RVALayout));
+        WriteVirtualTableRVAFile(OutputDirectory, RVALayout);
+        CHECK(OutputDirectory.SaveManifest());
+    }
+    CheckExpectedFiles(DirectoryPath / "VirtualTable", GetFixturePath("Expected/VirtualTable"));
+}
+
+int main() {
+    TestBoundedQueue();
+    TestFailedWrite();
+    TestReplacedFile();
+    TestExpectedLayoutFiles();
+    return FinishTest("AsyncFileWriterTest");
+}
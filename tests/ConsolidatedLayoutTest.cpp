@@ -0,0 +1,110 @@
+#include "DwarfSymbolSource.h"
+#include "OutputFile.h"
+#include "PDBSymbolSource.h"
+#include "TypeLayoutGenerator.h"
+#include "TestHarness.h"
+#include <algorithm>
+#include <charconv>
+
+///Generates the sections of the given types the same way a --single-header dump does, with the RVAs of the types the source has them for
+static std::vector<FTypeLayoutSection> GenerateSections(const ISymbolSource& Source, const std::vector<std::string>& TypeNames) {
+    std::vector<FTypeLayoutSection> Sections;
+    for (const std::string& TypeName : TypeNames) {
+        const FSymbolHandle UDTSymbol = Source.FindUserDefinedType(TypeName);
+        CHECK(UDTSymbol.IsValid());
+        FUserDefinedTypeLayout TypeLayout{};
+        GenerateUserDefinedTypeLayout(Source, UDTSymbol, TypeLayout);
+        FVirtualTableRVALayout RVALayout{};
+        const bool bHasRVALayout = Source.GenerateVirtualTableRVALayout(UDTSymbol, RVALayout);
+        Sections.push_back(FTypeLayoutSection{TypeLayout.ClassName, GenerateTypeLayoutSection(TypeLayout, bHasRVALayout ? &RVALayout : nullptr)});
+    }
+    return Sections;
+}
+
+///Entry of the index at the top of the consolidated header
+struct FIndexEntry {
+    size_t Offset{0};
+    size_t Size{0};
+    std::string ClassName;
+};
+
+///Parses the " * Offset Size Type" lines of the index comment. Lines that do not parse fail the check and are skipped
+static std::vector<FIndexEntry> ParseIndex(const std::string& FileContents) {
+    static constexpr std::string_view IndexHeader = " *     Offset       Size  Type\n";
+    std::vector<FIndexEntry> Entries;
+    const size_t IndexHeaderOffset = FileContents.find(IndexHeader);
+    CHECK(IndexHeaderOffset != std::string::npos);
+    if (IndexHeaderOffset == std::string::npos) {
+        return Entries;
+    }
+    std::string_view RemainingIndex = std::string_view{FileContents}.substr(IndexHeaderOffset + IndexHeader.size());
+    while (!RemainingIndex.empty() && !RemainingIndex.starts_with(" */")) {
+        const std::string_view Line = RemainingIndex.substr(0, RemainingIndex.find('\n'));
+        RemainingIndex.remove_prefix(std::min(Line.size() + 1, RemainingIndex.size()));
+
+        ///Fixed width fields: " * ", ten digits of the offset, a space, ten digits of the size, two spaces and the name
+        FIndexEntry Entry{};
+        const bool bParsed = Line.size() > 26 && Line.starts_with(" * ") &&
+            std::from_chars(Line.data() + 3, Line.data() + 13, Entry.Offset).ptr == Line.data() + 13 &&
+            std::from_chars(Line.data() + 14, Line.data() + 24, Entry.Size).ptr == Line.data() + 24;
+        CHECK(bParsed);
+        if (bParsed) {
+            Entry.ClassName = std::string{Line.substr(26)};
+            Entries.push_back(std::move(Entry));
+        }
+    }
+    return Entries;
+}
+
+///Every index entry points exactly at its section, and the sections follow the index back to back up to the end of the file
+static void CheckIndexOffsets(const std::string& FileContents, const std::vector<FTypeLayoutSection>& Sections) {
+    const std::vector<FIndexEntry> Entries = ParseIndex(FileContents);
+    CHECK_EQUAL(Entries.size(), Sections.size());
+    if (Entries.size() != Sections.size() || Entries.empty()) {
+        return;
+    }
+    CHECK_EQUAL(Entries.front().Offset, FileContents.find("#ifndef UVTD_TYPE_SECTION_"));
+    for (size_t EntryIndex = 0; EntryIndex < Entries.size(); EntryIndex++) {
+        const FIndexEntry& Entry = Entries[EntryIndex];
+        CHECK_EQUAL(Entry.ClassName, Sections[EntryIndex].ClassName);
+        CHECK_EQUAL(FileContents.substr(Entry.Offset, Entry.Size), Sections[EntryIndex].Contents);
+        CHECK(std::string_view{FileContents}.substr(Entry.Offset).starts_with("#ifndef UVTD_TYPE_SECTION_" + Entry.ClassName + "\n"));
+        const size_t SectionEnd = Entry.Offset + Entry.Size;
+        CHECK_EQUAL(SectionEnd, EntryIndex + 1 < Entries.size() ? Entries[EntryIndex + 1].Offset : FileContents.size());
+    }
+}
+
+///Writes the consolidated header of the sections, checks that it is the only file written and that it matches the expected one
+static void TestConsolidatedFile(const std::string& FileName, const std::string& DebugFileName, const std::vector<FTypeLayoutSection>& Sections) {
+    const std::filesystem::path DirectoryPath = MakeEmptyTestDirectory("ConsolidatedLayout" + FileName);
+    {
+        FOutputDirectory OutputDirectory{DirectoryPath};
+        CHECK(OutputDirectory.Open());
+        WriteConsolidatedLayoutFile(OutputDirectory, FileName, DebugFileName, Sections);
+        CHECK(OutputDirectory.SaveManifest());
+        CHECK_EQUAL(OutputDirectory.GetNumWrittenFiles(), size_t{1});
+    }
+    const std::string FileContents = ReadFileContents(DirectoryPath / (FileName + ".h"));
+    CHECK_EQUAL(FileContents, ReadFileContents(GetFixturePath("Expected/SingleHeader/" + FileName + ".h")));
+    CheckIndexOffsets(FileContents, Sections);
+
+    ///Dumping the same types again leaves the header alone
+    FOutputDirectory OutputDirectory{DirectoryPath};
+    CHECK(OutputDirectory.Open());
+    WriteConsolidatedLayoutFile(OutputDirectory, FileName, DebugFileName, Sections);
+    CHECK(OutputDirectory.SaveManifest());
+    CHECK_EQUAL(OutputDirectory.GetNumWrittenFiles(), size_t{0});
+    CHECK_EQUAL(OutputDirectory.GetNumUnchangedFiles(), size_t{1});
+}
+
+int main() {
+    FDwarfSymbolSource DwarfSource;
+    CHECK(DwarfSource.Open(GetFixturePath("LayoutTypes.elf"), FDumpLog{}));
+    TestConsolidatedFile("LayoutTypes", "LayoutTypes.elf", GenerateSections(DwarfSource, {"AActor", "APawn", "FName"}));
+
+    ///Section of a type with the RVAs carries them too, so the index has to account for them
+    FPDBSymbolSource PDBSource;
+    CHECK(PDBSource.Open(GetFixturePath("VirtualTable.pdb"), FDumpLog{}));
+    TestConsolidatedFile("VirtualTable", "VirtualTable.pdb", GenerateSections(PDBSource, {"AActor"}));
+    return FinishTest("ConsolidatedLayoutTest");
+}
@@ -0,0 +1,267 @@
+#include "DwarfTestHelpers.h"
+#include "ELFFile.h"
+#include "OutputFile.h"
+#include <cstring>
+#include <set>
+#include <thread>
+
+///Reads the unit index section of the package fixture
+static std::vector<FDwarfPackageContribution> ReadPackageIndex(const FELFFile& PackageFile, std::string_view SectionName) {
+    std::vector<FDwarfPackageContribution> Contributions;
+    const FELFSection* IndexSection = PackageFile.FindSection(SectionName);
+    CHECK(IndexSection != nullptr);
+    if (IndexSection != nullptr) {
+        CHECK(ReadDwarfPackageIndex(IndexSection->GetData(), Contributions));
+    }
+    return Contributions;
+}
+
+///Package of the split DWARF build holds a single compile unit and the type units of the three classes, every one of them found by its signature
+static void TestPackageIndex() {
+    FELFFile ELFFile;
+    CHECK(ELFFile.Open(GetFixturePath("LayoutTypesPackaged.elf"), FDumpLog{}));
+    FELFFile PackageFile;
+    CHECK(PackageFile.Open(GetFixturePath("LayoutTypesPackaged.elf.dwp"), FDumpLog{}));
+    const FELFSection* SkeletonInfoSection = ELFFile.FindSection(".debug_info");
+    const FELFSection* PackageInfoSection = PackageFile.FindSection(".debug_info.dwo");
+    CHECK(SkeletonInfoSection != nullptr && PackageInfoSection != nullptr);
+    if (SkeletonInfoSection == nullptr || PackageInfoSection == nullptr) {
+        return;
+    }
+
+    ///Skeleton unit of the file resolves to the compile unit contribution of the same DWO id
+    FDwarfUnitHeader SkeletonHeader{};
+    CHECK(ReadDwarfUnitHeader(SkeletonInfoSection->GetData(), 0, SkeletonHeader));
+    CHECK(SkeletonHeader.UnitType == EDwarfUnitType::Skeleton);
+    const std::vector<FDwarfPackageContribution> CompileUnits = ReadPackageIndex(PackageFile, ".debug_cu_index");
+    CHECK_EQUAL(CompileUnits.size(), size_t{1});
+    for (const FDwarfPackageContribution& Contribution : CompileUnits) {
+        CHECK(Contribution.bHasInfo);
+        CHECK_EQUAL(Contribution.Signature, SkeletonHeader.DwoId);
+        FDwarfUnitHeader UnitHeader{};
+        CHECK(ReadDwarfUnitHeader(PackageInfoSection->GetData(), Contribution.InfoOffset, UnitHeader));
+        CHECK(UnitHeader.UnitType == EDwarfUnitType::SplitCompile);
+        CHECK_EQUAL(UnitHeader.DwoId, SkeletonHeader.DwoId);
+    }
+
+    ///Every type unit sits at the offset its signature is listed with
+    const std::vector<FDwarfPackageContribution> TypeUnits = ReadPackageIndex(PackageFile, ".debug_tu_index");
+    CHECK_EQUAL(TypeUnits.size(), size_t{3});
+    std::set<uint64_t> Signatures;
+    for (const FDwarfPackageContribution& Contribution : TypeUnits) {
+        CHECK(Contribution.bHasInfo);
+        FDwarfUnitHeader UnitHeader{};
+        CHECK(ReadDwarfUnitHeader(PackageInfoSection->GetData(), Contribution.InfoOffset, UnitHeader));
+        CHECK(UnitHeader.UnitType == EDwarfUnitType::SplitType);
+        CHECK_EQUAL(UnitHeader.TypeSignature, Contribution.Signature);
+        Signatures.insert(Contribution.Signature);
+    }
+    CHECK_EQUAL(Signatures.size(), TypeUnits.size());
+
+    ///Index without any units is valid, a truncated one is not
+    std::vector<FDwarfPackageContribution> Contributions;
+    CHECK(ReadDwarfPackageIndex({}, Contributions));
+    const FELFSection* IndexSection = PackageFile.FindSection(".debug_tu_index");
+    if (IndexSection != nullptr) {
+        CHECK(!ReadDwarfPackageIndex(IndexSection->GetData().first(IndexSection->GetData().size() - 1), Contributions));
+    }
+}
+
+///Types read through the package come out exactly as the ones of the build without split DWARF, with the line table of the skeleton unit
+static void TestPackagedLayouts() {
+    CHECK(GenerateLayoutTypesSections(GetFixturePath("LayoutTypesPackaged.elf")) == GenerateLayoutTypesSections(GetFixturePath("LayoutTypes.elf")));
+}
+
+///Without its package the file has none of its types, so it fails to open instead of dumping nothing
+static void TestMissingPackage() {
+    const std::filesystem::path DirectoryPath = MakeEmptyTestDirectory("DwarfSymbolSourceTestFiles");
+    const std::filesystem::path FilePath = DirectoryPath / "LayoutTypesPackaged.elf";
+    std::filesystem::copy_file(GetFixturePath("LayoutTypesPackaged.elf"), FilePath);
+
+    FDwarfSymbolSource Source;
+    CHECK(!Source.Open(FilePath, FDumpLog{}));
+}
+
+///Copy of the fixture with the name of the section changed, so the reader does not find the section and has to do without it
+static std::filesystem::path WriteFileWithoutSection(const std::filesystem::path& DirectoryPath, const std::string& FileName, std::string_view SectionName) {
+    std::string FileContents = ReadFileContents(GetFixturePath(FileName));
+    FELFFileHeader Header{};
+    memcpy(&Header, FileContents.data(), sizeof(Header));
+    FELFSectionHeader NameTableHeader{};
+    memcpy(&NameTableHeader, FileContents.data() + Header.SectionHeaderOffset + Header.SectionNameTableIndex * Header.SectionHeaderEntrySize, sizeof(NameTableHeader));
+    FELFSectionHeader SectionHeader{};
+    CHECK(FindTestSectionHeader(FileContents, SectionName, SectionHeader) != 0);
+    FileContents[NameTableHeader.Offset + SectionHeader.Name] = '_';
+
+    const std::filesystem::path FilePath = DirectoryPath / FileName;
+    CHECK(WriteFileContents(FilePath, FileContents));
+    return FilePath;
+}
+
+/**
+ * Every kind of the name index finds the same definitions the full scan of the units does
+ * The pubtypes and the .gdb_index do not list the nested classes, which are found through the units of their outer class
+ */
+static void TestNameIndexLookups() {
+    struct FNameIndexFixture {
+        std::string FileName;
+        std::string_view SectionName;
+        EDwarfNameIndexKind Kind;
+    };
+    const FNameIndexFixture Fixtures[] = {
+        {"NameIndexTypesDebugNames.elf", ".debug_names", EDwarfNameIndexKind::DebugNames},
+        {"NameIndexTypesGdbIndex.elf", ".gdb_index", EDwarfNameIndexKind::GdbIndex},
+        {"NameIndexTypesPubTypes.elf", ".debug_pubtypes", EDwarfNameIndexKind::PubTypes},
+        {"NameIndexTypesGnuPubTypes.elf", ".debug_gnu_pubtypes", EDwarfNameIndexKind::PubTypes},
+    };
+    const std::filesystem::path DirectoryPath = MakeEmptyTestDirectory("DwarfNameIndexTestFiles");
+
+    for (const FNameIndexFixture& Fixture : Fixtures) {
+        FDwarfSymbolSource IndexedSource;
+        CHECK(IndexedSource.Open(GetFixturePath(Fixture.FileName), FDumpLog{}));
+        CHECK(IndexedSource.GetNameIndex().GetKind() == Fixture.Kind);
+        FDwarfSymbolSource ScannedSource;
+        CHECK(ScannedSource.Open(WriteFileWithoutSection(DirectoryPath, Fixture.FileName, Fixture.SectionName), FDumpLog{}));
+        CHECK(ScannedSource.GetNameIndex().GetKind() == EDwarfNameIndexKind::None);
+
+        ///Types at the namespace scope are listed by the index itself, the nested class is not by all of them
+        std::vector<uint64_t> UnitOffsets;
+        IndexedSource.GetNameIndex().FindTypeUnits("UE::Core::FVector", UnitOffsets);
+        CHECK_EQUAL(UnitOffsets.size(), size_t{1});
+        for (const uint64_t UnitOffset : UnitOffsets) {
+            CHECK(IndexedSource.GetNameIndex().CoversUnit(UnitOffset));
+        }
+        UnitOffsets.clear();
+        IndexedSource.GetNameIndex().FindTypeUnits("UObject::FNested", UnitOffsets);
+        CHECK_EQUAL(UnitOffsets.size(), size_t{1});
+
+        for (const std::string TypeName : {"UE::Core::FVector", "UObject", "UObject::FNested"}) {
+            const FSymbolHandle IndexedSymbol = IndexedSource.FindUserDefinedType(TypeName);
+            CHECK(IndexedSymbol.IsValid());
+            CHECK_EQUAL(IndexedSymbol.Id, ScannedSource.FindUserDefinedType(TypeName).Id);
+        }
+        for (const std::string TypeName : {"FVector", "UE::Core", "UObject::FMissing", "FMissing"}) {
+            CHECK(!IndexedSource.FindUserDefinedType(TypeName).IsValid());
+            CHECK(!ScannedSource.FindUserDefinedType(TypeName).IsValid());
+        }
+    }
+}
+
+///Scopes are split off at the top level only, the separators inside the template arguments are a part of the name
+static void TestQualifiedNameComponents() {
+    CHECK_EQUAL(GetDwarfUnqualifiedName("UE::Core::FVector"), std::string_view{"FVector"});
+    CHECK_EQUAL(GetDwarfEnclosingScopeName("UE::Core::FVector"), std::string_view{"UE::Core"});
+    CHECK_EQUAL(GetDwarfUnqualifiedName("TArray<UE::Core::FVector>"), std::string_view{"TArray<UE::Core::FVector>"});
+    CHECK(GetDwarfEnclosingScopeName("TArray<UE::Core::FVector>").empty());
+    CHECK_EQUAL(GetDwarfEnclosingScopeName("TMap<A::B, C>::FPair"), std::string_view{"TMap<A::B, C>"});
+}
+
+///Names of the classes DuplicateTypes.h defines, with the four digit base 4 suffixes its macros generate
+static std::vector<std::string> GetDuplicateTypeNames() {
+    std::vector<std::string> TypeNames;
+    for (uint32_t TypeIndex = 0; TypeIndex < 256; TypeIndex++) {
+        std::string TypeName = "FDuplicateType";
+        for (int32_t Digit = 3; Digit >= 0; Digit--) {
+            TypeName.push_back(static_cast<char>('0' + (TypeIndex >> (Digit * 2)) % 4));
+        }
+        TypeNames.push_back(std::move(TypeName));
+    }
+    return TypeNames;
+}
+
+/**
+ * Every unit of the file carries its own copy of the shared classes, which the units indexed in parallel collapse into the definition of the first unit
+ * Class the second unit defines differently is reported as conflicting, and keeps the definition of the first unit too
+ */
+static void TestDuplicateDefinitions() {
+    std::wostringstream ErrorOutput;
+    std::wstreambuf* const ErrorBuffer = std::wcerr.rdbuf(ErrorOutput.rdbuf());
+    FDwarfSymbolSource Source;
+    const bool bOpened = Source.Open(GetFixturePath("DuplicateTypes.elf"), FDumpLog{});
+    std::wcerr.rdbuf(ErrorBuffer);
+    CHECK(bOpened);
+    CHECK(ErrorOutput.str().find(L"Found 1 classes with conflicting definitions") != std::wstring::npos);
+
+    ///Entries of the first unit all come before the second unit and the class only it defines
+    const FSymbolHandle SecondUnitType = Source.FindUserDefinedType("FSecondUnitType");
+    CHECK(SecondUnitType.IsValid());
+    for (const std::string& TypeName : GetDuplicateTypeNames()) {
+        const FSymbolHandle UDTSymbol = Source.FindUserDefinedType(TypeName);
+        CHECK(UDTSymbol.IsValid() && UDTSymbol.Id < SecondUnitType.Id);
+    }
+    const FSymbolHandle ConflictingType = Source.FindUserDefinedType("FConflictingType");
+    CHECK(ConflictingType.IsValid() && ConflictingType.Id < SecondUnitType.Id);
+    std::vector<FSymbolHandle> Members;
+    Source.GetChildren(ConflictingType, ESymbolTag::Data, Members);
+    CHECK_EQUAL(Members.size(), size_t{1});
+    if (!Members.empty()) {
+        CHECK_EQUAL(Source.GetSymbolName(Members[0]), std::string{"FirstMember"});
+    }
+}
+
+///Layout sections of the given types, generated starting at the given type and wrapping around, so the threads walk the units in different orders
+static std::vector<std::string> GenerateRotatedLayoutSections(const FDwarfSymbolSource& Source, const std::vector<std::string>& TypeNames, size_t FirstTypeIndex) {
+    std::vector<std::string> LayoutSections(TypeNames.size());
+    for (size_t i = 0; i < TypeNames.size(); i++) {
+        const size_t TypeIndex = (FirstTypeIndex + i) % TypeNames.size();
+        FUserDefinedTypeLayout TypeLayout{};
+        GenerateUserDefinedTypeLayout(Source, Source.FindUserDefinedType(TypeNames[TypeIndex]), TypeLayout);
+        LayoutSections[TypeIndex] = GenerateTypeLayoutSection(TypeLayout, nullptr);
+    }
+    return LayoutSections;
+}
+
+///Threads looking up the types of the same source at once decode every unit only once, and see the same layouts as a single thread does
+static void TestConcurrentLookups() {
+    std::vector<std::string> TypeNames = GetDuplicateTypeNames();
+    TypeNames.push_back("FConflictingType");
+    TypeNames.push_back("FSecondUnitType");
+
+    FDwarfSymbolSource SerialSource;
+    CHECK(SerialSource.Open(GetFixturePath("DuplicateTypes.elf"), FDumpLog{}));
+    const std::vector<std::string> ExpectedSections = GenerateRotatedLayoutSections(SerialSource, TypeNames, 0);
+
+    FDwarfSymbolSource SharedSource;
+    CHECK(SharedSource.Open(GetFixturePath("DuplicateTypes.elf"), FDumpLog{}));
+    constexpr size_t NumThreads = 4;
+    std::vector<std::vector<std::string>> ThreadSections(NumThreads);
+    std::vector<std::thread> Threads;
+    for (size_t ThreadIndex = 0; ThreadIndex < NumThreads; ThreadIndex++) {
+        Threads.emplace_back([&, ThreadIndex]() {
+            ThreadSections[ThreadIndex] = GenerateRotatedLayoutSections(SharedSource, TypeNames, ThreadIndex * TypeNames.size() / NumThreads);
+        });
+    }
+    for (std::thread& Thread : Threads) {
+        Thread.join();
+    }
+    for (const std::vector<std::string>& Sections : ThreadSections) {
+        CHECK(Sections == ExpectedSections);
+    }
+}
+
+///Classes listed as the primary base of each other are followed a limited number of times instead of until the stack runs out
+static void TestCyclicBaseClasses() {
+    FDwarfSymbolSource Source;
+    CHECK(Source.Open(GetFixturePath("CyclicTypes.elf"), FDumpLog{}));
+    for (const std::string TypeName : {"FCyclicFirst", "FCyclicSecond"}) {
+        const FSymbolHandle UDTSymbol = Source.FindUserDefinedType(TypeName);
+        CHECK(UDTSymbol.IsValid());
+        FUserDefinedTypeLayout TypeLayout{};
+        GenerateUserDefinedTypeLayout(Source, UDTSymbol, TypeLayout);
+        CHECK_EQUAL(TypeLayout.ClassName, TypeName);
+        CHECK_EQUAL(TypeLayout.ParentClasses.size(), size_t{1});
+        CHECK_EQUAL(TypeLayout.VirtualTableEntriesCount, int32_t{1});
+    }
+}
+
+int main() {
+    TestPackageIndex();
+    TestPackagedLayouts();
+    TestMissingPackage();
+    TestNameIndexLookups();
+    TestQualifiedNameComponents();
+    TestDuplicateDefinitions();
+    TestConcurrentLookups();
+    TestCyclicBaseClasses();
+    return FinishTest("DwarfSymbolSourceTest");
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "DwarfSymbolSource.h"
+#include "TypeLayoutGenerator.h"
+#include "TestHarness.h"
+#include <cstring>
+
+///Layout sections of the types LayoutTypes.cpp defines, which every build of it has to produce the same, whatever form its DWARF takes
+inline std::vector<std::string> GenerateLayoutTypesSections(const std::filesystem::path& FilePath) {
+    std::vector<std::string> LayoutSections;
+    FDwarfSymbolSource Source;
+    CHECK(Source.Open(FilePath, FDumpLog{}));
+    for (const std::string TypeName : {"AActor", "APawn", "FName"}) {
+        const FSymbolHandle UDTSymbol = Source.FindUserDefinedType(TypeName);
+        CHECK(UDTSymbol.IsValid());
+        FUserDefinedTypeLayout TypeLayout{};
+        GenerateUserDefinedTypeLayout(Source, UDTSymbol, TypeLayout);
+        LayoutSections.push_back(GenerateTypeLayoutSection(TypeLayout, nullptr));
+    }
+    return LayoutSections;
+}
+
+///Finds the header of the named section in the contents of the ELF fixture. Returns the offset of the header, or 0 if the file has no such section
+inline size_t FindTestSectionHeader(const std::string& FileContents, std::string_view SectionName, FELFSectionHeader& OutSectionHeader) {
+    FELFFileHeader Header{};
+    memcpy(&Header, FileContents.data(), sizeof(Header));
+    FELFSectionHeader NameTableHeader{};
+    memcpy(&NameTableHeader, FileContents.data() + Header.SectionHeaderOffset + Header.SectionNameTableIndex * Header.SectionHeaderEntrySize, sizeof(NameTableHeader));
+
+    for (uint32_t SectionIndex = 0; SectionIndex < Header.NumSectionHeaders; SectionIndex++) {
+        const size_t SectionHeaderOffset = Header.SectionHeaderOffset + SectionIndex * Header.SectionHeaderEntrySize;
+        memcpy(&OutSectionHeader, FileContents.data() + SectionHeaderOffset, sizeof(OutSectionHeader));
+        if (std::string_view{FileContents.data() + NameTableHeader.Offset + OutSectionHeader.Name} == SectionName) {
+            return SectionHeaderOffset;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include "DwarfTestHelpers.h"
+#include "ELFFile.h"
+#include "OutputFile.h"
+#include <cstddef>
+#include <cstring>
+
+///Shared library built from LayoutTypes.cpp, with its DWARF already relocated by the linker
+static void TestLinkedFile() {
+    CHECK(FELFFile::IsELFFile(GetFixturePath("LayoutTypes.elf")));
+
+    FELFFile ELFFile;
+    CHECK(ELFFile.Open(GetFixturePath("LayoutTypes.elf"), FDumpLog{}));
+    CHECK(ELFFile.FindDebugSection(".debug_info") != nullptr);
+    CHECK(ELFFile.FindSection(".missing") == nullptr);
+
+    FDwarfSymbolSource Source;
+    CHECK(Source.Open(GetFixturePath("LayoutTypes.elf"), FDumpLog{}));
+    CHECK(Source.FindUserDefinedType("APawn").IsValid());
+}
+
+///Object file of the same source is rejected up front, as its DWARF still needs the relocations applied
+static void TestRelocatableFile() {
+    CHECK(FELFFile::IsELFFile(GetFixturePath("LayoutTypes.o")));
+
+    FELFFile ELFFile;
+    CHECK(!ELFFile.Open(GetFixturePath("LayoutTypes.o"), FDumpLog{}));
+
+    FDwarfSymbolSource Source;
+    CHECK(!Source.Open(GetFixturePath("LayoutTypes.o"), FDumpLog{}));
+
+    ///Split DWARF files are relocatable too, but need no relocations, so they are still read
+    FELFFile SplitDwarfFile;
+    CHECK(SplitDwarfFile.Open(GetFixturePath("LayoutTypesSplit.dwo"), FDumpLog{}));
+    CHECK(SplitDwarfFile.FindSection(".debug_info.dwo") != nullptr);
+}
+
+#ifdef UVTD_WITH_ZLIB
+///Same library with its debug sections compressed by -gz=zlib (SHF_COMPRESSED) and into the .zdebug_* sections of the older toolchains
+static void TestCompressedSections() {
+    const std::vector<std::string> ExpectedSections = GenerateLayoutTypesSections(GetFixturePath("LayoutTypes.elf"));
+
+    FELFFile CompressedFile;
+    CHECK(CompressedFile.Open(GetFixturePath("LayoutTypesCompressed.elf"), FDumpLog{}));
+    const FELFSection* CompressedSection = CompressedFile.FindDebugSection(".debug_info");
+    CHECK(CompressedSection != nullptr && CompressedSection->IsCompressed() && (CompressedSection->Flags & ELFSectionFlagCompressed) != 0);
+    CHECK(GenerateLayoutTypesSections(GetFixturePath("LayoutTypesCompressed.elf")) == ExpectedSections);
+
+    FELFFile ZDebugFile;
+    CHECK(ZDebugFile.Open(GetFixturePath("LayoutTypesZDebug.elf"), FDumpLog{}));
+    CHECK(ZDebugFile.FindSection(".debug_info") == nullptr);
+    const FELFSection* ZDebugSection = ZDebugFile.FindDebugSection(".debug_info");
+    CHECK(ZDebugSection != nullptr && ZDebugSection->Name == ".zdebug_info" && ZDebugSection->IsCompressed());
+    CHECK(GenerateLayoutTypesSections(GetFixturePath("LayoutTypesZDebug.elf")) == ExpectedSections);
+}
+
+///Replaces the decompressed size in the compression header of .debug_info, returning the path of the patched copy of the file
+static std::filesystem::path WritePatchedCompressedFile(const std::filesystem::path& DirectoryPath, const std::string& FileName, uint64_t DecompressedSize) {
+    std::string FileContents = ReadFileContents(GetFixturePath("LayoutTypesCompressed.elf"));
+    FELFSectionHeader SectionHeader{};
+    CHECK(FindTestSectionHeader(FileContents, ".debug_info", SectionHeader) != 0);
+    memcpy(FileContents.data() + SectionHeader.Offset + offsetof(FELFCompressionHeader, Size), &DecompressedSize, sizeof(DecompressedSize));
+
+    const std::filesystem::path FilePath = DirectoryPath / FileName;
+    CHECK(WriteFileContents(FilePath, FileContents));
+    return FilePath;
+}
+
+///Decompressed size is read from the file, so a damaged one is rejected instead of allocated or trusted
+static void TestCorruptCompressedSize() {
+    const std::filesystem::path DirectoryPath = MakeEmptyTestDirectory("ELFFileTestFiles");
+    FELFFile ELFFile;
+    CHECK(ELFFile.Open(GetFixturePath("LayoutTypesCompressed.elf"), FDumpLog{}));
+    const FELFSection* Section = ELFFile.FindDebugSection(".debug_info");
+    CHECK(Section != nullptr);
+    if (Section == nullptr) {
+        return;
+    }
+    FMappedRegion DecompressedRegion;
+    CHECK(FELFFile::DecompressSection(*Section, DecompressedRegion, FDumpLog{}));
+
+    ///Far more than the compressed data can expand to, which would otherwise be allocated up front
+    FDwarfSymbolSource HugeSizeSource;
+    CHECK(!HugeSizeSource.Open(WritePatchedCompressedFile(DirectoryPath, "HugeSize.elf", UINT64_MAX / 2), FDumpLog{}));
+
+    ///Plausible size that does not match the compressed data
+    FDwarfSymbolSource WrongSizeSource;
+    CHECK(!WrongSizeSource.Open(WritePatchedCompressedFile(DirectoryPath, "WrongSize.elf", DecompressedRegion.GetData().size() + 1), FDumpLog{}));
+}
+#endif
+
+int main() {
+    TestLinkedFile();
+    TestRelocatableFile();
+#ifdef UVTD_WITH_ZLIB
+    TestCompressedSections();
+    TestCorruptCompressedSize();
+#endif
+    return FinishTest("ELFFileTest");
+}
@@ -0,0 +1,37 @@
+#!/bin/sh
+# Rebuilds the ELF fixtures of the tests from LayoutTypes.cpp, NameIndexTypes.cpp, DuplicateTypes*.cpp and CyclicTypes.ll. Run it from this directory,
+# then regenerate Fixtures/Expected with the dumper, as the line numbers the headers mention come from these builds
+set -e
+CXXFLAGS="-g -fdebug-prefix-map=$PWD=. -O0 -fno-exceptions"
+
+g++ $CXXFLAGS -c LayoutTypes.cpp -o LayoutTypes.o
+g++ $CXXFLAGS -fPIC -shared LayoutTypes.cpp -o LayoutTypes.elf
+
+# Same library with its debug sections compressed with -gz (SHF_COMPRESSED) and into the .zdebug_* sections of the older toolchains
+g++ $CXXFLAGS -gz=zlib -fPIC -shared LayoutTypes.cpp -o LayoutTypesCompressed.elf
+objcopy --compress-debug-sections=zlib-gnu LayoutTypes.elf LayoutTypesZDebug.elf
+
+# Split DWARF library with its type units packaged next to it, the package index of both the compile and the type units comes from llvm-dwp
+g++ $CXXFLAGS -gsplit-dwarf -fdebug-types-section -fPIC -shared LayoutTypes.cpp -o LayoutTypesPackaged.elf
+llvm-dwp -e LayoutTypesPackaged.elf -o LayoutTypesPackaged.elf.dwp
+rm LayoutTypesPackaged.elf-LayoutTypes.dwo
+
+# Only the .dwo of the split DWARF object is kept
+g++ $CXXFLAGS -gsplit-dwarf -c LayoutTypes.cpp -o LayoutTypesSplit.o
+rm LayoutTypesSplit.o
+
+# Same types with each of the name indices. GCC writes the pubtypes and gold the .gdb_index, .debug_names comes from llc as GCC does not emit it
+g++ $CXXFLAGS -gdwarf-5 -gpubnames -fPIC -shared NameIndexTypes.cpp -o NameIndexTypesPubTypes.elf
+g++ $CXXFLAGS -gdwarf-5 -ggnu-pubnames -fPIC -shared NameIndexTypes.cpp -o NameIndexTypesGnuPubTypes.elf
+g++ $CXXFLAGS -fuse-ld=gold -Wl,--gdb-index -fPIC -shared NameIndexTypes.cpp -o NameIndexTypesGdbIndex.elf
+llc -O0 -filetype=obj -relocation-model=pic -accel-tables=Dwarf NameIndexTypes.ll -o NameIndexTypesDebugNames.o
+g++ -shared NameIndexTypesDebugNames.o -o NameIndexTypesDebugNames.elf
+rm NameIndexTypesDebugNames.o
+
+# Three units carrying the same classes, and a class the second unit defines differently. The classes are not used, so GCC has to be told to keep them
+g++ $CXXFLAGS -fno-eliminate-unused-debug-types -fPIC -shared DuplicateTypesFirst.cpp DuplicateTypesSecond.cpp DuplicateTypesThird.cpp -o DuplicateTypes.elf
+
+# Classes deriving from each other, which only hand-written debug information can describe
+llc -O0 -filetype=obj -relocation-model=pic CyclicTypes.ll -o CyclicTypes.o
+g++ -shared CyclicTypes.o -o CyclicTypes.elf
+rm CyclicTypes.o
@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+# Rebuilds the PDB fixtures of the tests from VirtualTable.yaml. Run it from this directory with llvm-pdbutil on the PATH,
+# then regenerate Fixtures/Expected with the dumper
+# yaml2pdb writes the types and the module symbols, but none of the section headers, the symbol records and the publics stream.
+# Its output is kept as VirtualTableNoSectionHeaders.pdb, and VirtualTable.pdb gets those streams appended here
+import struct
+import subprocess
+import yaml
+
+# Sections of the made up executable, as (name, virtual address, virtual size)
+SECTIONS = [(b'.text', 0x1000, 0x10000), (b'.rdata', 0x20000, 0x10000)]
+
+# Values of the CV_PUBSYMFLAGS the YAML spells out
+PUBLIC_FLAGS = {'Code': 0x1, 'Function': 0x2, 'Managed': 0x4, 'MSIL': 0x8}
+
+S_PUB32 = 0x110e
+NUM_HASH_BUCKETS = 4096
+GSI_HASH_SIGNATURE = 0xffffffff
+GSI_HASH_VERSION_V70 = 0xeffe0000 + 19990810
+DBI_STREAM = 3
+DBI_SECTION_HEADER_DATA_INDEX = 5
+
+
+def read_msf(path):
+    data = open(path, 'rb').read()
+    block_size, _, _, num_directory_bytes, _, block_map_address = struct.unpack_from('<6I', data, 32)
+    num_directory_blocks = (num_directory_bytes + block_size - 1) // block_size
+    directory_blocks = struct.unpack_from('<%dI' % num_directory_blocks, data, block_map_address * block_size)
+    directory = b''.join(data[block * block_size:(block + 1) * block_size] for block in directory_blocks)[:num_directory_bytes]
+
+    num_streams = struct.unpack_from('<I', directory, 0)[0]
+    stream_sizes = struct.unpack_from('<%dI' % num_streams, directory, 4)
+    position = 4 + 4 * num_streams
+    streams = []
+    for stream_size in stream_sizes:
+        if stream_size == 0xffffffff:
+            streams.append(None)
+            continue
+        num_blocks = (stream_size + block_size - 1) // block_size
+        blocks = struct.unpack_from('<%dI' % num_blocks, directory, position)
+        position += 4 * num_blocks
+        streams.append(b''.join(data[block * block_size:(block + 1) * block_size] for block in blocks)[:stream_size])
+    return block_size, streams
+
+
+def write_msf(path, block_size, streams):
+    # Superblock, the two free block maps, then the streams back to back followed by the directory and the block map
+    next_block = 3
+    stream_blocks = []
+    for stream in streams:
+        num_blocks = 0 if stream is None else (len(stream) + block_size - 1) // block_size
+        stream_blocks.append(list(range(next_block, next_block + num_blocks)))
+        next_block += num_blocks
+
+    directory = struct.pack('<I', len(streams))
+    directory += b''.join(struct.pack('<I', 0xffffffff if stream is None else len(stream)) for stream in streams)
+    for blocks in stream_blocks:
+        directory += struct.pack('<%dI' % len(blocks), *blocks)
+    num_directory_blocks = (len(directory) + block_size - 1) // block_size
+    directory_blocks = list(range(next_block, next_block + num_directory_blocks))
+    block_map_block = next_block + num_directory_blocks
+
+    output = bytearray((block_map_block + 1) * block_size)
+    for stream, blocks in zip(streams, stream_blocks):
+        for index, block in enumerate(blocks):
+            chunk = stream[index * block_size:(index + 1) * block_size]
+            output[block * block_size:block * block_size + len(chunk)] = chunk
+    for index, block in enumerate(directory_blocks):
+        chunk = directory[index * block_size:(index + 1) * block_size]
+        output[block * block_size:block * block_size + len(chunk)] = chunk
+    struct.pack_into('<%dI' % num_directory_blocks, output, block_map_block * block_size, *directory_blocks)
+
+    super_block = b'Microsoft C/C++ MSF 7.00\r\n\x1aDS\0\0\0'
+    super_block += struct.pack('<6I', block_size, 1, len(output) // block_size, len(directory), 0, block_map_block)
+    output[:len(super_block)] = super_block
+    open(path, 'wb').write(output)
+
+
+def hash_string_v1(name):
+    # HashStringV1 of the PDB format, which the GSI hash tables bucket the symbols by
+    result = 0
+    num_words = len(name) // 4
+    for index in range(num_words):
+        result ^= struct.unpack_from('<I', name, index * 4)[0]
+    remainder = name[num_words * 4:]
+    if len(remainder) >= 2:
+        result ^= struct.unpack_from('<H', remainder, 0)[0]
+        remainder = remainder[2:]
+    if len(remainder) == 1:
+        result ^= remainder[0]
+    result |= 0x20202020
+    result ^= result >> 11
+    return (result ^ (result >> 16)) & 0xffffffff
+
+
+def make_public_symbol(name, flags, offset, segment):
+    record = struct.pack('<HIIH', S_PUB32, flags, offset, segment) + name + b'\0'
+    while (len(record) + 2) % 4:
+        record += b'\0'
+    return struct.pack('<H', len(record)) + record
+
+
+def make_gsi_hash_table(symbols):
+    # Hash records list the symbols bucket by bucket, the bucket offsets are into the 12 byte in-memory records of MSVC
+    buckets = [[] for _ in range(NUM_HASH_BUCKETS + 1)]
+    for offset, name in symbols:
+        buckets[hash_string_v1(name) % NUM_HASH_BUCKETS].append(offset)
+    hash_records = b''
+    bitmap = [0] * ((NUM_HASH_BUCKETS + 32) // 32)
+    bucket_offsets = []
+    num_records = 0
+    for bucket_index, bucket in enumerate(buckets):
+        if not bucket:
+            continue
+        bitmap[bucket_index // 32] |= 1 << (bucket_index % 32)
+        bucket_offsets.append(num_records * 12)
+        for offset in bucket:
+            hash_records += struct.pack('<ii', offset + 1, 1)
+            num_records += 1
+    bucket_data = struct.pack('<%dI' % len(bitmap), *bitmap) + struct.pack('<%dI' % len(bucket_offsets), *bucket_offsets)
+    return struct.pack('<4I', GSI_HASH_SIGNATURE, GSI_HASH_VERSION_V70, len(hash_records), len(bucket_data)) + hash_records + bucket_data
+
+
+def append_symbol_streams(streams, publics):
+    section_header_index = len(streams)
+    symbol_record_index = section_header_index + 1
+    public_symbol_index = section_header_index + 2
+
+    # Optional debug header is the last substream of the DBI stream. It is replaced by one listing only the section header stream
+    dbi = bytearray(streams[DBI_STREAM])
+    module_info_size, section_contribution_size, section_map_size, source_info_size, type_server_map_size = struct.unpack_from('<5i', dbi, 24)
+    ec_substream_size = struct.unpack_from('<i', dbi, 52)[0]
+    debug_header_offset = 64 + module_info_size + section_contribution_size + section_map_size + source_info_size + type_server_map_size + ec_substream_size
+    dbi = dbi[:debug_header_offset]
+    debug_header = [0xffff] * 11
+    debug_header[DBI_SECTION_HEADER_DATA_INDEX] = section_header_index
+    dbi += struct.pack('<11H', *debug_header)
+    struct.pack_into('<i', dbi, 48, len(debug_header) * 2)
+    struct.pack_into('<H', dbi, 16, public_symbol_index)
+    struct.pack_into('<H', dbi, 20, symbol_record_index)
+    streams[DBI_STREAM] = bytes(dbi)
+
+    streams.append(b''.join(name.ljust(8, b'\0') + struct.pack('<6I2HI', size, address, 0, 0, 0, 0, 0, 0, 0) for name, address, size in SECTIONS))
+
+    symbol_records = b''
+    public_offsets = []
+    for public in publics:
+        symbol = public['PublicSym32']
+        name = symbol['Name'].encode()
+        flags = sum(PUBLIC_FLAGS[flag] for flag in symbol['Flags'])
+        public_offsets.append((len(symbol_records), name, symbol['Segment'], symbol['Offset']))
+        symbol_records += make_public_symbol(name, flags, symbol['Offset'], symbol['Segment'])
+    streams.append(symbol_records)
+
+    # Public symbol stream is the PSI header, the hash table and the address map sorted by the section and the offset
+    hash_table = make_gsi_hash_table([(offset, name) for offset, name, _, _ in public_offsets])
+    address_map = [offset for offset, _, _, _ in sorted(public_offsets, key=lambda public: (public[2], public[3]))]
+    address_map_data = struct.pack('<%dI' % len(address_map), *address_map)
+    psi_header = struct.pack('<4I2HII', len(hash_table), len(address_map_data), 0, 0, 0, 0, 0, len(SECTIONS))
+    streams.append(psi_header + hash_table + address_map_data)
+
+
+def main():
+    subprocess.run(['llvm-pdbutil', 'yaml2pdb', 'VirtualTable.yaml', '--pdb=VirtualTableNoSectionHeaders.pdb'], check=True)
+    publics = yaml.safe_load(open('VirtualTable.yaml'))['PublicsStream']['Records']
+
+    block_size, streams = read_msf('VirtualTableNoSectionHeaders.pdb')
+    append_symbol_streams(streams, publics)
+    write_msf('VirtualTable.pdb', block_size, streams)
+
+
+if __name__ == '__main__':
+    main()
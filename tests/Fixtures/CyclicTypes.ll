@@ -0,0 +1,26 @@
+; Two classes listing each other as their primary base, which no compiler emits, for the tests to check that the base class chains are cut off
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!30, !31}
+
+!0 = distinct !DICompileUnit(language: DW_LANG_C_plus_plus_14, file: !1, producer: "CyclicTypes.ll", isOptimized: false, runtimeVersion: 0, emissionKind: FullDebug, retainedTypes: !2)
+!1 = !DIFile(filename: "CyclicTypes.ll", directory: ".")
+!2 = !{!3, !4}
+!3 = distinct !DICompositeType(tag: DW_TAG_class_type, name: "FCyclicFirst", file: !1, line: 1, size: 64, flags: DIFlagTypePassByReference, elements: !5, vtableHolder: !3, identifier: "_ZTS12FCyclicFirst")
+!4 = distinct !DICompositeType(tag: DW_TAG_class_type, name: "FCyclicSecond", file: !1, line: 2, size: 64, flags: DIFlagTypePassByReference, elements: !6, vtableHolder: !4, identifier: "_ZTS13FCyclicSecond")
+!5 = !{!7, !9}
+!6 = !{!8, !10}
+!7 = !DIDerivedType(tag: DW_TAG_inheritance, scope: !3, baseType: !4, flags: DIFlagPublic, extraData: i32 0)
+!8 = !DIDerivedType(tag: DW_TAG_inheritance, scope: !4, baseType: !3, flags: DIFlagPublic, extraData: i32 0)
+!9 = !DISubprogram(name: "Tick", linkageName: "_ZN12FCyclicFirst4TickEv", scope: !3, file: !1, line: 1, type: !11, scopeLine: 1, containingType: !3, virtualIndex: 0, flags: DIFlagPublic | DIFlagPrototyped, spFlags: DISPFlagVirtual)
+!10 = !DISubprogram(name: "Tick", linkageName: "_ZN13FCyclicSecond4TickEv", scope: !4, file: !1, line: 2, type: !12, scopeLine: 2, containingType: !4, virtualIndex: 0, flags: DIFlagPublic | DIFlagPrototyped, spFlags: DISPFlagVirtual)
+!11 = !DISubroutineType(types: !13)
+!12 = !DISubroutineType(types: !14)
+!13 = !{null, !15}
+!14 = !{null, !16}
+!15 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !3, size: 64, flags: DIFlagArtificial | DIFlagObjectPointer)
+!16 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !4, size: 64, flags: DIFlagArtificial | DIFlagObjectPointer)
+!30 = !{i32 7, !"Dwarf Version", i32 4}
+!31 = !{i32 2, !"Debug Info Version", i32 3}
@@ -0,0 +1,15 @@
+// Classes every unit of DuplicateTypes.elf carries its own copy of, rebuild it with BuildELFFixtures.sh
+#pragma once
+
+#include <cstdint>
+
+// 256 classes named FDuplicateType0000 to FDuplicateType3333, the suffix counting in base 4, enough to land in every shard of the definition map
+#define DUPLICATE_TYPE(Suffix) struct FDuplicateType##Suffix { int32_t Value; FDuplicateType##Suffix* Next; };
+#define DUPLICATE_TYPES_4(Suffix) DUPLICATE_TYPE(Suffix##0) DUPLICATE_TYPE(Suffix##1) DUPLICATE_TYPE(Suffix##2) DUPLICATE_TYPE(Suffix##3)
+#define DUPLICATE_TYPES_16(Suffix) DUPLICATE_TYPES_4(Suffix##0) DUPLICATE_TYPES_4(Suffix##1) DUPLICATE_TYPES_4(Suffix##2) DUPLICATE_TYPES_4(Suffix##3)
+#define DUPLICATE_TYPES_64(Suffix) DUPLICATE_TYPES_16(Suffix##0) DUPLICATE_TYPES_16(Suffix##1) DUPLICATE_TYPES_16(Suffix##2) DUPLICATE_TYPES_16(Suffix##3)
+
+DUPLICATE_TYPES_64(0)
+DUPLICATE_TYPES_64(1)
+DUPLICATE_TYPES_64(2)
+DUPLICATE_TYPES_64(3)
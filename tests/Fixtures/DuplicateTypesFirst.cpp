@@ -0,0 +1,7 @@
+// First unit of DuplicateTypes.elf, whose definition of the conflicting class is the one kept
+#include "DuplicateTypes.h"
+
+struct FConflictingType {
+    int32_t FirstMember;
+};
+FConflictingType FirstConflictingType;
@@ -0,0 +1,13 @@
+// Second unit of DuplicateTypes.elf, defining the conflicting class with a different layout
+#include "DuplicateTypes.h"
+
+struct FConflictingType {
+    int64_t SecondMember;
+    int32_t SecondExtraMember;
+};
+FConflictingType SecondConflictingType;
+
+struct FSecondUnitType {
+    int32_t Value;
+};
+FSecondUnitType SecondUnitType;
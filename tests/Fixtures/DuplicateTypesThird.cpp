@@ -0,0 +1,7 @@
+// Third unit of DuplicateTypes.elf, repeating the definition of the conflicting class from the first unit
+#include "DuplicateTypes.h"
+
+struct FConflictingType {
+    int32_t FirstMember;
+};
+FConflictingType ThirdConflictingType;
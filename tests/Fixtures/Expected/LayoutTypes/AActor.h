@@ -0,0 +1,36 @@
+/* Generated file for UDT 'AActor' */
+/* Declared in './LayoutTypes.cpp' at line 9 */
+
+#define VIRTUAL_FUNCTION_COUNT_AActor 4
+
+#define IMPLEMENT_MEMBER_VARIABLE_LAYOUT_AActor \
+public: \
+    FName Name; \
+    float Age; \
+    class AActor* Owner; \
+    uint8_t bPendingKill: 1; \
+    uint8_t bHidden: 1; \
+    int32_t Tags[4]; \
+
+
+#define IMPLEMENT_VIRTUAL_TABLE_LAYOUT_AActor \
+public: \
+    virtual void ~AActor() {}; \
+    virtual void Tick(float) {}; \
+    virtual bool IsPendingKill() const { return 0; }; \
+
+
+#define IMPLEMENT_NO_INIT_CONSTRUCTOR_AActor \
+    explicit inline AActor(ENoInit) \
+    {} \
+
+#define IMPLEMENT_FORCE_INIT_CONSTRUCTOR_AActor \
+    explicit inline AActor(EForceInit) : \
+        Name(), \
+        Age(0), \
+        Owner(nullptr), \
+        bPendingKill(0), \
+        bHidden(0), \
+        Tags{0, 0, 0, 0} \
+    {} \
+
@@ -0,0 +1,27 @@
+/* Generated file for UDT 'APawn' */
+/* Declared in './LayoutTypes.cpp' at line 23 */
+
+#define VIRTUAL_FUNCTION_COUNT_APawn 5
+
+#define IMPLEMENT_MEMBER_VARIABLE_LAYOUT_APawn \
+public: \
+    class AActor* PossessedBy; \
+    FName PawnNames[2]; \
+
+
+#define IMPLEMENT_VIRTUAL_TABLE_LAYOUT_APawn \
+public: \
+    virtual void Possess(class AActor*) {}; \
+
+
+#define IMPLEMENT_NO_INIT_CONSTRUCTOR_APawn \
+    explicit inline APawn(ENoInit) : \
+        AActor(NoInit) \
+    {} \
+
+#define IMPLEMENT_FORCE_INIT_CONSTRUCTOR_APawn \
+    explicit inline APawn(EForceInit) : \
+        PossessedBy(nullptr), \
+        PawnNames{FName(), FName()} \
+    {} \
+
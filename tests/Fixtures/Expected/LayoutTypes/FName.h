@@ -0,0 +1,24 @@
+/* Generated file for UDT 'FName' */
+/* Declared in './LayoutTypes.cpp' at line 4 */
+
+#define VIRTUAL_FUNCTION_COUNT_FName 0
+
+#define IMPLEMENT_MEMBER_VARIABLE_LAYOUT_FName \
+public: \
+    int32_t ComparisonIndex; \
+    int32_t Number; \
+
+
+#define IMPLEMENT_VIRTUAL_TABLE_LAYOUT_FName \
+
+
+#define IMPLEMENT_NO_INIT_CONSTRUCTOR_FName \
+    explicit inline FName(ENoInit) \
+    {} \
+
+#define IMPLEMENT_FORCE_INIT_CONSTRUCTOR_FName \
+    explicit inline FName(EForceInit) : \
+        ComparisonIndex(0), \
+        Number(0) \
+    {} \
+
@@ -0,0 +1,108 @@
+/* Generated layouts of the types dumped from 'LayoutTypes.elf' */
+
+/* Index of the type sections, the offsets and the sizes are in bytes from the start of this file
+ *     Offset       Size  Type
+ * 0000000299 0000000957  AActor
+ * 0000001256 0000000745  APawn
+ * 0000002001 0000000635  FName
+ */
+
+#ifndef UVTD_TYPE_SECTION_AActor
+#define UVTD_TYPE_SECTION_AActor
+/* Generated file for UDT 'AActor' */
+/* Declared in './LayoutTypes.cpp' at line 9 */
+
+#define VIRTUAL_FUNCTION_COUNT_AActor 4
+
+#define IMPLEMENT_MEMBER_VARIABLE_LAYOUT_AActor \
+public: \
+    FName Name; \
+    float Age; \
+    class AActor* Owner; \
+    uint8_t bPendingKill: 1; \
+    uint8_t bHidden: 1; \
+    int32_t Tags[4]; \
+
+
+#define IMPLEMENT_VIRTUAL_TABLE_LAYOUT_AActor \
+public: \
+    virtual void ~AActor() {}; \
+    virtual void Tick(float) {}; \
+    virtual bool IsPendingKill() const { return 0; }; \
+
+
+#define IMPLEMENT_NO_INIT_CONSTRUCTOR_AActor \
+    explicit inline AActor(ENoInit) \
+    {} \
+
+#define IMPLEMENT_FORCE_INIT_CONSTRUCTOR_AActor \
+    explicit inline AActor(EForceInit) : \
+        Name(), \
+        Age(0), \
+        Owner(nullptr), \
+        bPendingKill(0), \
+        bHidden(0), \
+        Tags{0, 0, 0, 0} \
+    {} \
+
+#endif /* UVTD_TYPE_SECTION_AActor */
+
+#ifndef UVTD_TYPE_SECTION_APawn
+#define UVTD_TYPE_SECTION_APawn
+/* Generated file for UDT 'APawn' */
+/* Declared in './LayoutTypes.cpp' at line 23 */
+
+#define VIRTUAL_FUNCTION_COUNT_APawn 5
+
+#define IMPLEMENT_MEMBER_VARIABLE_LAYOUT_APawn \
+public: \
+    class AActor* PossessedBy; \
+    FName PawnNames[2]; \
+
+
+#define IMPLEMENT_VIRTUAL_TABLE_LAYOUT_APawn \
+public: \
+    virtual void Possess(class AActor*) {}; \
+
+
+#define IMPLEMENT_NO_INIT_CONSTRUCTOR_APawn \
+    explicit inline APawn(ENoInit) : \
+        AActor(NoInit) \
+    {} \
+
+#define IMPLEMENT_FORCE_INIT_CONSTRUCTOR_APawn \
+    explicit inline APawn(EForceInit) : \
+        PossessedBy(nullptr), \
+        PawnNames{FName(), FName()} \
+    {} \
+
+#endif /* UVTD_TYPE_SECTION_APawn */
+
+#ifndef UVTD_TYPE_SECTION_FName
+#define UVTD_TYPE_SECTION_FName
+/* Generated file for UDT 'FName' */
+/* Declared in './LayoutTypes.cpp' at line 4 */
+
+#define VIRTUAL_FUNCTION_COUNT_FName 0
+
+#define IMPLEMENT_MEMBER_VARIABLE_LAYOUT_FName \
+public: \
+    int32_t ComparisonIndex; \
+    int32_t Number; \
+
+
+#define IMPLEMENT_VIRTUAL_TABLE_LAYOUT_FName \
+
+
+#define IMPLEMENT_NO_INIT_CONSTRUCTOR_FName \
+    explicit inline FName(ENoInit) \
+    {} \
+
+#define IMPLEMENT_FORCE_INIT_CONSTRUCTOR_FName \
+    explicit inline FName(EForceInit) : \
+        ComparisonIndex(0), \
+        Number(0) \
+    {} \
+
+#endif /* UVTD_TYPE_SECTION_FName */
+
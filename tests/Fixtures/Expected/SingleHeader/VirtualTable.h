@@ -0,0 +1,53 @@
+/* Generated layouts of the types dumped from 'VirtualTable.pdb' */
+
+/* Index of the type sections, the offsets and the sizes are in bytes from the start of this file
+ *     Offset       Size  Type
+ * 0000000236 0000001117  AActor
+ */
+
+#ifndef UVTD_TYPE_SECTION_AActor
+#define UVTD_TYPE_SECTION_AActor
+/* Generated file for UDT 'AActor' */
+
+#define VIRTUAL_FUNCTION_COUNT_AActor 2
+
+#define IMPLEMENT_MEMBER_VARIABLE_LAYOUT_AActor \
+public: \
+    int32 Values[4]; \
+private: \
+    uint32 bFlag: 3; \
+protected: \
+    class AActor* Owner; \
+
+
+#define IMPLEMENT_VIRTUAL_TABLE_LAYOUT_AActor \
+public: \
+    virtual bool Tick(int32, class AActor*) { return 0; }; \
+    virtual bool Foo(int32, class AActor*) { return 0; }; \
+
+
+#define IMPLEMENT_NO_INIT_CONSTRUCTOR_AActor \
+    explicit inline AActor(ENoInit) \
+    {} \
+
+#define IMPLEMENT_FORCE_INIT_CONSTRUCTOR_AActor \
+    explicit inline AActor(EForceInit) : \
+        Values{0, 0, 0, 0}, \
+        bFlag(0), \
+        Owner(nullptr) \
+    {} \
+
+/* Generated virtual function RVAs for UDT 'AActor' */
+
+#define VIRTUAL_TABLE_RVA_AActor 0x00020100
+
+#define FOR_EACH_VIRTUAL_FUNCTION_RVA_AActor(Macro) \
+    Macro(0, Tick, 0x00001010) \
+    Macro(1, Foo, 0x00001030) \
+
+#define FOR_EACH_CONSTRUCTOR_RVA_AActor(Macro) \
+    Macro(0x00001200) \
+    Macro(0x00001280) \
+
+#endif /* UVTD_TYPE_SECTION_AActor */
+
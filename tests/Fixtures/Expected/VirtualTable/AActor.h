@@ -0,0 +1,30 @@
+/* Generated file for UDT 'AActor' */
+
+#define VIRTUAL_FUNCTION_COUNT_AActor 2
+
+#define IMPLEMENT_MEMBER_VARIABLE_LAYOUT_AActor \
+public: \
+    int32 Values[4]; \
+private: \
+    uint32 bFlag: 3; \
+protected: \
+    class AActor* Owner; \
+
+
+#define IMPLEMENT_VIRTUAL_TABLE_LAYOUT_AActor \
+public: \
+    virtual bool Tick(int32, class AActor*) { return 0; }; \
+    virtual bool Foo(int32, class AActor*) { return 0; }; \
+
+
+#define IMPLEMENT_NO_INIT_CONSTRUCTOR_AActor \
+    explicit inline AActor(ENoInit) \
+    {} \
+
+#define IMPLEMENT_FORCE_INIT_CONSTRUCTOR_AActor \
+    explicit inline AActor(EForceInit) : \
+        Values{0, 0, 0, 0}, \
+        bFlag(0), \
+        Owner(nullptr) \
+    {} \
+
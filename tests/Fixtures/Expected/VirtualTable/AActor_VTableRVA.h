@@ -0,0 +1,12 @@
+/* Generated virtual function RVAs for UDT 'AActor' */
+
+#define VIRTUAL_TABLE_RVA_AActor 0x00020100
+
+#define FOR_EACH_VIRTUAL_FUNCTION_RVA_AActor(Macro) \
+    Macro(0, Tick, 0x00001010) \
+    Macro(1, Foo, 0x00001030) \
+
+#define FOR_EACH_CONSTRUCTOR_RVA_AActor(Macro) \
+    Macro(0x00001200) \
+    Macro(0x00001280) \
+
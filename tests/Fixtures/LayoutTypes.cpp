@@ -0,0 +1,33 @@
+// Source of the ELF fixtures of the tests, rebuild them with BuildELFFixtures.sh
+#include <cstdint>
+
+struct FName {
+    int32_t ComparisonIndex;
+    int32_t Number;
+};
+
+class AActor {
+public:
+    virtual ~AActor() {}
+    virtual void Tick(float DeltaTime) { Age += DeltaTime; }
+    virtual bool IsPendingKill() const { return bPendingKill; }
+
+    FName Name;
+    float Age;
+    AActor* Owner;
+    uint8_t bPendingKill : 1;
+    uint8_t bHidden : 1;
+    int32_t Tags[4];
+};
+
+class APawn : public AActor {
+public:
+    void Tick(float DeltaTime) override { AActor::Tick(DeltaTime * 2.0f); }
+    virtual void Possess(AActor* Controller) { PossessedBy = Controller; }
+
+    AActor* PossessedBy;
+    FName PawnNames[2];
+};
+
+///Instance keeps the types and their virtual tables in the debug info
+APawn DefaultPawn;
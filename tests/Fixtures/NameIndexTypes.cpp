@@ -0,0 +1,30 @@
+// Source of the name index fixtures of the tests, rebuild them with BuildELFFixtures.sh
+#include <cstdint>
+
+namespace UE::Core {
+struct FVector {
+    double X;
+    double Y;
+    double Z;
+};
+}
+
+template <typename ElementType>
+struct TArray {
+    ElementType* Data;
+    int32_t Num;
+    int32_t Max;
+};
+
+class UObject {
+public:
+    struct FNested {
+        int32_t Value;
+    };
+    virtual ~UObject() {}
+    FNested Nested;
+    TArray<UE::Core::FVector> Vectors;
+};
+
+UObject Object;
+UE::Core::FVector Vector;
@@ -0,0 +1,38 @@
+; Debug information of the types of NameIndexTypes.cpp, less the template and the members using it, for llc to emit the DWARF 5 .debug_names GCC does not
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+%"struct.UE::Core::FVector" = type { double, double, double }
+%class.UObject = type { %"struct.UObject::FNested" }
+%"struct.UObject::FNested" = type { i32 }
+
+@Vector = dso_local global %"struct.UE::Core::FVector" zeroinitializer, align 8, !dbg !0
+@Object = dso_local global %class.UObject zeroinitializer, align 4, !dbg !20
+
+!llvm.dbg.cu = !{!2}
+!llvm.module.flags = !{!30, !31}
+
+!0 = !DIGlobalVariableExpression(var: !1, expr: !DIExpression())
+!1 = distinct !DIGlobalVariable(name: "Vector", scope: !2, file: !3, line: 30, type: !5, isLocal: false, isDefinition: true)
+!2 = distinct !DICompileUnit(language: DW_LANG_C_plus_plus_14, file: !3, producer: "NameIndexTypes.ll", isOptimized: false, runtimeVersion: 0, emissionKind: FullDebug, globals: !4, nameTableKind: Default)
+!3 = !DIFile(filename: "NameIndexTypes.cpp", directory: ".")
+!4 = !{!0, !20}
+!5 = distinct !DICompositeType(tag: DW_TAG_structure_type, name: "FVector", scope: !6, file: !3, line: 5, size: 192, flags: DIFlagTypePassByValue, elements: !8, identifier: "_ZTSN2UE4Core7FVectorE")
+!6 = !DINamespace(name: "Core", scope: !7)
+!7 = !DINamespace(name: "UE", scope: null)
+!8 = !{!9, !11, !12}
+!9 = !DIDerivedType(tag: DW_TAG_member, name: "X", scope: !5, file: !3, line: 6, baseType: !10, size: 64)
+!10 = !DIBasicType(name: "double", size: 64, encoding: DW_ATE_float)
+!11 = !DIDerivedType(tag: DW_TAG_member, name: "Y", scope: !5, file: !3, line: 7, baseType: !10, size: 64, offset: 64)
+!12 = !DIDerivedType(tag: DW_TAG_member, name: "Z", scope: !5, file: !3, line: 8, baseType: !10, size: 64, offset: 128)
+!20 = !DIGlobalVariableExpression(var: !21, expr: !DIExpression())
+!21 = distinct !DIGlobalVariable(name: "Object", scope: !2, file: !3, line: 29, type: !22, isLocal: false, isDefinition: true)
+!22 = distinct !DICompositeType(tag: DW_TAG_class_type, name: "UObject", file: !3, line: 19, size: 32, flags: DIFlagTypePassByValue, elements: !23, identifier: "_ZTS7UObject")
+!23 = !{!24}
+!24 = !DIDerivedType(tag: DW_TAG_member, name: "Nested", scope: !22, file: !3, line: 25, baseType: !25, size: 32, flags: DIFlagPublic)
+!25 = distinct !DICompositeType(tag: DW_TAG_structure_type, name: "FNested", scope: !22, file: !3, line: 21, size: 32, flags: DIFlagTypePassByValue, elements: !26, identifier: "_ZTSN7UObject7FNestedE")
+!26 = !{!27}
+!27 = !DIDerivedType(tag: DW_TAG_member, name: "Value", scope: !25, file: !3, line: 22, baseType: !29, size: 32)
+!29 = !DIBasicType(name: "int", size: 32, encoding: DW_ATE_signed)
+!30 = !{i32 7, !"Dwarf Version", i32 5}
+!31 = !{i32 2, !"Debug Info Version", i32 3}
@@ -0,0 +1,43 @@
+#include "Format.h"
+#include "TestHarness.h"
+
+///Integers in both bases, with the padding going around the sign the same way printf does it
+static void TestIntegerArguments() {
+    CHECK_EQUAL(Format("{} {}", 42, -7), "42 -7");
+    CHECK_EQUAL(Format("0x{:08X}", uint32_t{0xBEEF}), "0x0000BEEF");
+    CHECK_EQUAL(Format("{:x}", int8_t{-1}), "ff");
+    CHECK_EQUAL(Format("[{:5}] [{:05}]", -12, -12), "[  -12] [-0012]");
+    CHECK_EQUAL(Format("{:d}", uint64_t{18446744073709551615ull}), "18446744073709551615");
+}
+
+///char is the character rather than its code, while signed and unsigned char stay integers
+static void TestCharacterArguments() {
+    CHECK_EQUAL(Format("{}{}{}", 'U', 'V', 'T'), "UVT");
+    CHECK_EQUAL(Format("'{}'", '{'), "'{'");
+    CHECK_EQUAL(Format("{} {}", static_cast<signed char>('A'), static_cast<unsigned char>('A')), "65 65");
+}
+
+static void TestBoolArguments() {
+    CHECK_EQUAL(Format("{}, {}", true, false), "true, false");
+    const bool bHasVirtualTable = true;
+    CHECK_EQUAL(Format("bHasVirtualTable = {};", bHasVirtualTable), "bHasVirtualTable = true;");
+}
+
+///Strings and escaped braces around the arguments
+static void TestStringArguments() {
+    const std::string Name = "AActor";
+    CHECK_EQUAL(Format("{{{}}}", Name), "{AActor}");
+    CHECK_EQUAL(Format("{}::{}", std::string_view{"FName"}, "ComparisonIndex"), "FName::ComparisonIndex");
+
+    std::string Output = "#define ";
+    FormatTo(Output, "{}_{} {}", Name, 'X', false);
+    CHECK_EQUAL(Output, "#define AActor_X false");
+}
+
+int main() {
+    TestIntegerArguments();
+    TestCharacterArguments();
+    TestBoolArguments();
+    TestStringArguments();
+    return FinishTest("FormatTest");
+}
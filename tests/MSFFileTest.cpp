@@ -0,0 +1,131 @@
+#include "PDBTestFile.h"
+#include "TestHarness.h"
+
+///Stream contents depend on both the stream and the position in it, so a block read from the wrong place or the wrong stream is noticed
+static std::string MakeStreamContents(uint32_t StreamIndex, size_t Size) {
+    std::string Contents(Size, '\0');
+    for (size_t i = 0; i < Size; i++) {
+        Contents[i] = static_cast<char>((i / 4 * 31 + StreamIndex * 7 + i % 4) & 0xFF);
+    }
+    return Contents;
+}
+
+///Streams of a few blocks each, all but the first ending partway into their last block, plus an empty stream
+static std::vector<std::string> MakeTestStreams(uint32_t BlockSize) {
+    std::vector<std::string> Streams;
+    for (uint32_t StreamIndex = 0; StreamIndex < 4; StreamIndex++) {
+        Streams.push_back(MakeStreamContents(StreamIndex, BlockSize * (StreamIndex + 1) + StreamIndex * 100));
+    }
+    Streams.push_back(std::string{});
+    return Streams;
+}
+
+///Opens the file and checks that every stream reads back exactly as it has been written. Returns the number of the zero copy streams
+static size_t CheckStreams(const std::filesystem::path& FilePath, const std::vector<std::string>& Streams, uint32_t BlockSize) {
+    FMSFFile MSFFile;
+    CHECK(MSFFile.Open(FilePath, FDumpLog{}));
+    CHECK_EQUAL(MSFFile.GetBlockSize(), BlockSize);
+    CHECK_EQUAL(MSFFile.GetNumStreams(), static_cast<uint32_t>(Streams.size()));
+
+    size_t NumZeroCopyStreams = 0;
+    for (uint32_t StreamIndex = 0; StreamIndex < Streams.size(); StreamIndex++) {
+        FMSFStream Stream;
+        CHECK(MSFFile.OpenStream(StreamIndex, Stream));
+        const std::span<const uint8_t> Data = Stream.GetData();
+        CHECK(std::string(reinterpret_cast<const char*>(Data.data()), Data.size()) == Streams[StreamIndex]);
+        NumZeroCopyStreams += Stream.IsZeroCopy() ? 1 : 0;
+    }
+    FMSFStream MissingStream;
+    CHECK(!MSFFile.OpenStream(static_cast<uint32_t>(Streams.size()), MissingStream));
+    return NumZeroCopyStreams;
+}
+
+///Every block size /PDBPAGESIZE accepts, with the scattered streams remapped from the page aligned blocks instead of copied
+static void TestBlockSizes(const std::filesystem::path& DirectoryPath) {
+    for (const uint32_t BlockSize : {4096u, 8192u, 16384u, 32768u, 65536u}) {
+        const std::vector<std::string> Streams = MakeTestStreams(BlockSize);
+        FTestMSFLayout Layout{};
+        Layout.BlockSize = BlockSize;
+
+        const std::filesystem::path ContiguousPath = DirectoryPath / ("Contiguous" + std::to_string(BlockSize) + ".pdb");
+        CHECK(WriteTestMSFFile(ContiguousPath, Streams, Layout));
+        CHECK_EQUAL(CheckStreams(ContiguousPath, Streams, BlockSize), Streams.size());
+
+        Layout.bInterleaveStreams = true;
+        const std::filesystem::path ScatteredPath = DirectoryPath / ("Scattered" + std::to_string(BlockSize) + ".pdb");
+        CHECK(WriteTestMSFFile(ScatteredPath, Streams, Layout));
+        CHECK_EQUAL(CheckStreams(ScatteredPath, Streams, BlockSize), Streams.size());
+    }
+}
+
+/**
+ * 512 byte blocks are smaller than a page, so the scattered blocks cannot be remapped and are copied into an owned buffer instead
+ * The stream is large enough for its directory to need several block map blocks, which are only listed in the array following BlockMapAddr
+ */
+static void TestSmallBlocksAndMultiBlockBlockMap(const std::filesystem::path& DirectoryPath) {
+    constexpr uint32_t BlockSize = 512;
+    std::vector<std::string> Streams = MakeTestStreams(BlockSize);
+    ///20000 blocks take 80000 bytes of block indices in the directory, over the 128 directory blocks a single block map block can list
+    Streams.push_back(MakeStreamContents(static_cast<uint32_t>(Streams.size()), 20000 * BlockSize + 7));
+
+    FTestMSFLayout Layout{};
+    Layout.BlockSize = BlockSize;
+    Layout.bInterleaveStreams = true;
+    const std::filesystem::path FilePath = DirectoryPath / "SmallBlocks.pdb";
+    CHECK(WriteTestMSFFile(FilePath, Streams, Layout));
+
+    FMSFSuperBlock SuperBlock{};
+    memcpy(&SuperBlock, ReadFileContents(FilePath).data(), sizeof(SuperBlock));
+    const uint64_t NumDirectoryBlocks = (SuperBlock.NumDirectoryBytes + BlockSize - 1) / BlockSize;
+    CHECK(NumDirectoryBlocks > BlockSize / sizeof(uint32_t));
+
+    ///Single block streams and the empty stream are views of the mapping, only the scattered streams are copied
+    CHECK_EQUAL(CheckStreams(FilePath, Streams, BlockSize), size_t{2});
+}
+
+#ifndef _WIN32
+/**
+ * Streams placed past the 4GB mark, which 64KB blocks can address with the 32-bit block indices
+ * Blocks before the streams are never written, so the file only takes the space of its written blocks on the file systems with sparse files
+ * NTFS only makes the files sparse on request, so there the test would write out the whole 4GB
+ */
+static void TestBlocksPast4GB(const std::filesystem::path& DirectoryPath) {
+    constexpr uint32_t BlockSize = 65536;
+    const std::vector<std::string> Streams = MakeTestStreams(BlockSize);
+    FTestMSFLayout Layout{};
+    Layout.BlockSize = BlockSize;
+    Layout.bInterleaveStreams = true;
+    Layout.FirstStreamBlock = 0x10000 + 16;
+
+    const std::filesystem::path FilePath = DirectoryPath / "Past4GB.pdb";
+    CHECK(WriteTestMSFFile(FilePath, Streams, Layout));
+    CHECK(std::filesystem::file_size(FilePath) > 0x100000000ull);
+    CHECK_EQUAL(CheckStreams(FilePath, Streams, BlockSize), Streams.size());
+    std::filesystem::remove(FilePath);
+}
+#endif
+
+///Block sizes that are not a power of two, or are outside of the 512 byte to 64KB range, are rejected
+static void TestUnsupportedBlockSizes(const std::filesystem::path& DirectoryPath) {
+    for (const uint32_t BlockSize : {256u, 3072u, 131072u}) {
+        FTestMSFLayout Layout{};
+        Layout.BlockSize = BlockSize;
+        const std::filesystem::path FilePath = DirectoryPath / ("Unsupported" + std::to_string(BlockSize) + ".pdb");
+        CHECK(WriteTestMSFFile(FilePath, MakeTestStreams(BlockSize), Layout));
+
+        FMSFFile MSFFile;
+        CHECK(!MSFFile.Open(FilePath, FDumpLog{}));
+    }
+}
+
+int main() {
+    const std::filesystem::path DirectoryPath = MakeEmptyTestDirectory("MSFFileTestFiles");
+
+    TestBlockSizes(DirectoryPath);
+    TestSmallBlocksAndMultiBlockBlockMap(DirectoryPath);
+#ifndef _WIN32
+    TestBlocksPast4GB(DirectoryPath);
+#endif
+    TestUnsupportedBlockSizes(DirectoryPath);
+    return FinishTest("MSFFileTest");
+}
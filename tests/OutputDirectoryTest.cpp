@@ -0,0 +1,95 @@
+#include "OutputFile.h"
+#include "TestHarness.h"
+#include <chrono>
+
+static const std::string FirstFileContents = "#define FIRST_FILE 1\n";
+static const std::string SecondFileContents = "#define SECOND_FILE 2\n";
+
+///Writes both files into the directory the way a dump does, opening it first and saving the manifest at the end
+static void WriteBothFiles(const std::filesystem::path& DirectoryPath, size_t ExpectedNumWrittenFiles) {
+    FOutputDirectory OutputDirectory{DirectoryPath};
+    CHECK(OutputDirectory.Open());
+    OutputDirectory.WriteFile("First.h", FirstFileContents);
+    OutputDirectory.WriteFile("Second.h", SecondFileContents);
+    CHECK(OutputDirectory.SaveManifest());
+
+    CHECK_EQUAL(OutputDirectory.GetNumWrittenFiles(), ExpectedNumWrittenFiles);
+    CHECK_EQUAL(OutputDirectory.GetNumUnchangedFiles(), 2 - ExpectedNumWrittenFiles);
+    CHECK_EQUAL(ReadFileContents(DirectoryPath / "First.h"), FirstFileContents);
+    CHECK_EQUAL(ReadFileContents(DirectoryPath / "Second.h"), SecondFileContents);
+}
+
+static void TestUnchangedRerun() {
+    const std::filesystem::path DirectoryPath = MakeEmptyTestDirectory("OutputDirectoryUnchanged");
+    WriteBothFiles(DirectoryPath, 2);
+    CHECK(std::filesystem::exists(DirectoryPath / FOutputDirectory::ManifestFileName));
+
+    const std::filesystem::file_time_type FirstWriteTime = std::filesystem::last_write_time(DirectoryPath / "First.h");
+    WriteBothFiles(DirectoryPath, 0);
+    CHECK(std::filesystem::last_write_time(DirectoryPath / "First.h") == FirstWriteTime);
+}
+
+static void TestChangedContents() {
+    const std::filesystem::path DirectoryPath = MakeEmptyTestDirectory("OutputDirectoryChanged");
+    WriteBothFiles(DirectoryPath, 2);
+
+    FOutputDirectory OutputDirectory{DirectoryPath};
+    CHECK(OutputDirectory.Open());
+    OutputDirectory.WriteFile("First.h", "#define FIRST_FILE 3\n");
+    OutputDirectory.WriteFile("Second.h", SecondFileContents);
+    CHECK(OutputDirectory.SaveManifest());
+    CHECK_EQUAL(OutputDirectory.GetNumWrittenFiles(), size_t{1});
+    CHECK_EQUAL(ReadFileContents(DirectoryPath / "First.h"), std::string{"#define FIRST_FILE 3\n"});
+}
+
+static void TestDeletedFile() {
+    const std::filesystem::path DirectoryPath = MakeEmptyTestDirectory("OutputDirectoryDeleted");
+    WriteBothFiles(DirectoryPath, 2);
+
+    std::filesystem::remove(DirectoryPath / "First.h");
+    WriteBothFiles(DirectoryPath, 1);
+}
+
+///Edit keeps the size of the file, so only its last write time tells it apart from the file as it has been written
+static void TestHandEditedFile() {
+    const std::filesystem::path DirectoryPath = MakeEmptyTestDirectory("OutputDirectoryHandEdited");
+    WriteBothFiles(DirectoryPath, 2);
+
+    const std::filesystem::path FilePath = DirectoryPath / "Second.h";
+    const std::filesystem::file_time_type WriteTime = std::filesystem::last_write_time(FilePath);
+    CHECK(WriteFileContents(FilePath, "#define SECOND_FILE 9\n"));
+    ///Timestamps can be as coarse as the scheduler tick, so the edit is moved a second later, as it would be when made by hand
+    std::filesystem::last_write_time(FilePath, WriteTime + std::chrono::seconds{1});
+    WriteBothFiles(DirectoryPath, 1);
+}
+
+///Edit made within the same tick as the write keeps both the size and the last write time, and the manifest saved right after is just as recent
+static void TestHandEditedFileWithinWriteTimeGranularity() {
+    const std::filesystem::path DirectoryPath = MakeEmptyTestDirectory("OutputDirectoryHandEditedSameTick");
+    WriteBothFiles(DirectoryPath, 2);
+
+    const std::filesystem::path FilePath = DirectoryPath / "Second.h";
+    const std::filesystem::file_time_type WriteTime = std::filesystem::last_write_time(FilePath);
+    CHECK(WriteFileContents(FilePath, "#define SECOND_FILE 9\n"));
+    std::filesystem::last_write_time(FilePath, WriteTime);
+    WriteBothFiles(DirectoryPath, 1);
+}
+
+///Without the manifest there is nothing to compare against, so everything is written again
+static void TestMissingManifest() {
+    const std::filesystem::path DirectoryPath = MakeEmptyTestDirectory("OutputDirectoryMissingManifest");
+    WriteBothFiles(DirectoryPath, 2);
+
+    std::filesystem::remove(DirectoryPath / FOutputDirectory::ManifestFileName);
+    WriteBothFiles(DirectoryPath, 2);
+}
+
+int main() {
+    TestUnchangedRerun();
+    TestChangedContents();
+    TestDeletedFile();
+    TestHandEditedFile();
+    TestHandEditedFileWithinWriteTimeGranularity();
+    TestMissingManifest();
+    return FinishTest("OutputDirectoryTest");
+}
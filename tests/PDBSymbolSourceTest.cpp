@@ -0,0 +1,105 @@
+#include "PDBSymbolSource.h"
+#include "TypeLayoutGenerator.h"
+#include "TestHarness.h"
+
+///AActor has its vftable in the publics, ADerived overrides one of its functions but has no vftable symbol of its own
+static void TestVirtualTableRVALayout() {
+    FPDBSymbolSource Source;
+    CHECK(Source.Open(GetFixturePath("VirtualTable.pdb"), FDumpLog{}));
+    CHECK(Source.GetSession().HasSymbolRVAs());
+
+    FVirtualTableRVALayout ActorLayout{};
+    CHECK(Source.GenerateVirtualTableRVALayout(Source.FindUserDefinedType("AActor"), ActorLayout));
+    CHECK_EQUAL(ActorLayout.ClassName, std::string{"AActor"});
+    CHECK_EQUAL(ActorLayout.VirtualTableRVA, 0x20100u);
+    CHECK_EQUAL(ActorLayout.VirtualFunctions.size(), size_t{2});
+
+    if (ActorLayout.VirtualFunctions.size() == 2) {
+        CHECK_EQUAL(ActorLayout.VirtualFunctions[0].VirtualTableSlot, 0);
+        CHECK_EQUAL(ActorLayout.VirtualFunctions[0].FunctionName, std::string{"Tick"});
+        CHECK_EQUAL(ActorLayout.VirtualFunctions[0].FunctionRVA, 0x1010u);
+        CHECK_EQUAL(ActorLayout.VirtualFunctions[1].VirtualTableSlot, 1);
+        CHECK_EQUAL(ActorLayout.VirtualFunctions[1].FunctionName, std::string{"Foo"});
+        CHECK_EQUAL(ActorLayout.VirtualFunctions[1].FunctionRVA, 0x1030u);
+    }
+    ///Both constructor overloads come from the S_GPROC32 records of the second module, ordered by their RVA
+    CHECK(ActorLayout.ConstructorRVAs == (std::vector<uint32_t>{0x1200, 0x1280}));
+
+    FVirtualTableRVALayout DerivedLayout{};
+    CHECK(Source.FindUserDefinedType("ADerived").IsValid());
+    CHECK(!Source.GenerateVirtualTableRVALayout(Source.FindUserDefinedType("ADerived"), DerivedLayout));
+}
+
+///Procedures of both of the module symbol streams are collected, with their section offsets converted into RVAs
+static void TestModuleProcedures() {
+    FPDBSymbolSource Source;
+    CHECK(Source.Open(GetFixturePath("VirtualTable.pdb"), FDumpLog{}));
+    const FPDBSymbolTable& SymbolTable = Source.GetSession().GetSymbolTable();
+    CHECK_EQUAL(SymbolTable.GetNumProcedures(), size_t{5});
+
+    const std::span<const FProcedureEntry> TickProcedures = SymbolTable.FindProcedures("AActor::Tick");
+    CHECK_EQUAL(TickProcedures.size(), size_t{1});
+    if (TickProcedures.size() == 1) {
+        CHECK_EQUAL(TickProcedures[0].RelativeVirtualAddress, 0x1010u);
+        CHECK_EQUAL(TickProcedures[0].FunctionType, 0x1004u);
+    }
+    const std::span<const FProcedureEntry> DerivedProcedures = SymbolTable.FindProcedures("ADerived::Foo");
+    CHECK_EQUAL(DerivedProcedures.size(), size_t{1});
+    if (DerivedProcedures.size() == 1) {
+        CHECK_EQUAL(DerivedProcedures[0].RelativeVirtualAddress, 0x1060u);
+    }
+    CHECK_EQUAL(SymbolTable.FindProcedures("AActor::AActor").size(), size_t{2});
+    CHECK(SymbolTable.FindProcedures("AActor").empty());
+    CHECK(SymbolTable.FindProcedures("AActor::Missing").empty());
+}
+
+///Only class types with a virtual table symbol get the RVA layout, every other handle is rejected without touching the layout
+static void TestVirtualTableRVALayoutFailures() {
+    FPDBSymbolSource Source;
+    CHECK(Source.Open(GetFixturePath("VirtualTable.pdb"), FDumpLog{}));
+    FVirtualTableRVALayout Layout{};
+    CHECK(!Source.GenerateVirtualTableRVALayout(FSymbolHandle{}, Layout));
+
+    ///Members are not types, even though their handles come from the same class
+    std::vector<FSymbolHandle> Members;
+    Source.GetChildren(Source.FindUserDefinedType("AActor"), ESymbolTag::Data, Members);
+    CHECK(!Members.empty());
+    if (!Members.empty()) {
+        CHECK(!Source.GenerateVirtualTableRVALayout(Members.front(), Layout));
+    }
+
+    ///Structure without any virtual functions has no virtual table to look up
+    const FSymbolHandle PlainSymbol = Source.FindUserDefinedType("FPlain");
+    CHECK(PlainSymbol.IsValid());
+    CHECK(!Source.GenerateVirtualTableRVALayout(PlainSymbol, Layout));
+
+    CHECK(Layout.ClassName.empty());
+    CHECK(Layout.VirtualFunctions.empty());
+    CHECK(Layout.ConstructorRVAs.empty());
+}
+
+///Same types, but the PDB has no section headers, so none of the RVAs can be computed
+static void TestMissingSectionHeaders() {
+    FPDBSymbolSource Source;
+    CHECK(Source.Open(GetFixturePath("VirtualTableNoSectionHeaders.pdb"), FDumpLog{}));
+    CHECK(Source.GetSession().HasSymbols());
+    CHECK(!Source.GetSession().HasSymbolRVAs());
+
+    FVirtualTableRVALayout ActorLayout{};
+    CHECK(!Source.GenerateVirtualTableRVALayout(Source.FindUserDefinedType("AActor"), ActorLayout));
+
+    ///Type layout does not depend on the symbols and is still generated
+    FUserDefinedTypeLayout TypeLayout{};
+    GenerateUserDefinedTypeLayout(Source, Source.FindUserDefinedType("AActor"), TypeLayout);
+    CHECK_EQUAL(TypeLayout.ClassName, std::string{"AActor"});
+    CHECK_EQUAL(TypeLayout.TotalTypeSize, 40);
+    CHECK_EQUAL(TypeLayout.VirtualTableEntriesCount, 2);
+}
+
+int main() {
+    TestVirtualTableRVALayout();
+    TestModuleProcedures();
+    TestVirtualTableRVALayoutFailures();
+    TestMissingSectionHeaders();
+    return FinishTest("PDBSymbolSourceTest");
+}
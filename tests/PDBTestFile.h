@@ -0,0 +1,171 @@
+#pragma once
+
+#include "MSFFile.h"
+#include "PDBTypeStream.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+///Appends the little endian value to the buffer
+template<typename T>
+inline void AppendValue(std::string& Buffer, const T& Value) {
+    Buffer.append(reinterpret_cast<const char*>(&Value), sizeof(T));
+}
+
+///Builds a type record with the given payload, prefixed with its length and kind the same way the records are laid out in the TPI stream
+inline std::string MakeTypeRecord(ELeafKind Kind, std::string_view Payload) {
+    std::string Record;
+    AppendValue(Record, static_cast<uint16_t>(sizeof(uint16_t) + Payload.size()));
+    AppendValue(Record, static_cast<uint16_t>(Kind));
+    Record.append(Payload);
+    return Record;
+}
+
+///First type index of the TPI stream, everything below it is a simple type
+static constexpr uint32_t TestTypeIndexBegin = 0x1000;
+
+/**
+ * Builds the TPI stream with the given records back to back, and the hash stream with an IndexOffsetBuffer entry every RecordsPerChunk records
+ * The hash values and the adjusters are left out, so the stream can only be read by the type index, which is all the chunked decoding needs
+ */
+inline void MakeTypeStream(const std::vector<std::string>& Records, uint32_t RecordsPerChunk, uint16_t HashStreamIndex, std::string& OutTypeStream, std::string& OutHashStream) {
+    std::string RecordData;
+    OutHashStream.clear();
+    for (size_t RecordIndex = 0; RecordIndex < Records.size(); RecordIndex++) {
+        if (RecordIndex % RecordsPerChunk == 0) {
+            AppendValue(OutHashStream, FTypeIndexOffset{static_cast<uint32_t>(TestTypeIndexBegin + RecordIndex), static_cast<uint32_t>(RecordData.size())});
+        }
+        RecordData.append(Records[RecordIndex]);
+    }
+
+    FTypeStreamHeader Header{};
+    Header.Version = 20040203;
+    Header.HeaderSize = sizeof(FTypeStreamHeader);
+    Header.TypeIndexBegin = TestTypeIndexBegin;
+    Header.TypeIndexEnd = static_cast<uint32_t>(TestTypeIndexBegin + Records.size());
+    Header.TypeRecordBytes = static_cast<uint32_t>(RecordData.size());
+    Header.HashStreamIndex = HashStreamIndex;
+    Header.HashAuxStreamIndex = InvalidStreamIndex;
+    Header.HashKeySize = sizeof(uint32_t);
+    Header.NumHashBuckets = 0x3FFFF;
+    Header.IndexOffsetBufferOffset = 0;
+    Header.IndexOffsetBufferLength = static_cast<uint32_t>(OutHashStream.size());
+
+    OutTypeStream.clear();
+    AppendValue(OutTypeStream, Header);
+    OutTypeStream.append(RecordData);
+}
+
+///Placement of the blocks of the test MSF files
+struct FTestMSFLayout {
+    uint32_t BlockSize{4096};
+    ///Hands out the blocks of the streams round robin, so every stream with more than one block is scattered over the file
+    bool bInterleaveStreams{false};
+    ///Block the first stream starts at. Blocks between the free block maps and it are left as a hole of the sparse file
+    uint32_t FirstStreamBlock{3};
+};
+
+/**
+ * Writes the streams into a MSF 7.00 container, placing the stream index of every stream at its position in the list
+ * Blocks are laid out in order: the super block, both free block maps, the blocks of the streams, the directory, and the block map of the directory
+ * The block map spans as many blocks as the directory needs, all of them listed after BlockMapAddr in the super block
+ * The free block maps are left empty, as the reader never looks at them. Only the written blocks take space on the file systems with sparse files
+ * Returns false if the file cannot be written or the block map blocks do not fit into the super block
+ */
+inline bool WriteTestMSFFile(const std::filesystem::path& FilePath, const std::vector<std::string>& Streams, const FTestMSFLayout& Layout = {}) {
+    const uint32_t BlockSize = Layout.BlockSize;
+    const auto GetNumBlocks = [BlockSize](uint64_t Size) {
+        return static_cast<uint32_t>((Size + BlockSize - 1) / BlockSize);
+    };
+    uint32_t NextBlock = Layout.FirstStreamBlock;
+
+    std::vector<std::vector<uint32_t>> StreamBlocks(Streams.size());
+    for (uint32_t Round = 0, NumAssignedStreams = 1; NumAssignedStreams != 0; Round++) {
+        NumAssignedStreams = 0;
+        for (size_t StreamIndex = 0; StreamIndex < Streams.size(); StreamIndex++) {
+            const uint32_t NumStreamBlocks = GetNumBlocks(Streams[StreamIndex].size());
+            ///Contiguous layout assigns all of the blocks of the stream in its first round
+            const uint32_t NumRoundBlocks = Layout.bInterleaveStreams ? (Round < NumStreamBlocks ? 1 : 0) : (Round == 0 ? NumStreamBlocks : 0);
+            for (uint32_t BlockIndex = 0; BlockIndex < NumRoundBlocks; BlockIndex++) {
+                StreamBlocks[StreamIndex].push_back(NextBlock++);
+            }
+            NumAssignedStreams += NumRoundBlocks != 0 ? 1 : 0;
+        }
+    }
+
+    std::string Directory;
+    AppendValue(Directory, static_cast<uint32_t>(Streams.size()));
+    for (const std::string& Stream : Streams) {
+        AppendValue(Directory, static_cast<uint32_t>(Stream.size()));
+    }
+    for (const std::vector<uint32_t>& Blocks : StreamBlocks) {
+        for (const uint32_t Block : Blocks) {
+            AppendValue(Directory, Block);
+        }
+    }
+    const uint32_t DirectoryFirstBlock = NextBlock;
+    NextBlock += GetNumBlocks(Directory.size());
+
+    std::string BlockMap;
+    for (uint32_t BlockIndex = 0; BlockIndex < GetNumBlocks(Directory.size()); BlockIndex++) {
+        AppendValue(BlockMap, DirectoryFirstBlock + BlockIndex);
+    }
+    const uint32_t BlockMapFirstBlock = NextBlock;
+    const uint32_t NumBlockMapBlocks = GetNumBlocks(BlockMap.size());
+    NextBlock += NumBlockMapBlocks;
+    if (offsetof(FMSFSuperBlock, BlockMapAddr) + NumBlockMapBlocks * sizeof(uint32_t) > BlockSize) {
+        return false;
+    }
+
+    std::string SuperBlockData;
+    FMSFSuperBlock SuperBlock{};
+    memcpy(SuperBlock.FileMagic, "Microsoft C/C++ MSF 7.00\r\n\x1a" "DS\0\0", sizeof(SuperBlock.FileMagic));
+    SuperBlock.BlockSize = BlockSize;
+    SuperBlock.FreeBlockMapBlock = 1;
+    SuperBlock.NumBlocks = NextBlock;
+    SuperBlock.NumDirectoryBytes = static_cast<uint32_t>(Directory.size());
+    SuperBlock.BlockMapAddr = BlockMapFirstBlock;
+    AppendValue(SuperBlockData, SuperBlock);
+    for (uint32_t BlockIndex = 1; BlockIndex < NumBlockMapBlocks; BlockIndex++) {
+        AppendValue(SuperBlockData, BlockMapFirstBlock + BlockIndex);
+    }
+
+    std::ofstream FileStream{FilePath, std::ios::binary | std::ios::trunc};
+    const auto WriteAtBlock = [&](uint32_t Block, const char* Data, size_t Size) {
+        FileStream.seekp(static_cast<std::streamoff>(static_cast<uint64_t>(Block) * BlockSize));
+        FileStream.write(Data, static_cast<std::streamsize>(Size));
+    };
+    WriteAtBlock(0, SuperBlockData.data(), SuperBlockData.size());
+    for (size_t StreamIndex = 0; StreamIndex < Streams.size(); StreamIndex++) {
+        for (size_t BlockIndex = 0; BlockIndex < StreamBlocks[StreamIndex].size(); BlockIndex++) {
+            const size_t BlockOffset = BlockIndex * BlockSize;
+            WriteAtBlock(StreamBlocks[StreamIndex][BlockIndex], Streams[StreamIndex].data() + BlockOffset, std::min<size_t>(BlockSize, Streams[StreamIndex].size() - BlockOffset));
+        }
+    }
+    WriteAtBlock(DirectoryFirstBlock, Directory.data(), Directory.size());
+    WriteAtBlock(BlockMapFirstBlock, BlockMap.data(), BlockMap.size());
+    FileStream.close();
+    if (!FileStream) {
+        return false;
+    }
+    ///Last blocks are only partially written, the file still has to contain every block the super block counts
+    std::error_code ErrorCode;
+    std::filesystem::resize_file(FilePath, static_cast<uint64_t>(NextBlock) * BlockSize, ErrorCode);
+    return !ErrorCode;
+}
+
+///Stream index of the TPI hash stream in the test files, right after the fixed streams
+static constexpr uint16_t TestTypeHashStreamIndex = 5;
+
+///Writes the PDB file containing only the TPI stream with the given records and its hash stream
+inline bool WriteTestTypeStreamFile(const std::filesystem::path& FilePath, const std::vector<std::string>& Records, uint32_t RecordsPerChunk) {
+    std::vector<std::string> Streams(TestTypeHashStreamIndex + 1);
+    MakeTypeStream(Records, RecordsPerChunk, TestTypeHashStreamIndex, Streams[static_cast<size_t>(EPDBFixedStream::TPI)], Streams[TestTypeHashStreamIndex]);
+    return WriteTestMSFFile(FilePath, Streams);
+}
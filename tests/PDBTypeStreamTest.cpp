@@ -0,0 +1,290 @@
+#include "PDBFieldList.h"
+#include "PDBForwardReferenceTable.h"
+#include "PDBHash.h"
+#include "PDBTestFile.h"
+#include "PDBTypeNameIndex.h"
+#include "TestHarness.h"
+
+static constexpr uint32_t NumTestRecords = 64;
+static constexpr uint32_t RecordsPerChunk = 16;
+
+///Records of varying size, each carrying its own position so that a record decoded from the wrong offset is noticed
+static std::vector<std::string> MakeTestRecords() {
+    std::vector<std::string> Records;
+    for (uint32_t RecordIndex = 0; RecordIndex < NumTestRecords; RecordIndex++) {
+        std::string Payload;
+        AppendValue(Payload, RecordIndex);
+        Payload.append((RecordIndex % 5) * 4, '\0');
+        Records.push_back(MakeTypeRecord(RecordIndex % 2 ? ELeafKind::Pointer : ELeafKind::Modifier, Payload));
+    }
+    return Records;
+}
+
+static bool IsExpectedRecord(const FPDBTypeStream& TypeStream, uint32_t RecordIndex) {
+    const FTypeRecord Record = TypeStream.GetRecord(TestTypeIndexBegin + RecordIndex);
+    if (!Record.IsValid() || Record.Kind != (RecordIndex % 2 ? ELeafKind::Pointer : ELeafKind::Modifier) || Record.Data.size() != sizeof(uint32_t) + (RecordIndex % 5) * 4) {
+        return false;
+    }
+    uint32_t StoredRecordIndex = 0;
+    memcpy(&StoredRecordIndex, Record.Data.data(), sizeof(uint32_t));
+    return StoredRecordIndex == RecordIndex;
+}
+
+///Makes the length prefix of the record claim more bytes than the record has, without changing the record itself
+static void ExtendRecordLength(std::string& Record, uint16_t NumExtraBytes) {
+    uint16_t RecordLength = 0;
+    memcpy(&RecordLength, Record.data(), sizeof(uint16_t));
+    RecordLength += NumExtraBytes;
+    memcpy(Record.data(), &RecordLength, sizeof(uint16_t));
+}
+
+static void TestWellFormedChunks(const std::filesystem::path& DirectoryPath) {
+    const std::filesystem::path FilePath = DirectoryPath / "WellFormed.pdb";
+    CHECK(WriteTestTypeStreamFile(FilePath, MakeTestRecords(), RecordsPerChunk));
+
+    FMSFFile MSFFile;
+    FPDBTypeStream TypeStream;
+    CHECK(MSFFile.Open(FilePath, FDumpLog{}) && TypeStream.Open(MSFFile, EPDBFixedStream::TPI, FDumpLog{}));
+    CHECK_EQUAL(TypeStream.GetNumChunks(), size_t{NumTestRecords / RecordsPerChunk});
+    CHECK(TypeStream.BuildFullIndex());
+
+    for (uint32_t RecordIndex = 0; RecordIndex < NumTestRecords; RecordIndex++) {
+        CHECK(IsExpectedRecord(TypeStream, RecordIndex));
+    }
+    CHECK(!TypeStream.GetRecord(TestTypeIndexBegin + NumTestRecords).IsValid());
+}
+
+///Lazily decoded chunks give the same records as the full index
+static void TestLazyDecoding(const std::filesystem::path& DirectoryPath) {
+    const std::filesystem::path FilePath = DirectoryPath / "Lazy.pdb";
+    CHECK(WriteTestTypeStreamFile(FilePath, MakeTestRecords(), RecordsPerChunk));
+
+    FMSFFile MSFFile;
+    FPDBTypeStream TypeStream;
+    CHECK(MSFFile.Open(FilePath, FDumpLog{}) && TypeStream.Open(MSFFile, EPDBFixedStream::TPI, FDumpLog{}));
+    for (uint32_t RecordIndex = NumTestRecords; RecordIndex-- > 0;) {
+        CHECK(IsExpectedRecord(TypeStream, RecordIndex));
+    }
+}
+
+///Last record of the second chunk claims to be longer than it is, running into the records of the third chunk
+static void TestRecordCrossingChunkBoundary(const std::filesystem::path& DirectoryPath) {
+    std::vector<std::string> Records = MakeTestRecords();
+    const uint32_t CrossingRecordIndex = RecordsPerChunk * 2 - 1;
+    ExtendRecordLength(Records[CrossingRecordIndex], 4);
+
+    const std::filesystem::path FilePath = DirectoryPath / "CrossingRecord.pdb";
+    CHECK(WriteTestTypeStreamFile(FilePath, Records, RecordsPerChunk));
+
+    FMSFFile MSFFile;
+    FPDBTypeStream TypeStream;
+    CHECK(MSFFile.Open(FilePath, FDumpLog{}) && TypeStream.Open(MSFFile, EPDBFixedStream::TPI, FDumpLog{}));
+    CHECK(!TypeStream.BuildFullIndex());
+
+    CHECK(!TypeStream.GetRecord(TestTypeIndexBegin + CrossingRecordIndex).IsValid());
+    ///Records before the broken one, and the records of the other chunks, are still decoded from their own offsets
+    CHECK(IsExpectedRecord(TypeStream, CrossingRecordIndex - 1));
+    CHECK(IsExpectedRecord(TypeStream, 0));
+    CHECK(IsExpectedRecord(TypeStream, CrossingRecordIndex + 1));
+    CHECK(IsExpectedRecord(TypeStream, NumTestRecords - 1));
+}
+
+///Record running past the end of the stream is rejected the same way, the last chunk has no next chunk to run into
+static void TestRecordCrossingStreamEnd(const std::filesystem::path& DirectoryPath) {
+    std::vector<std::string> Records = MakeTestRecords();
+    ExtendRecordLength(Records.back(), 4);
+
+    const std::filesystem::path FilePath = DirectoryPath / "TruncatedRecord.pdb";
+    CHECK(WriteTestTypeStreamFile(FilePath, Records, RecordsPerChunk));
+
+    FMSFFile MSFFile;
+    FPDBTypeStream TypeStream;
+    CHECK(MSFFile.Open(FilePath, FDumpLog{}) && TypeStream.Open(MSFFile, EPDBFixedStream::TPI, FDumpLog{}));
+    CHECK(!TypeStream.BuildFullIndex());
+    CHECK(!TypeStream.GetRecord(TestTypeIndexBegin + NumTestRecords - 1).IsValid());
+    CHECK(IsExpectedRecord(TypeStream, NumTestRecords - 2));
+}
+
+///LF_MEMBER entry of an int member at offset 0
+static std::string MakeMemberEntry(std::string_view Name) {
+    std::string Entry;
+    AppendValue(Entry, static_cast<uint16_t>(ELeafKind::Member));
+    AppendValue(Entry, uint16_t{3});
+    AppendValue(Entry, uint32_t{0x74});
+    AppendValue(Entry, uint16_t{0});
+    Entry.append(Name);
+    Entry.push_back('\0');
+    return Entry;
+}
+
+///LF_INDEX entry continuing the field list in the given record
+static std::string MakeIndexEntry(uint32_t ContinuationTypeIndex) {
+    std::string Entry;
+    AppendValue(Entry, static_cast<uint16_t>(ELeafKind::Index));
+    AppendValue(Entry, uint16_t{0});
+    AppendValue(Entry, ContinuationTypeIndex);
+    return Entry;
+}
+
+///Names of the members the field list yields before it ends or is found malformed
+static std::vector<std::string> CollectMemberNames(const FPDBTypeStream& TypeStream, uint32_t FieldListTypeIndex, bool& bOutMalformed) {
+    std::vector<std::string> MemberNames;
+    FFieldListIterator Iterator{TypeStream, FieldListTypeIndex};
+    FFieldRecord FieldRecord{};
+    while (Iterator.Next(FieldRecord)) {
+        MemberNames.emplace_back(FieldRecord.Name);
+    }
+    bOutMalformed = Iterator.IsMalformed();
+    return MemberNames;
+}
+
+///Continuations are followed into earlier records only, so continuations pointing at the record itself or forward into a cycle end the field list
+static void TestFieldListContinuations(const std::filesystem::path& DirectoryPath) {
+    const std::vector<std::string> Records{
+        MakeTypeRecord(ELeafKind::FieldList, MakeMemberEntry("Second")),
+        MakeTypeRecord(ELeafKind::FieldList, MakeMemberEntry("First") + MakeIndexEntry(TestTypeIndexBegin)),
+        MakeTypeRecord(ELeafKind::FieldList, MakeMemberEntry("Self") + MakeIndexEntry(TestTypeIndexBegin + 2)),
+        MakeTypeRecord(ELeafKind::FieldList, MakeMemberEntry("Forward") + MakeIndexEntry(TestTypeIndexBegin + 4)),
+        MakeTypeRecord(ELeafKind::FieldList, MakeMemberEntry("Back") + MakeIndexEntry(TestTypeIndexBegin + 3)),
+    };
+    const std::filesystem::path FilePath = DirectoryPath / "FieldListContinuations.pdb";
+    CHECK(WriteTestTypeStreamFile(FilePath, Records, RecordsPerChunk));
+
+    FMSFFile MSFFile;
+    FPDBTypeStream TypeStream;
+    CHECK(MSFFile.Open(FilePath, FDumpLog{}) && TypeStream.Open(MSFFile, EPDBFixedStream::TPI, FDumpLog{}));
+
+    bool bMalformed = false;
+    CHECK(CollectMemberNames(TypeStream, TestTypeIndexBegin + 1, bMalformed) == (std::vector<std::string>{"First", "Second"}));
+    CHECK(!bMalformed);
+    CHECK(CollectMemberNames(TypeStream, TestTypeIndexBegin + 2, bMalformed) == std::vector<std::string>{"Self"});
+    CHECK(bMalformed);
+    CHECK(CollectMemberNames(TypeStream, TestTypeIndexBegin + 3, bMalformed) == std::vector<std::string>{"Forward"});
+    CHECK(bMalformed);
+    CHECK(CollectMemberNames(TypeStream, TestTypeIndexBegin + 4, bMalformed) == (std::vector<std::string>{"Back", "Forward"}));
+    CHECK(bMalformed);
+}
+
+///LF_STRUCTURE record with no fields, carrying the unique name only if one is given
+static std::string MakeStructureRecord(std::string_view Name, std::string_view UniqueName, bool bForwardReference) {
+    std::string Payload;
+    AppendValue(Payload, uint16_t{0});
+    AppendValue(Payload, static_cast<uint16_t>((bForwardReference ? CO_ForwardReference : 0) | (UniqueName.empty() ? 0 : CO_HasUniqueName)));
+    AppendValue(Payload, uint32_t{0});
+    AppendValue(Payload, uint32_t{0});
+    AppendValue(Payload, uint32_t{0});
+    AppendValue(Payload, static_cast<uint16_t>(bForwardReference ? 0 : 8));
+    Payload.append(Name);
+    Payload.push_back('\0');
+    if (!UniqueName.empty()) {
+        Payload.append(UniqueName);
+        Payload.push_back('\0');
+    }
+    return MakeTypeRecord(ELeafKind::Structure, Payload);
+}
+
+///Unique names are only compared when both records carry one, and a different unique name on both sides is a different type
+static void TestForwardReferenceResolution(const std::filesystem::path& DirectoryPath) {
+    const std::vector<std::string> Records{
+        MakeStructureRecord("FOnlyForwardUnique", ".?AUFOnlyForwardUnique@@", true),
+        MakeStructureRecord("FOnlyForwardUnique", "", false),
+        MakeStructureRecord("FOnlyDefinitionUnique", "", true),
+        MakeStructureRecord("FOnlyDefinitionUnique", ".?AUFOnlyDefinitionUnique@@", false),
+        MakeStructureRecord("FAnonymous", ".?AUFAnonymous@?A0x1@@", true),
+        MakeStructureRecord("FAnonymous", ".?AUFAnonymous@?A0x2@@", false),
+        MakeStructureRecord("FAnonymous", ".?AUFAnonymous@?A0x1@@", false),
+        MakeStructureRecord("FOtherAnonymous", ".?AUFOtherAnonymous@?A0x1@@", true),
+        MakeStructureRecord("FOtherAnonymous", ".?AUFOtherAnonymous@?A0x2@@", false),
+    };
+    const std::filesystem::path FilePath = DirectoryPath / "ForwardReferences.pdb";
+    CHECK(WriteTestTypeStreamFile(FilePath, Records, 4));
+
+    FMSFFile MSFFile;
+    FPDBTypeStream TypeStream;
+    CHECK(MSFFile.Open(FilePath, FDumpLog{}) && TypeStream.Open(MSFFile, EPDBFixedStream::TPI, FDumpLog{}));
+    FPDBForwardReferenceTable ForwardReferenceTable;
+    ForwardReferenceTable.Build(TypeStream);
+
+    CHECK_EQUAL(ForwardReferenceTable.ResolveForwardReference(TestTypeIndexBegin), TestTypeIndexBegin + 1);
+    CHECK_EQUAL(ForwardReferenceTable.ResolveForwardReference(TestTypeIndexBegin + 2), TestTypeIndexBegin + 3);
+    CHECK_EQUAL(ForwardReferenceTable.ResolveForwardReference(TestTypeIndexBegin + 4), TestTypeIndexBegin + 6);
+    CHECK_EQUAL(ForwardReferenceTable.ResolveForwardReference(TestTypeIndexBegin + 7), TestTypeIndexBegin + 7);
+    CHECK_EQUAL(ForwardReferenceTable.GetNumEntries(), size_t{3});
+}
+
+///Writes the PDB file whose hash stream also carries the given hash value of every record, placed after the IndexOffsetBuffer
+static bool WriteHashedTypeStreamFile(const std::filesystem::path& FilePath, const std::vector<std::string>& Records, const std::vector<uint32_t>& HashValues) {
+    std::vector<std::string> Streams(TestTypeHashStreamIndex + 1);
+    std::string& TypeStream = Streams[static_cast<size_t>(EPDBFixedStream::TPI)];
+    std::string& HashStream = Streams[TestTypeHashStreamIndex];
+    MakeTypeStream(Records, RecordsPerChunk, TestTypeHashStreamIndex, TypeStream, HashStream);
+
+    FTypeStreamHeader Header{};
+    memcpy(&Header, TypeStream.data(), sizeof(Header));
+    Header.HashValueBufferOffset = static_cast<int32_t>(HashStream.size());
+    Header.HashValueBufferLength = static_cast<uint32_t>(HashValues.size() * sizeof(uint32_t));
+    memcpy(TypeStream.data(), &Header, sizeof(Header));
+    for (const uint32_t HashValue : HashValues) {
+        AppendValue(HashStream, HashValue);
+    }
+    return WriteTestMSFFile(FilePath, Streams);
+}
+
+///Validated hash stream is trusted, so a type missing from the bucket of its name is not searched for in the rest of the stream
+static void TestHashedTypeNameIndex(const std::filesystem::path& DirectoryPath) {
+    const std::vector<std::string> Records{
+        MakeStructureRecord("FHashed", "", true),
+        MakeStructureRecord("FHashed", "", false),
+        MakeStructureRecord("FMisplaced", "", false),
+    };
+    constexpr uint32_t NumHashBuckets = 0x3FFFF;
+    const uint32_t HashedBucket = HashStringV1("FHashed") % NumHashBuckets;
+    const std::vector<uint32_t> HashValues{HashedBucket, HashedBucket, (HashStringV1("FMisplaced") + 1) % NumHashBuckets};
+    const std::filesystem::path FilePath = DirectoryPath / "HashedTypeNames.pdb";
+    CHECK(WriteHashedTypeStreamFile(FilePath, Records, HashValues));
+
+    FMSFFile MSFFile;
+    FPDBTypeStream TypeStream;
+    CHECK(MSFFile.Open(FilePath, FDumpLog{}) && TypeStream.Open(MSFFile, EPDBFixedStream::TPI, FDumpLog{}));
+    FPDBTypeNameIndex TypeNameIndex;
+    TypeNameIndex.Build(TypeStream);
+
+    CHECK_EQUAL(TypeNameIndex.FindUserDefinedType("FHashed"), TestTypeIndexBegin + 1);
+    CHECK_EQUAL(TypeNameIndex.FindUserDefinedType("FMisplaced"), uint32_t{0});
+    CHECK_EQUAL(TypeNameIndex.FindUserDefinedType("FMissing"), uint32_t{0});
+}
+
+///Without the hash values, every UDT record is found by one pass over the stream, the definitions taking over the forward declarations
+static void TestUnhashedTypeNameIndex(const std::filesystem::path& DirectoryPath) {
+    const std::vector<std::string> Records{
+        MakeStructureRecord("FDefined", "", true),
+        MakeStructureRecord("FDefined", "", false),
+        MakeStructureRecord("FDeclared", "", true),
+    };
+    const std::filesystem::path FilePath = DirectoryPath / "UnhashedTypeNames.pdb";
+    CHECK(WriteTestTypeStreamFile(FilePath, Records, RecordsPerChunk));
+
+    FMSFFile MSFFile;
+    FPDBTypeStream TypeStream;
+    CHECK(MSFFile.Open(FilePath, FDumpLog{}) && TypeStream.Open(MSFFile, EPDBFixedStream::TPI, FDumpLog{}));
+    FPDBTypeNameIndex TypeNameIndex;
+    TypeNameIndex.Build(TypeStream);
+
+    CHECK_EQUAL(TypeNameIndex.FindUserDefinedType("FDefined"), TestTypeIndexBegin + 1);
+    CHECK_EQUAL(TypeNameIndex.FindUserDefinedType("FDeclared"), TestTypeIndexBegin + 2);
+    CHECK_EQUAL(TypeNameIndex.FindUserDefinedType("FMissing"), uint32_t{0});
+}
+
+int main() {
+    const std::filesystem::path DirectoryPath = MakeEmptyTestDirectory("PDBTypeStreamTestFiles");
+
+    TestWellFormedChunks(DirectoryPath);
+    TestLazyDecoding(DirectoryPath);
+    TestRecordCrossingChunkBoundary(DirectoryPath);
+    TestRecordCrossingStreamEnd(DirectoryPath);
+    TestFieldListContinuations(DirectoryPath);
+    TestForwardReferenceResolution(DirectoryPath);
+    TestHashedTypeNameIndex(DirectoryPath);
+    TestUnhashedTypeNameIndex(DirectoryPath);
+    return FinishTest("PDBTypeStreamTest");
+}
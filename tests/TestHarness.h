@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+///Number of the checks of the test executable that have failed so far
+inline int32_t& GetNumFailedChecks() {
+    static int32_t NumFailedChecks = 0;
+    return NumFailedChecks;
+}
+
+///Writes through the wide streams, as once FDumpLog has written to stderr or stdout the narrow writes to them are dropped
+inline void ReportFailedCheck(const char* FileName, int32_t LineNumber, const std::string& Message) {
+    GetNumFailedChecks()++;
+    std::wcerr << FileName << ":" << LineNumber << ": check failed: " << Message.c_str() << std::endl;
+}
+
+///Reports the failed check without stopping the test, so a single run lists every check that does not hold
+#define CHECK(Condition) \
+    do { if (!(Condition)) { ReportFailedCheck(__FILE__, __LINE__, #Condition); } } while (false)
+
+#define CHECK_EQUAL(Actual, Expected) \
+    do { \
+        const auto& ActualValue = (Actual); \
+        const auto& ExpectedValue = (Expected); \
+        if (!(ActualValue == ExpectedValue)) { \
+            std::ostringstream CheckMessage; \
+            CheckMessage << #Actual << " == " << #Expected << "\n--- actual:\n" << ActualValue << "\n--- expected:\n" << ExpectedValue; \
+            ReportFailedCheck(__FILE__, __LINE__, CheckMessage.str()); \
+        } \
+    } while (false)
+
+///Exit code of the test executable
+inline int32_t FinishTest(const char* TestName) {
+    if (GetNumFailedChecks() != 0) {
+        std::wcerr << TestName << ": " << GetNumFailedChecks() << " checks failed" << std::endl;
+        return 1;
+    }
+    std::wcout << TestName << ": all checks passed" << std::endl;
+    return 0;
+}
+
+///Reads the whole file as bytes. Returns an empty string if the file cannot be opened
+inline std::string ReadFileContents(const std::filesystem::path& FilePath) {
+    std::ifstream FileStream{FilePath, std::ios::binary};
+    std::ostringstream Contents;
+    Contents << FileStream.rdbuf();
+    return Contents.str();
+}
+
+///Returns the path of the debug file committed in tests/Fixtures
+inline std::filesystem::path GetFixturePath(const std::string& FileName) {
+    return std::filesystem::path{UVTD_TEST_FIXTURES_DIR} / FileName;
+}
+
+///Returns an empty directory for the test to write into, removing whatever a previous run has left there
+inline std::filesystem::path MakeEmptyTestDirectory(const std::string& DirectoryName) {
+    const std::filesystem::path DirectoryPath = std::filesystem::current_path() / DirectoryName;
+    std::filesystem::remove_all(DirectoryPath);
+    std::filesystem::create_directories(DirectoryPath);
+    return DirectoryPath;
+}
@@ -0,0 +1,188 @@
+#include "MemorySymbolSource.h"
+#include "TypeLayoutGenerator.h"
+#include "TestHarness.h"
+
+///Builds a small UObject-like hierarchy covering the base classes, the member kinds and the virtual functions the generator handles
+static void AddSyntheticTypes(FMemorySymbolSource& Source) {
+    const FSymbolHandle Void = Source.AddBasicType(EBasicType::Void, 0);
+    const FSymbolHandle Int32 = Source.AddBasicType(EBasicType::Int, 4);
+    const FSymbolHandle UInt8 = Source.AddBasicType(EBasicType::UInt, 1);
+    const FSymbolHandle Bool = Source.AddBasicType(EBasicType::Bool, 1);
+    const FSymbolHandle ConstTChar = Source.AddBasicType(EBasicType::WChar, 2, true);
+
+    FSymbolInfo EnumInfo{};
+    EnumInfo.Tag = ESymbolTag::Enum;
+    EnumInfo.Length = 4;
+    const FSymbolHandle ObjectFlags = Source.AddSymbol("EObjectFlags", EnumInfo);
+
+    const FSymbolHandle FName = Source.AddUserDefinedType("FName", EUDTKind::Struct, 8, true);
+    Source.AddMemberVariable(FName, "ComparisonIndex", Int32, 0);
+    Source.AddMemberVariable(FName, "Number", Int32, 4);
+
+    const FSymbolHandle UObjectBase = Source.AddUserDefinedType("UObjectBase", EUDTKind::Class, 0x28, true);
+    const FSymbolHandle UObjectBasePointer = Source.AddPointerType(UObjectBase);
+    const FSymbolHandle UObject = Source.AddUserDefinedType("UObject", EUDTKind::Class, 0x48, true);
+    const FSymbolHandle UObjectPointer = Source.AddPointerType(UObject);
+    Source.SetSourceLine(UObject, "Runtime/CoreUObject/Public/UObject/Object.h", 42);
+
+    Source.AddVirtualFunction(UObjectBase, "~UObjectBase", Source.AddFunctionType(Void, {}, UObjectBase), 0);
+    Source.AddMemberVariable(UObjectBase, "ObjectFlags", ObjectFlags, 8, EMemberAccess::Private);
+    Source.AddMemberVariable(UObjectBase, "InternalIndex", Int32, 12, EMemberAccess::Private);
+    Source.AddMemberVariable(UObjectBase, "ClassPrivate", UObjectBasePointer, 16, EMemberAccess::Private);
+    Source.AddMemberVariable(UObjectBase, "NamePrivate", FName, 24, EMemberAccess::Private);
+
+    Source.AddBaseClass(UObject, UObjectBase, 0);
+    Source.AddVirtualFunction(UObject, "~UObject", Source.AddFunctionType(Void, {}, UObject), 0, false);
+    Source.AddVirtualFunction(UObject, "GetDetailedInfo", Source.AddFunctionType(Source.AddPointerType(ConstTChar), {}, UObject), 8);
+    Source.AddVirtualFunction(UObject, "Rename", Source.AddFunctionType(Bool, {ConstTChar, UObjectPointer}, UObject), 16, true, EMemberAccess::Protected);
+    Source.AddMemberVariable(UObject, "Outer", UObjectPointer, 0x28);
+    Source.AddMemberVariable(UObject, "Names", Source.AddArrayType(FName, 2), 0x30);
+    Source.AddMemberVariable(UObject, "Bytes", Source.AddArrayType(UInt8, 3), 0x40);
+    Source.AddBitfield(UObject, "bIsPendingKill", UInt8, 0x43, 0, 1, EMemberAccess::Protected);
+    Source.AddBitfield(UObject, "bIsRooted", UInt8, 0x43, 1, 1, EMemberAccess::Protected);
+    Source.AddMemberVariable(UObject, "Trailing", Source.AddArrayType(UInt8, 0), 0x44, EMemberAccess::Private);
+}
+
+static const char* const ExpectedUObjectLayout =
+R"(/* Generated file for UDT 'UObject' */
+/* Declared in 'Runtime/CoreUObject/Public/UObject/Object.h' at line 42 */
+
+#define VIRTUAL_FUNCTION_COUNT_UObject 3
+
+#define IMPLEMENT_MEMBER_VARIABLE_LAYOUT_UObject \
+public: \
+    class UObject* Outer; \
+    FName Names[2]; \
+    uint8 Bytes[3]; \
+protected: \
+    uint8 bIsPendingKill: 1; \
+    uint8 bIsRooted: 1; \
+private: \
+    uint8 Trailing[0]; \
+
+
+#define IMPLEMENT_VIRTUAL_TABLE_LAYOUT_UObject \
+public: \
+    virtual const TCHAR* GetDetailedInfo() { return nullptr; }; \
+protected: \
+    virtual bool Rename(const TCHAR, class UObject*) { return 0; }; \
+
+
+#define IMPLEMENT_NO_INIT_CONSTRUCTOR_UObject \
+    explicit inline UObject(ENoInit) : \
+        UObjectBase(NoInit), \
+        Names{FName(NoInit), FName(NoInit)} \
+    {} \
+
+#define IMPLEMENT_FORCE_INIT_CONSTRUCTOR_UObject \
+    explicit inline UObject(EForceInit) : \
+        Outer(nullptr), \
+        Bytes{0, 0, 0}, \
+        bIsPendingKill(0), \
+        bIsRooted(0), \
+        Trailing{} \
+    {} \
+
+)";
+
+static const char* const ExpectedUObjectBaseLayout =
+R"(/* Generated file for UDT 'UObjectBase' */
+
+#define VIRTUAL_FUNCTION_COUNT_UObjectBase 1
+
+#define IMPLEMENT_MEMBER_VARIABLE_LAYOUT_UObjectBase \
+private: \
+    EObjectFlags ObjectFlags; \
+    int32 InternalIndex; \
+    class UObjectBase* ClassPrivate; \
+    FName NamePrivate; \
+
+
+#define IMPLEMENT_VIRTUAL_TABLE_LAYOUT_UObjectBase \
+public: \
+    virtual void ~UObjectBase() {}; \
+
+
+#define IMPLEMENT_NO_INIT_CONSTRUCTOR_UObjectBase \
+    explicit inline UObjectBase(ENoInit) : \
+        NamePrivate(NoInit) \
+    {} \
+
+#define IMPLEMENT_FORCE_INIT_CONSTRUCTOR_UObjectBase \
+    explicit inline UObjectBase(EForceInit) : \
+        ObjectFlags((EObjectFlags) 0), \
+        InternalIndex(0), \
+        ClassPrivate(nullptr) \
+    {} \
+
+)";
+
+static void TestUserDefinedTypeLayout(const FMemorySymbolSource& Source) {
+    FUserDefinedTypeLayout TypeLayout{};
+    GenerateUserDefinedTypeLayout(Source, Source.FindUserDefinedType("UObject"), TypeLayout);
+
+    CHECK_EQUAL(TypeLayout.ClassName, std::string{"UObject"});
+    CHECK_EQUAL(TypeLayout.TotalTypeSize, 0x48);
+    CHECK_EQUAL(TypeLayout.VirtualTableEntriesCount, 3);
+    CHECK_EQUAL(TypeLayout.ParentClasses.size(), size_t{1});
+    CHECK_EQUAL(TypeLayout.MemberVariables.size(), size_t{6});
+    ///Override of the destructor is not an intro virtual, so it is not a part of the layout
+    CHECK_EQUAL(TypeLayout.VirtualFunctions.size(), size_t{2});
+
+    if (TypeLayout.MemberVariables.size() == 6) {
+        const FMemberVariable& Names = TypeLayout.MemberVariables[1];
+        CHECK(Names.bIsArray && Names.bIsUDT && Names.bNeedsNoInitConstructorCall);
+        CHECK_EQUAL(Names.ArraySize, 2);
+        CHECK_EQUAL(Names.VariableType, std::string{"FName"});
+
+        const FMemberVariable& Rooted = TypeLayout.MemberVariables[4];
+        CHECK(Rooted.bIsBitfield);
+        CHECK_EQUAL(Rooted.BitfieldBitPosition, 1);
+        CHECK_EQUAL(Rooted.VariableSize, 1);
+    }
+    CHECK_EQUAL(GenerateTypeDeclarationForSymbol(Source, Source.FindUserDefinedType("FName")), std::string{"FName"});
+    CHECK(!Source.FindUserDefinedType("UMissing").IsValid());
+}
+
+static void TestWrittenLayoutFiles(const FMemorySymbolSource& Source) {
+    const std::filesystem::path OutputPath = MakeEmptyTestDirectory("TypeLayoutGeneratorTestOutput");
+    FOutputDirectory OutputDirectory{OutputPath};
+    CHECK(OutputDirectory.Open());
+
+    CHECK(GenerateTypeLayoutFile(OutputDirectory, Source, std::string{"UObject"}));
+    CHECK(GenerateTypeLayoutFile(OutputDirectory, Source, std::string{"UObjectBase"}));
+    CHECK(!GenerateTypeLayoutFile(OutputDirectory, Source, std::string{"UMissing"}));
+    CHECK(OutputDirectory.WaitForPendingWrites());
+
+    CHECK_EQUAL(ReadFileContents(OutputPath / "UObject.h"), std::string{ExpectedUObjectLayout});
+    CHECK_EQUAL(ReadFileContents(OutputPath / "UObjectBase.h"), std::string{ExpectedUObjectBaseLayout});
+    CHECK_EQUAL(OutputDirectory.GetNumWrittenFiles(), size_t{2});
+}
+
+///Section of the consolidated header is the same layout, wrapped into an include guard of its own
+static void TestTypeLayoutSection(const FMemorySymbolSource& Source) {
+    FUserDefinedTypeLayout TypeLayout{};
+    GenerateUserDefinedTypeLayout(Source, Source.FindUserDefinedType("UObject"), TypeLayout);
+
+    const std::string ExpectedSection = std::string{"#ifndef UVTD_TYPE_SECTION_UObject\n#define UVTD_TYPE_SECTION_UObject\n"} + ExpectedUObjectLayout + "#endif /* UVTD_TYPE_SECTION_UObject */\n\n";
+    CHECK_EQUAL(GenerateTypeLayoutSection(TypeLayout, nullptr), ExpectedSection);
+}
+
+///Arrays are spelled through TIdentity, and zero-length arrays keep their count, same as DIA reports them
+static void TestArrayDeclarations() {
+    FMemorySymbolSource Source;
+    const FSymbolHandle UInt8 = Source.AddBasicType(EBasicType::UInt, 1);
+    CHECK_EQUAL(GenerateTypeDeclarationForSymbol(Source, Source.AddArrayType(UInt8, 0)), std::string{"TIdentity<uint8[0]>::Type"});
+    CHECK_EQUAL(GenerateTypeDeclarationForSymbol(Source, Source.AddArrayType(Source.AddArrayType(UInt8, 3), 2)), std::string{"TIdentity<TIdentity<uint8[3]>::Type[2]>::Type"});
+}
+
+int main() {
+    FMemorySymbolSource Source;
+    AddSyntheticTypes(Source);
+
+    TestUserDefinedTypeLayout(Source);
+    TestWrittenLayoutFiles(Source);
+    TestTypeLayoutSection(Source);
+    TestArrayDeclarations();
+    return FinishTest("TypeLayoutGeneratorTest");
+}